@@ -51,6 +51,8 @@
 #define SSL_CHARBUF_LENGTH 256
 // number of bytes to read from the random devices
 #define SSL_PRNG_LENGTH 1024
+// number of fragments a scatter-gather send copies onto the stack, longer lists are allocated
+#define AS_LOCAL_FRAGMENTS 8
 
 #ifndef NI_MAXHOST
 #define NI_MAXHOST 1024
@@ -59,6 +61,47 @@
 #define NI_MAXSERV 32
 #endif
 
+/********************************
+ **  Scatter-gather sending helpers
+ *********************************/
+
+static int fragments_length(const struct iovec* fragments, int fragment_count)
+{
+  int length = 0;
+  for (int i = 0; i < fragment_count; i++) length += fragments[i].iov_len;
+  return length;
+}
+
+// Copies the fragments after each other into buf, for the functions taking one contiguous buffer
+static void join_fragments(const struct iovec* fragments, int fragment_count, TTCN_Buffer& buf)
+{
+  unsigned char* end_ptr;
+  size_t end_len = fragments_length(fragments, fragment_count);
+  buf.clear();
+  buf.get_end(end_ptr, end_len);
+  size_t pos = 0;
+  for (int i = 0; i < fragment_count; i++) {
+    memcpy(end_ptr + pos, fragments[i].iov_base, fragments[i].iov_len);
+    pos += fragments[i].iov_len;
+  }
+  buf.increase_length(pos);
+}
+
+// Steps over the first sent bytes of the pending fragments, returns the number of fragments left
+static int skip_sent_fragments(struct iovec*& pending, int pending_count, size_t sent)
+{
+  while (pending_count > 0 && sent >= pending->iov_len) {
+    sent -= pending->iov_len;
+    pending++;
+    pending_count--;
+  }
+  if (pending_count > 0) {
+    pending->iov_base = (char*)pending->iov_base + sent;
+    pending->iov_len -= sent;
+  }
+  return pending_count;
+}
+
 /********************************
  **  PacketHeaderDescr
  **  used for fragmentation and concatenation
@@ -167,6 +210,7 @@ Abstract_Socket::Abstract_Socket() {
   memset(&remoteAddr, 0, sizeof(remoteAddr));
   memset(&localAddr, 0, sizeof(localAddr));
   server_backlog=1;
+  recv_buffer_size=AS_TCP_CHUNCK_SIZE;
   peer_list_length=0;
   local_host_name = NULL;
   local_port_number = 0;
@@ -195,6 +239,7 @@ Abstract_Socket::Abstract_Socket(const char *tp_type, const char *tp_name) {
   memset(&remoteAddr, 0, sizeof(remoteAddr));
   memset(&localAddr, 0, sizeof(localAddr));
   server_backlog=1;
+  recv_buffer_size=AS_TCP_CHUNCK_SIZE;
   peer_list_length=0;
   local_host_name = NULL;
   local_port_number = 0;
@@ -277,6 +322,9 @@ bool Abstract_Socket::parameter_set(const char *parameter_name,
     else if (strcasecmp(parameter_value, "no") == 0) use_non_blocking_socket = false;
   } else if (strcmp(parameter_name, server_backlog_name()) == 0) {
     if (sscanf(parameter_value, "%d", &server_backlog)!=1) log_error("Invalid input as server backlog given: %s", parameter_value);
+  } else if (strcmp(parameter_name, recv_buffer_size_name()) == 0) {
+    if (sscanf(parameter_value, "%d", &recv_buffer_size)!=1) log_error("Invalid input as receive buffer size given: %s", parameter_value);
+    if (recv_buffer_size<=0) log_error("recv_buffer_size must be greater than 0, %d is given", recv_buffer_size);
   } else {
     //log_debug("leaving Abstract_Socket::parameter_set(%s, %s)", parameter_name, parameter_value);
     return false;
@@ -425,7 +473,7 @@ int Abstract_Socket::receive_message_on_fd(int client_id)
   as_client_struct * client_data = get_peer(client_id);
   TTCN_Buffer* recv_tb = client_data->fd_buff;
   unsigned char *end_ptr;
-  size_t end_len=AS_TCP_CHUNCK_SIZE;
+  size_t end_len=recv_buffer_size;
   recv_tb->get_end(end_ptr, end_len);
   int messageLength = recv(client_id, (char *)end_ptr, end_len, 0);
   if (messageLength==0) return messageLength; // peer disconnected
@@ -546,6 +594,116 @@ client_closed_connection:
     return -1;
 }
 
+int Abstract_Socket::send_message_on_fd_v(int client_id, const struct iovec* fragments, int fragment_count)
+{
+  get_peer(client_id);
+  return writev(client_id, fragments, fragment_count);
+}
+
+//Works like send_message_on_nonblocking_fd(), after a partial write
+//writev() continues with the first byte that was not sent.
+int Abstract_Socket::send_message_on_nonblocking_fd_v(int client_id,
+                                                const struct iovec* fragments,
+                                                int fragment_count){
+
+    log_debug("entering Abstract_Socket::send_message_on_nonblocking_fd_v(id: %d)", client_id);
+    as_client_struct * client_data = get_peer(client_id);
+    int sent_len = 0;
+    int result;
+    struct iovec local_fragments[AS_LOCAL_FRAGMENTS];
+    struct iovec* pending_list = fragment_count <= AS_LOCAL_FRAGMENTS ? local_fragments :
+        (struct iovec*)Malloc(fragment_count * sizeof(struct iovec));
+    struct iovec* pending = pending_list;
+    memcpy(pending_list, fragments, fragment_count * sizeof(struct iovec));
+    int pending_count = skip_sent_fragments(pending, fragment_count, 0);
+
+    while(pending_count > 0){
+        int ret;
+        log_debug("Abstract_Socket::send_message_on_nonblocking_fd_v(id: %d): new iteration", client_id);
+        client_data = get_peer(client_id);
+        if (client_data->reading_state == STATE_DONT_CLOSE){
+            goto client_closed_connection;
+        } else ret = writev(client_id, pending, pending_count);
+
+        if (ret > 0){
+            sent_len += ret;
+            pending_count = skip_sent_fragments(pending, pending_count, ret);
+        } else{
+            switch(errno){
+                case EINTR:{ //signal: do nothing, try again
+                    errno = 0;
+                    break;
+                }
+                case EPIPE:{ //client closed connection
+                    goto client_closed_connection;
+                }
+                case EAGAIN:{ // the output buffer is full:
+                              //try to increase it if possible
+                    errno = 0;
+                    int old_bufsize, new_bufsize;
+
+                    if (increase_send_buffer(
+                            client_id, old_bufsize, new_bufsize)) {
+                        log_warning("Sending data on on file descriptor %d",
+                                    client_id);
+                        log_warning("The sending operation would"
+                                    "block execution. The size of the "
+                                    "outgoing buffer was increased from %d to "
+                                    "%d bytes.",old_bufsize,
+                                    new_bufsize);
+                    } else {
+                        log_warning("Sending data on file descriptor %d",
+                                    client_id);
+                        log_warning("The sending operation would block "
+                                    "execution and it is not possible to "
+                                    "further increase the size of the "
+                                    "outgoing buffer. Trying to process incoming"
+                                    "data to avoid deadlock.");
+                        log_debug("Abstract_Socket::"
+                                  "send_message_on_nonblocking_fd_v():"
+                                  " setting socket state to "
+                                  "STATE_BLOCK_FOR_SENDING");
+                        client_data->reading_state = STATE_BLOCK_FOR_SENDING;
+                        TTCN_Snapshot::block_for_sending(client_id);
+                    }
+                    break;
+                }
+                default:{
+                    log_debug("Abstract_Socket::"
+                              "send_message_on_nonblocking_fd_v(): "
+                              "setting socket state to STATE_NORMAL");
+                    client_data->reading_state = STATE_NORMAL;
+                    log_debug("leaving Abstract_Socket::"
+                              "send_message_on_nonblocking_fd_v(id: %d)"
+                              " with error", client_id);
+                    result = -1;
+                    goto free_fragments;
+                }
+            } //end of switch
+        }//end of else
+    } //end of while
+
+    log_debug("Abstract_Socket::send_message_on_nonblocking_fd_v():"
+              "setting socket state to STATE_NORMAL");
+    client_data->reading_state = STATE_NORMAL;
+    log_debug("leaving Abstract_Socket::"
+              "send_message_on_nonblocking_fd_v(id: %d)", client_id);
+    result = sent_len;
+    goto free_fragments;
+
+client_closed_connection:
+    log_debug("Abstract_Socket::send_message_on_nonblocking_fd_v(): setting socket state to STATE_NORMAL");
+    client_data->reading_state = STATE_NORMAL;
+    log_debug("leaving Abstract_Socket::"
+              "send_message_on_nonblocking_fd_v(id: %d)", client_id);
+    errno = EPIPE;
+    result = -1;
+
+free_fragments:
+    if (pending_list != local_fragments) Free(pending_list);
+    return result;
+}
+
 const PacketHeaderDescr* Abstract_Socket::Get_Header_Descriptor() const
 {
   return NULL;
@@ -567,30 +725,35 @@ void Abstract_Socket::handle_message(int client_id)
   } else {
     recv_tb->rewind();
     unsigned long valid_header_length = head_descr->Get_Valid_Header_Length();
-    while (recv_tb->get_len() > 0) {
-      if ((unsigned long)recv_tb->get_len() < valid_header_length) {
+    // start of the next message, the delivered ones are cut from the buffer together at the end
+    size_t message_pos = 0;
+    while (recv_tb->get_len() > message_pos) {
+      const unsigned char* message = recv_tb->get_data() + message_pos;
+      unsigned long available_length = recv_tb->get_len() - message_pos;
+      if (available_length < valid_header_length) {
         // this is a message without a valid header
         // recv_tb->handle_fragment();
-        return;
+        break;
       }
       unsigned long message_length =
-	head_descr->Get_Message_Length(recv_tb->get_data());
+	head_descr->Get_Message_Length(message);
       if (message_length < valid_header_length) {
         // this is a message with a malformed length
 	log_error("Malformed message: invalid length: %lu. The length should "
 	  "be at least %lu.", message_length, valid_header_length);
       }
-      if((unsigned long)recv_tb->get_len() < message_length){
+      if(available_length < message_length){
         // this is a fragmented message with a valid header
         // recv_tb->handle_fragment();
-        return;
+        break;
       }
       // this a valid message
-      message_incoming(recv_tb->get_data(), message_length, client_id);
-      if (!ttcn_buffer_usercontrol) {
-         recv_tb->set_pos(message_length);
-         recv_tb->cut();
-      }
+      message_incoming(message, message_length, client_id);
+      if (!ttcn_buffer_usercontrol) message_pos += message_length;
+    }
+    if (message_pos > 0) {
+      recv_tb->set_pos(message_pos);
+      recv_tb->cut();
     }
   }
   log_debug("leaving Abstract_Socket::handle_message()");
@@ -1564,6 +1727,50 @@ void Abstract_Socket::send_outgoing(const unsigned char* send_par, int length, i
   //log_debug("leaving Abstract_Socket::send_outgoing()");
 }
 
+void Abstract_Socket::send_outgoing_v(const struct iovec* fragments, int fragment_count, int client_id)
+{
+  int dest_fd;
+  int nrOfBytesSent;
+  int length = fragments_length(fragments, fragment_count);
+
+  dest_fd = client_id;
+
+  if (dest_fd == -1) {
+    if(peer_list_get_nr_of_peers() > 1)
+      log_error("Client Id not specified altough not only 1 client exists");
+    else if(peer_list_get_nr_of_peers() == 0)
+      log_error("[Internet Connection Error!!!]There is no connection alive, use a Connect ASP before sending anything.");
+    dest_fd = peer_list_get_first_peer();
+  }
+  as_client_struct * client_data = get_peer(dest_fd,true);
+  if(!client_data || ((client_data->tcp_state != ESTABLISHED) && (client_data->tcp_state != CLOSE_WAIT))){
+    char *error_text=mprintf("client nr %i has no established connection", dest_fd);
+    TTCN_Buffer joined;
+    join_fragments(fragments, fragment_count, joined);
+    report_error(client_id,length,-2,joined.get_data(),error_text);
+    Free(error_text);
+    return;
+  }
+
+  nrOfBytesSent = use_non_blocking_socket ? send_message_on_nonblocking_fd_v(dest_fd, fragments, fragment_count) :
+                                            send_message_on_fd_v(dest_fd, fragments, fragment_count);
+
+  if (nrOfBytesSent == -1 && errno == EPIPE){  // means connection was interrupted by peer
+    errno = 0;
+    log_debug("Client %d closed connection", client_id);
+    remove_client(dest_fd);
+    peer_disconnected(dest_fd);
+  }else if (nrOfBytesSent != length) {
+    char *error_text=mprintf("Send system call failed: %d bytes were sent instead of %d", nrOfBytesSent, length);
+    TTCN_Buffer joined;
+    join_fragments(fragments, fragment_count, joined);
+    report_error(client_id,length,nrOfBytesSent,joined.get_data(),error_text);
+    Free(error_text);
+  } else {
+    log_debug("Abstract_Socket::send_outgoing_v: Number of bytes sent = %d", nrOfBytesSent);
+  }
+}
+
 void Abstract_Socket::report_error(int /*client_id*/, int /*msg_length*/, int /*sent_length*/, const unsigned char* /*msg*/, const char* error_text)
 {
   log_error("%s",error_text);
@@ -1774,6 +1981,7 @@ const char* Abstract_Socket::socket_debugging_name()        { return "socket_deb
 const char* Abstract_Socket::nagling_name()                 { return "nagling";}
 const char* Abstract_Socket::use_non_blocking_socket_name() { return "use_non_blocking_socket";}
 const char* Abstract_Socket::server_backlog_name()          { return "server_backlog";}
+const char* Abstract_Socket::recv_buffer_size_name()        { return "recv_buffer_size";}
 bool Abstract_Socket::add_user_data(int) {return true;}
 bool Abstract_Socket::remove_user_data(int) {return true;}
 bool Abstract_Socket::user_all_mandatory_configparameters_present() { return true; }
@@ -2462,6 +2670,36 @@ client_closed_connection:
 
 }
 
+int SSL_Socket::send_message_on_fd_v(int client_id, const struct iovec* fragments, int fragment_count)
+{
+  log_debug("entering SSL_Socket::send_message_on_fd_v()");
+
+  if (!ssl_use_ssl) {
+    log_debug("leaving SSL_Socket::send_message_on_fd_v()");
+    return Abstract_Socket::send_message_on_fd_v(client_id, fragments, fragment_count);
+  }
+
+  TTCN_Buffer joined;
+  join_fragments(fragments, fragment_count, joined);
+  log_debug("leaving SSL_Socket::send_message_on_fd_v() with returning SSL_Socket::send_message_on_fd()");
+  return SSL_Socket::send_message_on_fd(client_id, joined.get_data(), joined.get_len());
+}
+
+int SSL_Socket::send_message_on_nonblocking_fd_v(int client_id, const struct iovec* fragments, int fragment_count)
+{
+  log_debug("entering SSL_Socket::send_message_on_nonblocking_fd_v()");
+
+  if (!ssl_use_ssl) {
+    log_debug("leaving SSL_Socket::send_message_on_nonblocking_fd_v()");
+    return Abstract_Socket::send_message_on_nonblocking_fd_v(client_id, fragments, fragment_count);
+  }
+
+  TTCN_Buffer joined;
+  join_fragments(fragments, fragment_count, joined);
+  log_debug("leaving SSL_Socket::send_message_on_nonblocking_fd_v() with returning SSL_Socket::send_message_on_nonblocking_fd()");
+  return SSL_Socket::send_message_on_nonblocking_fd(client_id, joined.get_data(), joined.get_len());
+}
+
 bool SSL_Socket::ssl_verify_certificates()
 {
   char str[SSL_CHARBUF_LENGTH];
@@ -36,6 +36,7 @@
 #endif
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <TTCN3.hh>
 
@@ -124,6 +125,8 @@ protected:
 
   // Shall be called from outgoing_send()
   void send_outgoing(const unsigned char* message_buffer, int length, int client_id = -1);
+  // Sends the fragments as one message without joining them first, e.g. a protocol header and its payload
+  void send_outgoing_v(const struct iovec* fragments, int fragment_count, int client_id = -1);
   void send_shutdown(int client_id = -1);
 
   // Access to private variables
@@ -188,6 +191,9 @@ protected:
   // Called when a message is to be sent
   virtual int send_message_on_fd(int client_id, const unsigned char* message_buffer, int message_length);
   virtual int send_message_on_nonblocking_fd(int client_id, const unsigned char *message_buffer, int message_length);
+  // Called when a message given in fragments is to be sent, shall return like send_message_on_fd()
+  virtual int send_message_on_fd_v(int client_id, const struct iovec* fragments, int fragment_count);
+  virtual int send_message_on_nonblocking_fd_v(int client_id, const struct iovec* fragments, int fragment_count);
   // Called after a peer is connected
   virtual void peer_connected(int client_id, sockaddr_in& remote_addr); /* This function should be removed! deprecated by: */
   virtual void peer_connected(int /*client_id*/, const char * /*host*/, const int /*port*/) {};
@@ -214,6 +220,7 @@ protected:
   virtual const char* nagling_name();
   virtual const char* use_non_blocking_socket_name();
   virtual const char* server_backlog_name();
+  virtual const char* recv_buffer_size_name();
 
   // Fetch/Set user data pointer
   void* get_user_data(int client_id) {return get_peer(client_id)->user_data;}
@@ -273,6 +280,7 @@ private:
   struct sockaddr_in remoteAddr; /* FIXME: not used! should be removed */
   struct sockaddr_in localAddr;  /* FIXME: not used! should be removed */
   int  server_backlog;
+  int  recv_buffer_size; // bytes read from a TCP connection at once, into the end of its buffer
   int  deadlock_counter;
   int  listen_fd;
   int  peer_list_length;
@@ -324,6 +332,9 @@ protected:
   // If error occured, execution shall stop in the function by calling log_error()
   virtual int  send_message_on_fd(int client_id, const unsigned char * message_buffer, int length_of_message);
   virtual int  send_message_on_nonblocking_fd(int client_id, const unsigned char * message_buffer, int length_of_message);
+  // SSL_write() takes one buffer, so the fragments are joined and sent like a contiguous message
+  virtual int  send_message_on_fd_v(int client_id, const struct iovec* fragments, int fragment_count);
+  virtual int  send_message_on_nonblocking_fd_v(int client_id, const struct iovec* fragments, int fragment_count);
 
   // The following members can be called to fetch the current values
   bool         get_ssl_use_ssl() const                {return ssl_use_ssl;}
@@ -0,0 +1,389 @@
+#pragma once
+
+/**
+ * Copyright (c) 2017  Korea Electronics Technology Institute.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of
+ * - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),
+ * - BSD-3 Clause Licence(http://www.iotocean.org/license/).
+ *
+ * Open-addressing hash map with Robin Hood linear probing.
+ *
+ * All entries live in one array, a second array holds the probe distance of every
+ * slot, so a lookup only touches contiguous memory and never allocates. Erase
+ * uses backward shifting, there are no tombstones.
+ *
+ * Lookups are templates on the key type so that a std::string keyed map can be
+ * searched with a StringRef or a const char* without building a std::string,
+ * provided the hash functor gives the same value for all of them (see FlatHash).
+ *
+ * K and V must be default constructible and assignable: unused slots hold K()
+ * and V(). Pointers to values and iterators are invalidated by put() and
+ * remove().
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <algorithm>
+
+// Non-owning reference to a character sequence, used for heterogeneous lookups
+struct StringRef
+{
+    const char *data;
+    size_t length;
+
+    StringRef(const char *d, size_t l) : data(d), length(l) {}
+    StringRef(const char *s) : data(s), length(strlen(s)) {}
+    StringRef(const std::string &s) : data(s.data()), length(s.length()) {}
+};
+
+inline bool operator==(const std::string &a, const StringRef &b)
+{
+    return a.length() == b.length && memcmp(a.data(), b.data, b.length) == 0;
+}
+
+// Default hash functor of FlatHashMap
+template <typename K>
+struct FlatHash {
+    size_t operator()(const K &key) const
+    {
+        // integer keys (socket fds, request ids, ...): 64-bit finalizer of murmur3
+        unsigned long long h = (unsigned long long)key;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return (size_t)h;
+    }
+};
+
+template <>
+struct FlatHash<std::string> {
+    // FNV-1a with a final avalanche, the low bits select the slot
+    static size_t hash(const char *data, size_t length)
+    {
+        unsigned long long h = 14695981039346656037ULL;
+
+        for (size_t i = 0; i < length; ++i) {
+            h ^= (unsigned char)data[i];
+            h *= 1099511628211ULL;
+        }
+        h ^= h >> 32;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 29;
+        return (size_t)h;
+    }
+
+    size_t operator()(const std::string &key) const
+    {
+        return hash(key.data(), key.length());
+    }
+
+    size_t operator()(const StringRef &key) const
+    {
+        return hash(key.data, key.length);
+    }
+
+    size_t operator()(const char *key) const
+    {
+        return hash(key, strlen(key));
+    }
+};
+
+template <typename K, typename V, typename Hash = FlatHash<K> >
+class FlatHashMap
+{
+public:
+    typedef std::pair<K, V> value_type;
+
+    template <typename Entry, typename Map>
+    class basic_iterator
+    {
+    public:
+        basic_iterator() : map(NULL), index(0) {}
+
+        // allows converting an iterator into a const_iterator
+        template <typename E2, typename M2>
+        basic_iterator(const basic_iterator<E2, M2> &other) : map(other.map), index(other.index) {}
+
+        Entry &operator*() const { return map->slots[index]; }
+        Entry *operator->() const { return &map->slots[index]; }
+
+        basic_iterator &operator++()
+        {
+            index = map->nextUsed(index + 1);
+            return *this;
+        }
+
+        basic_iterator operator++(int)
+        {
+            basic_iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        bool operator==(const basic_iterator &other) const { return index == other.index; }
+        bool operator!=(const basic_iterator &other) const { return index != other.index; }
+
+    private:
+        friend class FlatHashMap;
+        template <typename E2, typename M2> friend class basic_iterator;
+
+        basic_iterator(Map *m, size_t i) : map(m), index(i) {}
+
+        Map *map;
+        size_t index;
+    };
+
+    // the key of an entry must not be modified through an iterator
+    typedef basic_iterator<value_type, FlatHashMap> iterator;
+    typedef basic_iterator<const value_type, const FlatHashMap> const_iterator;
+
+    explicit FlatHashMap(size_t expectedSize = 0) :
+        slots(NULL),
+        distances(NULL),
+        capacity(0),
+        count(0),
+        hashFunc()
+    {
+        reserve(expectedSize);
+    }
+
+    ~FlatHashMap()
+    {
+        delete[] slots;
+        delete[] distances;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    iterator begin() { return iterator(this, nextUsed(0)); }
+    iterator end() { return iterator(this, capacity); }
+    const_iterator begin() const { return const_iterator(this, nextUsed(0)); }
+    const_iterator end() const { return const_iterator(this, capacity); }
+
+    // makes room for n entries without further growth
+    void reserve(size_t n)
+    {
+        size_t newCapacity = MIN_CAPACITY;
+
+        while (newCapacity * MAX_LOAD_NUM / MAX_LOAD_DEN < n) {
+            newCapacity *= 2;
+        }
+        if (newCapacity > capacity) {
+            rehash(newCapacity);
+        }
+    }
+
+    void clear()
+    {
+        for (size_t i = 0; i < capacity; ++i) {
+            if (distances[i] != 0) {
+                resetSlot(i);
+            }
+        }
+        count = 0;
+    }
+
+    // returns a pointer to the stored value, or NULL if the key is not present
+    template <typename Q>
+    V *find(const Q &key)
+    {
+        size_t i = locate(key);
+        return i != capacity ? &slots[i].second : NULL;
+    }
+
+    template <typename Q>
+    const V *find(const Q &key) const
+    {
+        size_t i = locate(key);
+        return i != capacity ? &slots[i].second : NULL;
+    }
+
+    template <typename Q>
+    bool get(const Q &key, V &value) const
+    {
+        const V *found = find(key);
+
+        if (found == NULL) {
+            return false;
+        }
+        value = *found;
+        return true;
+    }
+
+    template <typename Q>
+    bool contains(const Q &key) const
+    {
+        return locate(key) != capacity;
+    }
+
+    // inserts the entry or replaces the value of an existing key, returns true if the key was new
+    bool put(const K &key, const V &value)
+    {
+        size_t i = locate(key);
+
+        if (i != capacity) {
+            slots[i].second = value;
+            return false;
+        }
+
+        if ((count + 1) > capacity * MAX_LOAD_NUM / MAX_LOAD_DEN) {
+            rehash(capacity * 2);
+        }
+
+        K k(key);
+        V v(value);
+
+        insertNew(k, v);
+        ++count;
+        return true;
+    }
+
+    // returns the value of the key, inserting V() first if the key is not present
+    V &operator[](const K &key)
+    {
+        size_t i = locate(key);
+
+        if (i == capacity) {
+            put(key, V());
+            i = locate(key);
+        }
+        return slots[i].second;
+    }
+
+    // returns true if the key was present
+    template <typename Q>
+    bool remove(const Q &key)
+    {
+        size_t i = locate(key);
+
+        if (i == capacity) {
+            return false;
+        }
+
+        // backward shift: pull the following displaced entries one slot closer to home
+        size_t next = (i + 1) & mask();
+
+        while (distances[next] > 1) {
+            swapSlots(i, next);
+            distances[i] = distances[next] - 1;
+            i = next;
+            next = (next + 1) & mask();
+        }
+        resetSlot(i);
+        --count;
+        return true;
+    }
+
+private:
+    enum {
+        MIN_CAPACITY = 8,
+        MAX_LOAD_NUM = 7, // grow when more than 7/8 of the slots are used
+        MAX_LOAD_DEN = 8
+    };
+
+    FlatHashMap(const FlatHashMap &other);
+    const FlatHashMap &operator=(const FlatHashMap &other);
+
+    size_t mask() const { return capacity - 1; }
+
+    size_t nextUsed(size_t i) const
+    {
+        while (i < capacity && distances[i] == 0) {
+            ++i;
+        }
+        return i;
+    }
+
+    // returns the slot index of the key, or capacity if it is not present
+    template <typename Q>
+    size_t locate(const Q &key) const
+    {
+        if (count == 0) {
+            return capacity;
+        }
+
+        size_t i = hashFunc(key) & mask();
+
+        // an entry closer to its home than we are to ours means the key is not in the table
+        for (size_t distance = 1; distance <= distances[i]; ++distance) {
+            if (distances[i] == distance && slots[i].first == key) {
+                return i;
+            }
+            i = (i + 1) & mask();
+        }
+        return capacity;
+    }
+
+    // Robin Hood insertion of a key known to be absent into a table with a free slot, k and v are consumed
+    void insertNew(K &k, V &v)
+    {
+        size_t i = hashFunc(k) & mask();
+        size_t distance = 1;
+
+        for (;;) {
+            if (distances[i] == 0) {
+                std::swap(slots[i].first, k);
+                std::swap(slots[i].second, v);
+                distances[i] = distance;
+                return;
+            }
+
+            if (distances[i] < distance) {
+                // take the slot of the richer entry and carry on inserting that one
+                std::swap(slots[i].first, k);
+                std::swap(slots[i].second, v);
+                size_t displaced = distances[i];
+                distances[i] = distance;
+                distance = displaced;
+            }
+
+            i = (i + 1) & mask();
+            ++distance;
+        }
+    }
+
+    void rehash(size_t newCapacity)
+    {
+        value_type *oldSlots = slots;
+        size_t *oldDistances = distances;
+        size_t oldCapacity = capacity;
+
+        slots = new value_type[newCapacity];
+        distances = new size_t[newCapacity];
+        memset(distances, 0, newCapacity * sizeof(size_t));
+        capacity = newCapacity;
+
+        for (size_t i = 0; i < oldCapacity; ++i) {
+            if (oldDistances[i] != 0) {
+                insertNew(oldSlots[i].first, oldSlots[i].second);
+            }
+        }
+
+        delete[] oldSlots;
+        delete[] oldDistances;
+    }
+
+    void swapSlots(size_t a, size_t b)
+    {
+        std::swap(slots[a].first, slots[b].first);
+        std::swap(slots[a].second, slots[b].second);
+    }
+
+    void resetSlot(size_t i)
+    {
+        slots[i].first = K();
+        slots[i].second = V();
+        distances[i] = 0;
+    }
+
+    value_type *slots;
+    size_t *distances; // 1 + distance of the entry from its home slot, 0 for an empty slot
+    size_t capacity;
+    size_t count;
+    Hash hashFunc;
+};
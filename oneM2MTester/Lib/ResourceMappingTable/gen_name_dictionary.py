@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2017  Korea Electronics Technology Institute.
+# All rights reserved. This program and the accompanying materials
+# are made available under the terms of
+# - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),
+# - BSD-3 Clause Licence(http://www.iotocean.org/license/).
+#
+#  File:               gen_name_dictionary.py
+#  Description:        Generates OneM2M_NameDictionary.hh, the compiled-in minimal perfect hash
+#                      tables of the oneM2M long/short name mapping, from the *_mapping.txt files
+#  Rev:                R2I
+#
+#  Usage: gen_name_dictionary.py [table_dir [output_file]]
+#  Run it again whenever long_to_short_mapping.txt or short_to_long_mapping.txt is modified.
+
+import os
+import sys
+
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+MASK32 = 0xffffffff
+
+# Must match NameDictionary::hash() in OneM2M_NameMapping.cc
+def name_hash(key, seed):
+    h = (FNV_OFFSET_BASIS ^ seed) & MASK32
+    for b in key:
+        h ^= b
+        h = (h * FNV_PRIME) & MASK32
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & MASK32
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & MASK32
+    h ^= h >> 16
+    return h
+
+
+def read_table(file_path):
+    # same rules as NameMappingRegistry::readTableFile(), later entries replace earlier ones
+    table = {}
+    with open(file_path, 'rb') as f:
+        for line in f.read().split(b'\n'):
+            line = line.rstrip(b'\r')
+            if not line:
+                continue
+            parts = line.split(b'=')
+            source = parts[0]
+            dest = b''
+            for part in parts[1:]:
+                if part:
+                    dest = part
+            if not source or not dest:
+                sys.exit('%s: invalid mapping entry <%s>' % (file_path, line.decode()))
+            table[source] = dest
+    return table
+
+
+def build_perfect_hash(keys):
+    """Hash and displace: keys are first grouped into buckets by name_hash(key, 0), then every bucket,
+       largest first, gets the smallest seed that moves all of its keys to free slots."""
+    size = len(keys)
+    bucket_count = max(1, (size + 3) // 4)
+    buckets = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[name_hash(key, 0) % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots = [None] * size
+    for index in sorted(range(bucket_count), key=lambda i: -len(buckets[i])):
+        bucket = buckets[index]
+        if not bucket:
+            continue
+        seed = 1
+        while True:
+            positions = [name_hash(key, seed) % size for key in bucket]
+            if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+                break
+            seed += 1
+        seeds[index] = seed
+        for key, position in zip(bucket, positions):
+            slots[position] = key
+    return seeds, slots
+
+
+def c_string(data):
+    out = []
+    for b in data:
+        c = chr(b)
+        if c in '"\\' or not (32 <= b < 127):
+            out.append('\\%03o' % b)
+        else:
+            out.append(c)
+    return ''.join(out)
+
+
+def emit_dictionary(out, name, table):
+    seeds, slots = build_perfect_hash(list(table.keys()))
+
+    strings = []
+    entries = []
+    offset = 0
+    for key in slots:
+        value = table[key]
+        if len(key) > 255 or len(value) > 255:
+            sys.exit('mapping entry <%s> is too long' % key.decode())
+        entries.append((offset, len(key), offset + len(key) + 1, len(value), key, value))
+        strings.append('\t"%s\\0" "%s\\0"' % (c_string(key), c_string(value)))
+        offset += len(key) + len(value) + 2
+    if offset > 65535:
+        sys.exit('%s: string storage exceeds 64 KB' % name)
+
+    out.write('\tstatic const char %s_STRINGS[] =\n' % name)
+    out.write('\n'.join(strings))
+    out.write(';\n\n')
+
+    out.write('\tstatic const NameDictionaryEntry %s_ENTRIES[%d] = {\n' % (name, len(entries)))
+    for key_offset, key_length, value_offset, value_length, key, value in entries:
+        out.write('\t\t{%d, %d, %d, %d}, // %s=%s\n' % (key_offset, key_length, value_offset, value_length,
+                                                     c_string(key), c_string(value)))
+    out.write('\t};\n\n')
+
+    out.write('\tstatic const unsigned int %s_SEEDS[%d] = {' % (name, len(seeds)))
+    for i, seed in enumerate(seeds):
+        out.write(('\n\t\t' if i % 16 == 0 else ' ') + '%d,' % seed)
+    out.write('\n\t};\n\n')
+
+    out.write('\tstatic const NameDictionary %s = {\n' % name)
+    out.write('\t\t%s_STRINGS, %s_ENTRIES, %s_SEEDS, %d, %d\n' % (name, name, name, len(entries), len(seeds)))
+    out.write('\t};\n\n')
+
+
+def main():
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    table_dir = sys.argv[1] if len(sys.argv) > 1 else script_dir
+    output = sys.argv[2] if len(sys.argv) > 2 else os.path.join(script_dir, '..', '..', 'src', 'Functions',
+                                                               'OneM2M_NameDictionary.hh')
+
+    l2s = read_table(os.path.join(table_dir, 'long_to_short_mapping.txt'))
+    s2l = read_table(os.path.join(table_dir, 'short_to_long_mapping.txt'))
+
+    with open(output, 'w') as out:
+        out.write('//  File:               OneM2M_NameDictionary.hh\n')
+        out.write('//  Description:        Compiled-in oneM2M long/short name mapping tables\n')
+        out.write('//\n')
+        out.write('//  GENERATED by Lib/ResourceMappingTable/gen_name_dictionary.py from\n')
+        out.write('//  long_to_short_mapping.txt and short_to_long_mapping.txt, DO NOT EDIT.\n\n')
+        out.write('#ifndef ONEM2M_NAMEDICTIONARY_HH\n#define ONEM2M_NAMEDICTIONARY_HH\n\n')
+        out.write('#include "OneM2M_NameMapping.hh"\n\n')
+        out.write('namespace OneM2M__DualFaceMapping {\n\n')
+        emit_dictionary(out, 'NAME_DICTIONARY_L2S', l2s)
+        emit_dictionary(out, 'NAME_DICTIONARY_S2L', s2l)
+        out.write('}\n\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -29,6 +29,7 @@
 #include <poll.h>
 #include <limits.h>
 #include <time.h>
+#include <vector>
 #include "IPL4asp_PT.hh"
 #include "IPL4asp_PortType.hh"
 #include "Socket_API_Definitions.hh"
@@ -156,6 +157,43 @@ INTEGER simpleGetMsgLen(const OCTETSTRING& stream, ro__integer& /*args*/)
   return stream.lengthof();
 } // simpleGetMsgLen
 
+struct NativeGetMsgLenEntry {
+  Socket__API__Definitions::f__getMsgLen::function_pointer f;
+  NativeGetMsgLen native_f;
+};
+
+// function local, the modules register their functions during static initialization
+static std::vector<NativeGetMsgLenEntry>& nativeGetMsgLenRegistry()
+{
+  static std::vector<NativeGetMsgLenEntry> registry;
+  return registry;
+}
+
+void registerNativeGetMsgLen(Socket__API__Definitions::f__getMsgLen::function_pointer f, NativeGetMsgLen native_f)
+{
+  std::vector<NativeGetMsgLenEntry>& registry = nativeGetMsgLenRegistry();
+  for (size_t i = 0; i < registry.size(); i++) {
+    if (registry[i].f == f) {
+      registry[i].native_f = native_f;
+      return;
+    }
+  }
+  NativeGetMsgLenEntry entry = { f, native_f };
+  registry.push_back(entry);
+} // registerNativeGetMsgLen
+
+// the native function registered for f, or NULL if f has to be invoked
+static NativeGetMsgLen findNativeGetMsgLen(const Socket__API__Definitions::f__getMsgLen& f)
+{
+  const std::vector<NativeGetMsgLenEntry>& registry = nativeGetMsgLenRegistry();
+  for (size_t i = 0; i < registry.size(); i++) {
+    if (f == registry[i].f) return registry[i].native_f;
+  }
+  return NULL;
+} // findNativeGetMsgLen
+
+static NativeGetMsgLenRegistrar fixedMsgLenRegistrar(f__IPL4__fixedMsgLen, fixedMsgLen);
+
 
 int SetLocalSockAddr(const char* debug_str, IPL4asp__PT_PROVIDER& portRef,
     int def_addr_family,
@@ -315,6 +353,45 @@ bool SetNameAndPort(SockAddr *sa, socklen_t saLen,
 } // SetNameAndPort
 
 
+#ifdef LINUX
+struct UdpRecvBatch {
+  UdpRecvBatch(int n) : size(n), msgs(new struct mmsghdr[n]), iovs(new struct iovec[n]),
+    addrs(new SockAddr[n]), data(new unsigned char[(size_t)n * RECV_MAX_LEN])
+  {
+    memset(msgs, 0, n * sizeof(struct mmsghdr));
+    for (int i = 0; i < n; i++) {
+      iovs[i].iov_base = data + (size_t)i * RECV_MAX_LEN;
+      iovs[i].iov_len = RECV_MAX_LEN;
+      msgs[i].msg_hdr.msg_name = &addrs[i];
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+  }
+  ~UdpRecvBatch()
+  {
+    delete [] msgs;
+    delete [] iovs;
+    delete [] addrs;
+    delete [] data;
+  }
+  int size;
+  struct mmsghdr *msgs;
+  struct iovec *iovs;
+  SockAddr *addrs;
+  unsigned char *data;
+};
+#else
+struct UdpRecvBatch {};
+#endif
+
+struct SendToBatchEntry {
+  int idx; // index of the message in the batch
+  int connId;
+  SockAddr to;
+  socklen_t toLen;
+};
+
+
 #ifdef IPL4_USE_SSL
 // cookie variables
 unsigned char ssl_cookie_secret[IPL4_COOKIE_SECRET_LENGTH];
@@ -336,11 +413,16 @@ IPL4asp__PT_PROVIDER::IPL4asp__PT_PROVIDER(const char *par_port_name)
   backlog = SOMAXCONN;
   defaultGetMsgLen = simpleGetMsgLen;
   defaultGetMsgLen_forConnClosedEvent = simpleGetMsgLen; // by default we pass up to TTCN the remaining buffer content on connClosed
+  defaultNativeGetMsgLen = NULL;
   defaultMsgLenArgs = new ro__integer(NULL_VALUE);
   defaultMsgLenArgs_forConnClosedEvent = new ro__integer(NULL_VALUE);
   pureNonBlocking = false;
   poll_timeout = -1;
   max_num_of_poll =-1;
+  recv_buffer_size = RECV_MAX_LEN;
+  tcp_recv_batch_size = 1;
+  udp_recv_batch_size = 1;
+  udpRecvBatch = NULL;
   lonely_conn_id = -1;
   lazy_conn_id_level = 0;
   sctp_PMTU_size = 0;
@@ -408,6 +490,7 @@ IPL4asp__PT_PROVIDER::~IPL4asp__PT_PROVIDER()
   IPL4_DEBUG("IPL4asp__PT_PROVIDER::~IPL4asp__PT_PROVIDER: enter");
   delete defaultMsgLenArgs;
   delete defaultMsgLenArgs_forConnClosedEvent;
+  delete udpRecvBatch;
   
   Free(defaultLocHost);
   Free(defaultRemHost);
@@ -460,6 +543,27 @@ void IPL4asp__PT_PROVIDER::set_parameter(const char *parameter_name,
         parameter_name, parameter_value);
   } else if (!strcmp(parameter_name, "max_num_of_poll")) {
     max_num_of_poll = atoi(parameter_value);
+  } else if (!strcmp(parameter_name, "recv_buffer_size")) {
+    recv_buffer_size = atoi(parameter_value);
+    if (recv_buffer_size <= 0) {
+      recv_buffer_size = RECV_MAX_LEN;
+      TTCN_warning("IPL4asp__PT_PROVIDER::set_parameter: invalid "
+          "recv_buffer_size value set to %d", recv_buffer_size);
+    }
+  } else if (!strcmp(parameter_name, "tcp_recv_batch_size")) {
+    tcp_recv_batch_size = atoi(parameter_value);
+    if (tcp_recv_batch_size <= 0) {
+      tcp_recv_batch_size = 1;
+      TTCN_warning("IPL4asp__PT_PROVIDER::set_parameter: invalid "
+          "tcp_recv_batch_size value set to %d", tcp_recv_batch_size);
+    }
+  } else if (!strcmp(parameter_name, "udp_recv_batch_size")) {
+    udp_recv_batch_size = atoi(parameter_value);
+    if (udp_recv_batch_size <= 0) {
+      udp_recv_batch_size = 1;
+      TTCN_warning("IPL4asp__PT_PROVIDER::set_parameter: invalid "
+          "udp_recv_batch_size value set to %d", udp_recv_batch_size);
+    }
   } else if (!strcmp(parameter_name, "poll_timeout")) {
     poll_timeout = atoi(parameter_value);
   } else if (!strcmp(parameter_name, "defaultListeningPort")) {
@@ -833,28 +937,28 @@ void IPL4asp__PT_PROVIDER::set_parameter(const char *parameter_name,
 void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable(int fd)
 {
   IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: fd: %i", fd);
-  std::map<int,int>::iterator it = fd2IndexMap.find(fd);
+  int connId = fd2Index(fd);
   if (pureNonBlocking) {
-    if (it != fd2IndexMap.end()) {
+    if (connId != -1) {
       //Add SSL layer
 #ifdef IPL4_USE_SSL
-      IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: client? %s sslState: %i", sockList[it->second].ssl_tls_type == CLIENT ? "yes" : "no", sockList[it->second].sslState);
-      if(sockList[it->second].ssl_tls_type != NONE && sockList[it->second].type != IPL4asp_SCTP)
+      IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: client? %s sslState: %i", sockList[connId].ssl_tls_type == CLIENT ? "yes" : "no", sockList[connId].sslState);
+      if(sockList[connId].ssl_tls_type != NONE && sockList[connId].type != IPL4asp_SCTP)
       {
-        switch(sockList[it->second].sslState){
+        switch(sockList[connId].sslState){
         case STATE_WAIT_FOR_RECEIVE_CALLBACK:
-          sockList[it->second].sslState = STATE_NORMAL;
+          sockList[connId].sslState = STATE_NORMAL;
           Handler_Remove_Fd_Write(fd);
           IPL4_DEBUG("DONT WRITE ON %i", fd);
           return;
         case STATE_CONNECTING:
         case STATE_HANDSHAKING: {
-          switch(perform_ssl_handshake(it->second))
+          switch(perform_ssl_handshake(connId))
           {
           case FAIL:
-            IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: SSL mapping failed for client socket: %d", sockList[it->second].sock);
-            if (ConnDel(it->second) == -1) IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: unable to close socket");
-            sendError(PortError::ERROR__SOCKET, it->second);
+            IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: SSL mapping failed for client socket: %d", sockList[connId].sock);
+            if (ConnDel(connId) == -1) IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: unable to close socket");
+            sendError(PortError::ERROR__SOCKET, connId);
             return;
           case WANT_READ:
             IPL4_DEBUG("DONT WRITE ON %i", fd);
@@ -868,28 +972,28 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable(int fd)
             IPL4_DEBUG( "IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: perform_ssl_handshake return value is not handled!");
           }
 
-          sockList[it->second].sslState = STATE_NORMAL;
+          sockList[connId].sslState = STATE_NORMAL;
           IPL4_DEBUG("DONT WRITE ON %i", fd);
           Handler_Remove_Fd_Write(fd);
 
-          if(sockList[it->second].server) {
+          if(sockList[connId].server) {
             IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: Client connection Accepted.");
-            reportConnOpened(it->second);
+            reportConnOpened(connId);
           } else {
-            sendError(PortError::ERROR__AVAILABLE, it->second);
+            sendError(PortError::ERROR__AVAILABLE, connId);
           }
 
           IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: Leave.");
           return;
         }
         default:
-          IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: Unhandled SSL State %d . Client: %d", sockList[it->second].sslState, it->second);
+          IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: Unhandled SSL State %d . Client: %d", sockList[connId].sslState, connId);
           Handler_Remove_Fd_Write(fd);
           IPL4_DEBUG("DONT WRITE ON %i", fd);
           IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: Leave.");
           return;
         }
-      } else if(sockList[it->second].ssl_tls_type != NONE && sockList[it->second].type == IPL4asp_SCTP)
+      } else if(sockList[connId].ssl_tls_type != NONE && sockList[connId].type == IPL4asp_SCTP)
       {
         Handler_Remove_Fd_Write(fd);
         IPL4_DEBUG("DONT WRITE ON %i", fd);
@@ -898,7 +1002,7 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable(int fd)
 #endif
       Handler_Remove_Fd_Write(fd);
       IPL4_DEBUG("DONT WRITE ON %i", fd);
-      sendError(PortError::ERROR__AVAILABLE, it->second);
+      sendError(PortError::ERROR__AVAILABLE, connId);
 
     } else
       IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Writable: Error: fd not found");
@@ -926,13 +1030,12 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable(int fd)
 #endif
 
 
-  std::map<int,int>::iterator it = fd2IndexMap.find(fd);
-  if (it == fd2IndexMap.end()) {
+  int connId = fd2Index(fd);
+  if (connId == -1) {
     IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable: Error: fd not found");
     return;
   }
 
-  int connId = it->second;
   IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable: connId: %d READABLE   sock: %i, type: %i, sslState: %i",
       connId, sockList[connId].sock, sockList[connId].type, sockList[connId].sslState);
 
@@ -951,6 +1054,7 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable(int fd)
 
   // Handle active socket
   int len = -3;
+  int received = 0; // bytes read from a TCP connection by the recv() calls of this event
   unsigned char buf[RECV_MAX_LEN];
 #ifdef IPL4_USE_SSL
   int ssl_err_msg = 0;
@@ -1059,12 +1163,12 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable(int fd)
     switch(perform_ssl_handshake(connId)) {
 
     case SUCCESS: //if success continue
-      sockList[it->second].sslState = STATE_NORMAL;
+      sockList[connId].sslState = STATE_NORMAL;
       break;
     case FAIL:
       IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable: SSL mapping failed for client socket: %d", connId);
       if (ConnDel(connId) == -1) IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable: unable to close socket");
-      sendError(PortError::ERROR__SOCKET, it->second);
+      sendError(PortError::ERROR__SOCKET, connId);
       sendConnClosed(connId, asp.remName(), asp.remPort(), asp.locName(), asp.locPort(), asp.proto(), asp.userData());
       return;
     case WANT_READ:
@@ -1148,6 +1252,12 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable(int fd)
           ((sockList[connId].dtlsSrtpProfiles != NULL) && (sockList[connId].sslState == STATE_NORMAL)))
       {
         asp.proto().udp() = UdpTuple(null_type());
+#ifdef LINUX
+        if ((sockList[connId].ssl_tls_type == NONE) && (udp_recv_batch_size > 1)) {
+          receive_udp_batch_on_fd(connId, asp);
+          break;
+        }
+#endif
         len = recvfrom(sockList[connId].sock, buf, RECV_MAX_LEN,
             0, (struct sockaddr *)&sa, &saLen);
         if ((len >= 0) && !SetNameAndPort(&sa, saLen, asp.remName(), asp.remPort()))
@@ -1232,7 +1342,22 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable(int fd)
         IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable: TCP recvfrom enter:");
 
         asp.proto().tcp() = TcpTuple(null_type());
-        len = recv(sockList[connId].sock, buf, RECV_MAX_LEN, 0);
+        // read until the socket is drained, but at most tcp_recv_batch_size times
+        // to let the other connections be served as well
+        for (int i = 0; i < tcp_recv_batch_size; i++) {
+          unsigned char* end_ptr;
+          size_t end_len = recv_buffer_size;
+          (*sockList[connId].buf)->get_end(end_ptr, end_len);
+          len = recv(sockList[connId].sock, end_ptr, end_len, 0);
+          if (len <= 0) break;
+          (*sockList[connId].buf)->increase_length(len);
+          received += len;
+          if ((size_t)len < end_len) break;
+        }
+        // a later recv() finding no more data or interrupted is not an error, the data read before is delivered
+        if ((received > 0) && ((len > 0) ||
+            ((len == -1) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)))))
+          len = received;
 
       }
 #ifdef IPL4_USE_SSL
@@ -1251,38 +1376,49 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable(int fd)
       }
 #endif
 
-      if (len > 0) {
-        // in normal case, this is where we put the incoming data in the buffer
-        // in SSL case, the receive_ssl_message_on_fd() already placed it there
-        if(sockList[connId].ssl_tls_type == NONE) {
-          (*sockList[connId].buf)->put_s(len, buf);
-        }
+      // errno of the last read, the delivery of the data read before a close or error may change it
+      int recv_errno = errno;
 
+      if ((len > 0) || (received > 0)) {
+        // in normal case, recv() has put the incoming data at the end of the buffer
+        // in SSL case, the receive_ssl_message_on_fd() already placed it there
+        // the messages are delivered from msgPos on, and cut from the buffer together at the end
+        size_t msgPos = 0;
         bool msgFound = false;
         do {
-          if (sockList[connId].getMsgLen != simpleGetMsgLen) {
+          const unsigned char* msgData = sockList[connId].buf[0]->get_data() + msgPos;
+          size_t availLen = sockList[connId].buf[0]->get_len() - msgPos;
+          if (sockList[connId].nativeGetMsgLen != NULL) {
+            // the native function reads the buffer in place
+            if (sockList[connId].msgLen == -1)
+              sockList[connId].msgLen = sockList[connId].nativeGetMsgLen(msgData, availLen, *sockList[connId].msgLenArgs);
+          } else if (sockList[connId].getMsgLen != simpleGetMsgLen) {
             if (sockList[connId].msgLen == -1){
               OCTETSTRING oct;
-              (*sockList[connId].buf)->get_string(oct);
+              if (msgPos == 0) (*sockList[connId].buf)->get_string(oct);
+              else oct = OCTETSTRING(availLen, msgData);
               sockList[connId].msgLen = sockList[connId].getMsgLen.invoke(oct,*sockList[connId].msgLenArgs);
             }
           } else {
-            sockList[connId].msgLen = (*sockList[connId].buf)->get_len();
+            sockList[connId].msgLen = availLen;
           }
-          msgFound = (sockList[connId].msgLen != -1) && (sockList[connId].msgLen <= (int)sockList[connId].buf[0]->get_len());
+          msgFound = (sockList[connId].msgLen != -1) && (sockList[connId].msgLen <= (int)availLen);
           if (msgFound) {
             IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable: message length: (%d/%d bytes)\n",
-                sockList[connId].msgLen, (int)sockList[connId].buf[0]->get_len());
-            asp.msg() = OCTETSTRING(sockList[connId].msgLen, sockList[connId].buf[0]->get_data());
-            sockList[connId].buf[0]->set_pos((size_t)sockList[connId].msgLen);
-            sockList[connId].buf[0]->cut();
+                sockList[connId].msgLen, (int)availLen);
+            asp.msg() = OCTETSTRING(sockList[connId].msgLen, msgData);
+            msgPos += sockList[connId].msgLen;
             if(lazy_conn_id_level && sockListCnt==1 && lonely_conn_id!=-1){
               asp.connId()=-1;
             }
             incoming_message(asp);
             sockList[connId].msgLen = -1;
           }
-        } while (msgFound && sockList[connId].buf[0]->get_len() != 0);
+        } while (msgFound && sockList[connId].buf[0]->get_len() != msgPos);
+        if (msgPos != 0) {
+          sockList[connId].buf[0]->set_pos(msgPos);
+          sockList[connId].buf[0]->cut();
+        }
         if (sockList[connId].buf[0]->get_len() != 0)
           IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable: incomplete message (%d bytes)\n",
               (int)sockList[connId].buf[0]->get_len());
@@ -1292,8 +1428,8 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable(int fd)
       // and automatically perform connection closing in case of socket error
       if (len == -1) {
         IPL4_DEBUG("IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable: %s recvfrom error: %s",
-            sockList[connId].ssl_tls_type == NONE ? "tcp" : "ssl", strerror(errno));
-        sendError(PortError::ERROR__SOCKET, connId, errno);
+            sockList[connId].ssl_tls_type == NONE ? "tcp" : "ssl", strerror(recv_errno));
+        sendError(PortError::ERROR__SOCKET, connId, recv_errno);
       } /* else if (len == -2) =>
           means that reading would block in SSL case.
           in this case I stop receiving message on the file descriptor, do nothing */
@@ -1663,6 +1799,45 @@ void IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable(int fd)
 } // IPL4asp__PT_PROVIDER::Handle_Fd_Event_Readable
 
 
+#ifdef LINUX
+// Reads up to udp_recv_batch_size datagrams with a single recvmmsg() and delivers each of them
+// as its own ASP_RecvFrom. asp is prefilled with the connection details.
+void IPL4asp__PT_PROVIDER::receive_udp_batch_on_fd(int connId, ASP__RecvFrom& asp)
+{
+  if (udpRecvBatch != NULL && udpRecvBatch->size != udp_recv_batch_size) {
+    delete udpRecvBatch;
+    udpRecvBatch = NULL;
+  }
+  if (udpRecvBatch == NULL)
+    udpRecvBatch = new UdpRecvBatch(udp_recv_batch_size);
+
+  struct mmsghdr *msgs = udpRecvBatch->msgs;
+  for (int i = 0; i < udpRecvBatch->size; i++)
+    msgs[i].msg_hdr.msg_namelen = sizeof(SockAddr);
+  int n = recvmmsg(sockList[connId].sock, msgs, udpRecvBatch->size, MSG_DONTWAIT, NULL);
+  if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+    IPL4_DEBUG("IPL4asp__PT_PROVIDER::receive_udp_batch_on_fd: no datagram to read");
+    return;
+  }
+  if (n == -1) {
+    IPL4_DEBUG("IPL4asp__PT_PROVIDER::receive_udp_batch_on_fd: udp recvmmsg error: %s",
+        strerror(errno));
+    sendError(PortError::ERROR__SOCKET, connId, errno);
+    return;
+  }
+  IPL4_DEBUG("IPL4asp__PT_PROVIDER::receive_udp_batch_on_fd: %d datagrams received", n);
+  for (int i = 0; i < n; i++) {
+    if (!SetNameAndPort(&udpRecvBatch->addrs[i], msgs[i].msg_hdr.msg_namelen, asp.remName(), asp.remPort()))
+      sendError(PortError::ERROR__HOSTNAME, connId);
+    if (msgs[i].msg_len > 0) {
+      asp.msg() = OCTETSTRING(msgs[i].msg_len, (const unsigned char*)udpRecvBatch->iovs[i].iov_base);
+      incoming_message(asp);
+    }
+  }
+} // IPL4asp__PT_PROVIDER::receive_udp_batch_on_fd
+#endif
+
+
 void IPL4asp__PT_PROVIDER::reportConnOpened(const int client_id) {
   ASP__Event event;
 
@@ -2241,6 +2416,158 @@ int IPL4asp__PT_PROVIDER::outgoing_send_core(const ASP__SendTo& asp,  Socket__AP
   return -1;
 } // IPL4asp__PT_PROVIDER::outgoing_send_core
 
+void IPL4asp__PT_PROVIDER::outgoing_send(const ASP__SendToBatch& asp)
+{
+  IPL4_DEBUG("IPL4asp__PT_PROVIDER::outgoing_send: ASP SendToBatch: enter");
+  testIfInitialized();
+  ro__Result results;
+  ro__integer sent_octets;
+  outgoing_send_core(asp, results, sent_octets);
+  for (int i = 0; i < results.size_of(); i++) {
+    if(results[i].errorCode().ispresent()){
+      ASP__Event event;
+      if(send_extended_result){
+        event.extended__result().errorCode() =results[i].errorCode();
+        event.extended__result().connId() =results[i].connId();
+        event.extended__result().os__error__code() =results[i].os__error__code();
+        event.extended__result().os__error__text() =results[i].os__error__text();
+        if (asp.get_selection() == ASP__SendToBatch::ALT_sendToList)
+          event.extended__result().msg() = asp.sendToList()[i].msg();
+        else
+          event.extended__result().msg() = asp.sendToMany().msgs()[i];
+      } else {
+        event.result()=results[i];
+      }
+      incoming_message(event);
+    }
+  }
+}
+
+// Returns the number of messages sent without error.
+int IPL4asp__PT_PROVIDER::outgoing_send_core(const ASP__SendToBatch& asp, ro__Result& results,
+    ro__integer& sent_octets)
+{
+  IPL4_DEBUG("IPL4asp__PT_PROVIDER::outgoing_send_core: ASP SendToBatch: enter");
+  testIfInitialized();
+  ASP__SendToList manyList;
+  if (asp.get_selection() == ASP__SendToBatch::ALT_sendToMany) {
+    const ASP__SendToMany& many = asp.sendToMany();
+    manyList.set_size(many.msgs().size_of());
+    for (int i = 0; i < many.msgs().size_of(); i++)
+      manyList[i] = ASP__SendTo(many.connId(), many.remName(), many.remPort(), many.proto(), many.msgs()[i]);
+  }
+  const ASP__SendToList& list = (asp.get_selection() == ASP__SendToBatch::ALT_sendToMany) ? manyList : asp.sendToList();
+  int n = list.size_of();
+  results.set_size(n);
+  sent_octets.set_size(n);
+
+  // resolved destinations, toLen is 0 if the name could not be resolved
+  std::map<std::pair<std::string, int>, SendToBatchEntry> destinations;
+  std::vector<SendToBatchEntry> entries;
+  for (int i = 0; i <= n; i++) {
+    int local_conn_id = -1;
+    bool batched = false;
+    if (i < n) {
+      results[i] = Result(OMIT_VALUE, OMIT_VALUE, OMIT_VALUE, OMIT_VALUE);
+      sent_octets[i] = -1;
+      local_conn_id = list[i].connId();
+      if(lazy_conn_id_level && local_conn_id==-1){
+        local_conn_id=lonely_conn_id;
+      }
+      ProtoTuple::union_selection_type proto = ProtoTuple::ALT_unspecified;
+      if (list[i].proto().ispresent())
+        proto = list[i].proto()().get_selection();
+      SockType type;
+      batched = getAndCheckSockType(local_conn_id, proto, type) && (type == IPL4asp_UDP) &&
+          ((sockList[local_conn_id].ssl_tls_type == NONE) || (proto == ProtoTuple::ALT_udp)) &&
+          (list[i].msg().lengthof() > 0);
+    }
+    // the collected datagrams are sent before a message going to another socket or sent alone
+    if (!entries.empty() && (!batched || (local_conn_id != entries[0].connId))) {
+      sendto_batch_flush(list, entries, results, sent_octets);
+      entries.clear();
+    }
+    if (i == n) break;
+    if (!batched) {
+      sent_octets[i] = outgoing_send_core(list[i], results[i]);
+      continue;
+    }
+    if (list[i].remPort() < 0 || list[i].remPort() > 65535){
+      setResult(results[i], PortError::ERROR__INVALID__INPUT__PARAMETER, list[i].connId());
+      continue;
+    }
+    std::pair<std::string, int> dest(std::string((const char*)list[i].remName(), list[i].remName().lengthof()),
+        (int)list[i].remPort());
+    std::map<std::pair<std::string, int>, SendToBatchEntry>::iterator it = destinations.find(dest);
+    if (it == destinations.end()) {
+      SendToBatchEntry resolved;
+      if (SetSockAddr(list[i].remName(), list[i].remPort(), resolved.to, resolved.toLen) == -1)
+        resolved.toLen = 0;
+      it = destinations.insert(std::make_pair(dest, resolved)).first;
+    }
+    if (it->second.toLen == 0) {
+      setResult(results[i], PortError::ERROR__HOSTNAME, list[i].connId());
+      continue;
+    }
+    entries.push_back(it->second);
+    entries.back().idx = i;
+    entries.back().connId = local_conn_id;
+  }
+
+  int sent = 0;
+  for (int i = 0; i < n; i++) {
+    if (!results[i].errorCode().ispresent())
+      sent++;
+  }
+  IPL4_DEBUG("IPL4asp__PT_PROVIDER::outgoing_send_core: ASP SendToBatch: %d of %d messages sent", sent, n);
+  return sent;
+} // IPL4asp__PT_PROVIDER::outgoing_send_core
+
+// Sends the datagrams of entries, all on the same UDP connection. On Linux sendmmsg() sends them
+// together; a datagram it fails on is sent alone by sendNonBlocking to get its Result.
+void IPL4asp__PT_PROVIDER::sendto_batch_flush(const ASP__SendToList& list, std::vector<SendToBatchEntry>& entries,
+    ro__Result& results, ro__integer& sent_octets)
+{
+#ifdef LINUX
+  std::vector<struct mmsghdr> hdrs(entries.size());
+  std::vector<struct iovec> iovs(entries.size());
+  for (size_t j = 0; j < entries.size(); j++) {
+    const OCTETSTRING& msg = list[entries[j].idx].msg();
+    iovs[j].iov_base = (void *)(const unsigned char *)msg;
+    iovs[j].iov_len = msg.lengthof();
+    memset(&hdrs[j], 0, sizeof(struct mmsghdr));
+    hdrs[j].msg_hdr.msg_name = &entries[j].to;
+    hdrs[j].msg_hdr.msg_namelen = entries[j].toLen;
+    hdrs[j].msg_hdr.msg_iov = &iovs[j];
+    hdrs[j].msg_hdr.msg_iovlen = 1;
+  }
+#endif
+  size_t k = 0;
+  while (k < entries.size()) {
+#ifdef LINUX
+    int sock = sockList[entries[k].connId].sock;
+    if (sock >= 0) {
+      int ret = sendmmsg(sock, &hdrs[k], entries.size() - k, 0);
+      IPL4_DEBUG("IPL4asp__PT_PROVIDER::sendto_batch_flush: sendmmsg of %d datagrams: %d",
+          (int)(entries.size() - k), ret);
+      if (ret > 0) {
+        for (int j = 0; j < ret; j++, k++)
+          sent_octets[entries[k].idx] = (int)hdrs[k].msg_len;
+        continue;
+      }
+    }
+#endif
+    const ASP__SendTo& asp = list[entries[k].idx];
+    if (asp.proto().ispresent())
+      sent_octets[entries[k].idx] = sendNonBlocking(entries[k].connId, (sockaddr *)&entries[k].to, entries[k].toLen,
+          IPL4asp_UDP, asp.msg(), results[entries[k].idx], asp.proto());
+    else
+      sent_octets[entries[k].idx] = sendNonBlocking(entries[k].connId, (sockaddr *)&entries[k].to, entries[k].toLen,
+          IPL4asp_UDP, asp.msg(), results[entries[k].idx]);
+    k++;
+  }
+} // IPL4asp__PT_PROVIDER::sendto_batch_flush
+
 
 
 int IPL4asp__PT_PROVIDER::sendNonBlocking(const ConnectionId& connId, sockaddr *sa,
@@ -3401,6 +3728,7 @@ int IPL4asp__PT_PROVIDER::ConnAdd(SockType type, int sock, SSL_TLS_Type ssl_tls_
   if (parentIdx != -1) { // inherit the listener's properties
     sockList[i].userData = sockList[parentIdx].userData;
     sockList[i].getMsgLen = sockList[parentIdx].getMsgLen;
+    sockList[i].nativeGetMsgLen = sockList[parentIdx].nativeGetMsgLen;
     sockList[i].getMsgLen_forConnClosedEvent = sockList[parentIdx].getMsgLen_forConnClosedEvent;
     sockList[i].parentIdx = parentIdx;
     sockList[i].msgLenArgs =
@@ -3460,6 +3788,7 @@ int IPL4asp__PT_PROVIDER::ConnAdd(SockType type, int sock, SSL_TLS_Type ssl_tls_
   } else { // otherwise initialize to defaults
     sockList[i].userData = 0;
     sockList[i].getMsgLen = defaultGetMsgLen;
+    sockList[i].nativeGetMsgLen = defaultNativeGetMsgLen;
     sockList[i].getMsgLen_forConnClosedEvent = defaultGetMsgLen_forConnClosedEvent;
     sockList[i].parentIdx = -1;
     sockList[i].msgLenArgs = new ro__integer(*defaultMsgLenArgs);
@@ -3487,7 +3816,9 @@ int IPL4asp__PT_PROVIDER::ConnAdd(SockType type, int sock, SSL_TLS_Type ssl_tls_
 
   sockList[i].msgLen = -1;
 
-  fd2IndexMap[sock] = i;
+  if ((unsigned int)sock >= fd2IndexTable.size())
+    fd2IndexTable.resize(sock + 1, -1);
+  fd2IndexTable[sock] = i;
   sockList[i].type = type;
   sockList[i].ssl_tls_type = ssl_tls_type;
   sockList[i].localaddr=new CHARSTRING("");
@@ -3590,6 +3921,7 @@ void SockDesc::clear()
   Free(assocIdList); assocIdList = 0;
   delete msgLenArgs; msgLenArgs = 0;
   delete msgLenArgs_forConnClosedEvent; msgLenArgs_forConnClosedEvent = 0;
+  nativeGetMsgLen = NULL;
   delete localaddr; localaddr = 0;
   delete localport; localport = 0;
   delete remoteaddr; remoteaddr = 0;
@@ -3627,7 +3959,8 @@ int IPL4asp__PT_PROVIDER::ConnDel(int connId)
         " %d: %s, connId: %d", sock, strerror(errno), connId);
   }
 
-  fd2IndexMap.erase(sockList[connId].sock);
+  if ((unsigned int)sockList[connId].sock < fd2IndexTable.size())
+    fd2IndexTable[sockList[connId].sock] = -1;
 
   sockList[connId].clear();
   sockList[lastFreeSock].nextFree = connId;
@@ -4330,6 +4663,7 @@ void f__IPL4__PROVIDER__setGetMsgLen(IPL4asp__PT_PROVIDER& portRef,
   portRef.testIfInitialized();
   if ((int)connId == -1) {
     portRef.defaultGetMsgLen = f;
+    portRef.defaultNativeGetMsgLen = findNativeGetMsgLen(f);
     delete portRef.defaultMsgLenArgs;
     portRef.defaultMsgLenArgs = new Socket__API__Definitions::ro__integer(msgLenArgs);
     IPL4_PORTREF_DEBUG(portRef, "f__IPL4__PROVIDER__setGetMsgLen: "
@@ -4343,11 +4677,37 @@ void f__IPL4__PROVIDER__setGetMsgLen(IPL4asp__PT_PROVIDER& portRef,
     IPL4_PORTREF_DEBUG(portRef, "f__IPL4__PROVIDER__setGetMsgLen: "
         "getMsgLen fn for connection %d is modified", (int)connId);
     portRef.sockList[(int)connId].getMsgLen = f;
+    portRef.sockList[(int)connId].nativeGetMsgLen = findNativeGetMsgLen(f);
     delete portRef.sockList[(int)connId].msgLenArgs;
     portRef.sockList[(int)connId].msgLenArgs = new Socket__API__Definitions::ro__integer(msgLenArgs);
   }
 } // f__IPL4__PROVIDER__setGetMsgLen
 
+void f__IPL4__PROVIDER__setNativeGetMsgLen(IPL4asp__PT_PROVIDER& portRef,
+    const ConnectionId& connId, NativeGetMsgLen f,
+    const ro__integer& msgLenArgs)
+{
+  portRef.testIfInitialized();
+  if ((int)connId == -1) {
+    portRef.defaultNativeGetMsgLen = f;
+    delete portRef.defaultMsgLenArgs;
+    portRef.defaultMsgLenArgs = new Socket__API__Definitions::ro__integer(msgLenArgs);
+    IPL4_PORTREF_DEBUG(portRef, "f__IPL4__PROVIDER__setNativeGetMsgLen: "
+        "The default native getMsgLen fn is modified");
+  } else {
+    if (!portRef.isConnIdValid(connId)) {
+      IPL4_PORTREF_DEBUG(portRef, "IPL4asp__PT_PROVIDER::f__IPL4__PROVIDER__setNativeGetMsgLen: "
+          "invalid connId: %i", (int)connId);
+      return;
+    }
+    IPL4_PORTREF_DEBUG(portRef, "f__IPL4__PROVIDER__setNativeGetMsgLen: "
+        "native getMsgLen fn for connection %d is modified", (int)connId);
+    portRef.sockList[(int)connId].nativeGetMsgLen = f;
+    delete portRef.sockList[(int)connId].msgLenArgs;
+    portRef.sockList[(int)connId].msgLenArgs = new Socket__API__Definitions::ro__integer(msgLenArgs);
+  }
+} // f__IPL4__PROVIDER__setNativeGetMsgLen
+
 
 void f__IPL4__PROVIDER__setGetMsgLen__forConnClosedEvent(IPL4asp__PT_PROVIDER& portRef,
     const ConnectionId& connId, f__IPL4__getMsgLen& f,
@@ -5738,6 +6098,22 @@ Result f__IPL4__sendto(
   return result;
 }
 
+ro__Result f__IPL4__sendtoBatch(
+    IPL4asp__PT& portRef,
+    const ASP__SendToBatch& asp,
+    ro__integer& sent__octets)
+{
+  if(TTCN_Logger::log_this_event(TTCN_PORTEVENT)){
+    TTCN_Logger::begin_event(TTCN_PORTEVENT);
+    TTCN_Logger::log_event("%s: f_IPL4_sendtoBatch: ", portRef.get_name());
+    asp.log();
+    TTCN_Logger::end_event();
+  }
+  ro__Result results;
+  portRef.outgoing_send_core(asp,results,sent__octets);
+  return results;
+}
+
 Result f__IPL4__StartTLS(
     IPL4asp__PT& portRef,
     const ConnectionId& connId,
@@ -5815,12 +6191,12 @@ CHARSTRING f__IPL4__getSelectedSrtpProfile(
   return portRef.getSelectedSrtpProfile(connId);
 }
 
-INTEGER f__IPL4__fixedMsgLen(const OCTETSTRING& stream, ro__integer& msgLenArgs){
+int fixedMsgLen(const unsigned char* data, size_t len, ro__integer& msgLenArgs){
 
   int length_offset=(int)msgLenArgs[0];
   int nr_bytes_in_length=(int)msgLenArgs[1];
 
-  int stream_length=stream.lengthof();
+  int stream_length=(int)len;
 
   if(stream_length<(length_offset+nr_bytes_in_length)){ 
     return -1;  // not enough bytes
@@ -5842,7 +6218,7 @@ INTEGER f__IPL4__fixedMsgLen(const OCTETSTRING& stream, ro__integer& msgLenArgs)
 
   unsigned long m_length = 0;
 
-  const unsigned char* buff=(const unsigned char* )stream + length_offset;
+  const unsigned char* buff=data + length_offset;
   for (int i = 0; i < nr_bytes_in_length; i++) {
     m_length |= buff[i] << (8 * shift_count);
     shift_count+=shift_diff;
@@ -5853,6 +6229,10 @@ INTEGER f__IPL4__fixedMsgLen(const OCTETSTRING& stream, ro__integer& msgLenArgs)
 
 }
 
+INTEGER f__IPL4__fixedMsgLen(const OCTETSTRING& stream, ro__integer& msgLenArgs){
+  return fixedMsgLen((const unsigned char*)stream, stream.lengthof(), msgLenArgs);
+}
+
 //************
 //SSL
 //************
@@ -7604,6 +7984,7 @@ int IPL4asp__PT_PROVIDER::ConnAddEin(SockType type,
   if (parentIdx != -1) { // inherit the listener's properties
     sockList[i].userData = sockList[parentIdx].userData;
     sockList[i].getMsgLen = sockList[parentIdx].getMsgLen;
+    sockList[i].nativeGetMsgLen = sockList[parentIdx].nativeGetMsgLen;
     sockList[i].getMsgLen_forConnClosedEvent = sockList[parentIdx].getMsgLen_forConnClosedEvent;
     sockList[i].parentIdx = parentIdx;
     sockList[parentIdx].ref_count++;
@@ -7612,6 +7993,7 @@ int IPL4asp__PT_PROVIDER::ConnAddEin(SockType type,
   } else { // otherwise initialize to defaults
     sockList[i].userData = 0;
     sockList[i].getMsgLen = defaultGetMsgLen;
+    sockList[i].nativeGetMsgLen = defaultNativeGetMsgLen;
     sockList[i].getMsgLen_forConnClosedEvent = defaultGetMsgLen_forConnClosedEvent;
     sockList[i].parentIdx = -1;
     sockList[i].msgLenArgs = new ro__integer(*defaultMsgLenArgs);
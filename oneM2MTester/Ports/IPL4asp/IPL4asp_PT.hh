@@ -110,6 +110,7 @@
 
 
 #include <map>
+#include <vector>
 #include <TTCN3.hh>
 #include "IPL4asp_Types.hh"
 #include "Socket_API_Definitions.hh"
@@ -199,6 +200,28 @@ typedef union {
 #endif
 } SockAddr;
 
+// Native counterpart of Socket_API_Definitions.f_getMsgLen, called on the receive buffer of a TCP
+// connection without copying it into an octetstring. Returns the length of the first message of
+// data, or -1 if more data is needed. args is the msgLenArgs of the connection, it can hold state.
+typedef int (*NativeGetMsgLen)(const unsigned char* data, size_t len, Socket__API__Definitions::ro__integer& args);
+
+// Makes f_IPL4_setGetMsgLen install native_f instead of the TTCN-3 function f. To be called by the
+// modules providing a message length calculator, see NativeGetMsgLenRegistrar.
+void registerNativeGetMsgLen(Socket__API__Definitions::f__getMsgLen::function_pointer f, NativeGetMsgLen native_f);
+
+struct NativeGetMsgLenRegistrar {
+  NativeGetMsgLenRegistrar(Socket__API__Definitions::f__getMsgLen::function_pointer f, NativeGetMsgLen native_f)
+  {
+    registerNativeGetMsgLen(f, native_f);
+  }
+};
+
+// Buffers of the datagrams read from a UDP socket by one recvmmsg() call, see udp_recv_batch_size.
+struct UdpRecvBatch;
+
+// A datagram of an ASP_SendToBatch waiting to be sent, with its resolved destination.
+struct SendToBatchEntry;
+
 typedef struct {
   enum { SOCK_NONEX = -1, SOCK_CLOSED = -2, SOCK_NOT_KNOWN = -3 };
   enum { ACTION_NONE = 0, ACTION_BIND = 1, ACTION_CONNECT = 2 , ACTION_DELETE = 3};
@@ -213,6 +236,7 @@ typedef struct {
   Socket__API__Definitions::f__getMsgLen getMsgLen_forConnClosedEvent;
   Socket__API__Definitions::ro__integer *msgLenArgs;
   Socket__API__Definitions::ro__integer *msgLenArgs_forConnClosedEvent;
+  NativeGetMsgLen nativeGetMsgLen; // NULL or used instead of getMsgLen
   int msgLen; // -1 or the message length returned by getMsgLen
   int nextFree; // -1 or index of next free element
   int parentIdx; // parent index (-1 if no)
@@ -383,6 +407,8 @@ public:
   void debug(const char *fmt, ...) __attribute__ ((__format__ (__printf__, 2, 3)));
   int outgoing_send_core(const IPL4asp__Types::ASP__Send& asp, Socket__API__Definitions::Result& result);
   int outgoing_send_core(const IPL4asp__Types::ASP__SendTo& asp, Socket__API__Definitions::Result& result);
+  int outgoing_send_core(const IPL4asp__Types::ASP__SendToBatch& asp, IPL4asp__Types::ro__Result& results,
+      Socket__API__Definitions::ro__integer& sent_octets);
   void starttls(const IPL4asp__Types::ConnectionId& connId, const BOOLEAN& server_side, Socket__API__Definitions::Result& result);
   void stoptls(const IPL4asp__Types::ConnectionId& connId, Socket__API__Definitions::Result& result);
   OCTETSTRING exportTlsKey(const IPL4asp__Types::ConnectionId& connId, const CHARSTRING& label, const OCTETSTRING& context, const INTEGER& keyLen);
@@ -408,6 +434,7 @@ protected:
 
   void outgoing_send(const IPL4asp__Types::ASP__Send& asp);
   void outgoing_send(const IPL4asp__Types::ASP__SendTo& asp);
+  void outgoing_send(const IPL4asp__Types::ASP__SendToBatch& asp);
 
   virtual void incoming_message(const IPL4asp__Types::ASP__Event& incoming_par) = 0;
   virtual void incoming_message(const IPL4asp__Types::ASP__RecvFrom& incoming_par) = 0;
@@ -518,6 +545,9 @@ private:
   void handle_event(int fd, int connId, const void *buf);
   int getmsg(int fd, int connId, struct msghdr *msg,void *buf, size_t *buflen, ssize_t *nrp, size_t cmsglen);
   int getmsg(int fd, int connId, ssize_t *nrp, int *ssl_err_msg);
+#ifdef LINUX
+  void receive_udp_batch_on_fd(int connId, IPL4asp__Types::ASP__RecvFrom& asp);
+#endif
   int ConnAdd(SockType type, int sock, SSL_TLS_Type ssl_tls_type,const IPL4asp__Types::OptionList  *options=NULL, int parentIdx = -1);
   int ConnDel(int connId);
   int setUserData(int id, int userData);
@@ -539,6 +569,8 @@ private:
       const Socket__API__Definitions::PortNumber& localport,
       const Socket__API__Definitions::ProtoTuple& proto,
       const int& userData);
+  void sendto_batch_flush(const IPL4asp__Types::ASP__SendToList& list, std::vector<SendToBatchEntry>& entries,
+      IPL4asp__Types::ro__Result& results, Socket__API__Definitions::ro__integer& sent_octets);
   int sendNonBlocking(const Socket__API__Definitions::ConnectionId& id, sockaddr *sa,
       socklen_t saLen, SockType type, const OCTETSTRING& msg, Socket__API__Definitions::Result& result, const Socket__API__Definitions::ProtoTuple& protoTuple = (const Socket__API__Definitions::ProtoTuple&)Socket__API__Definitions::ProtoTuple().unspecified());
   bool getAndCheckSockType(int connId,
@@ -556,9 +588,14 @@ private:
   bool send_extended_result;
   int poll_timeout;
   int max_num_of_poll;
+  int recv_buffer_size; // bytes read from a TCP connection at once, into the end of its buffer
+  int tcp_recv_batch_size; // max number of recv() calls on a TCP connection per readable event
+  int udp_recv_batch_size; // max number of datagrams read from a UDP socket per readable event
+  UdpRecvBatch *udpRecvBatch; // NULL until the first batched UDP read
   GlobalConnOpts globalConnOpts;
   Socket__API__Definitions::f__getMsgLen defaultGetMsgLen;
   Socket__API__Definitions::f__getMsgLen defaultGetMsgLen_forConnClosedEvent;
+  NativeGetMsgLen defaultNativeGetMsgLen;
   Socket__API__Definitions::ro__integer *defaultMsgLenArgs;
   Socket__API__Definitions::ro__integer *defaultMsgLenArgs_forConnClosedEvent;
 
@@ -750,7 +787,11 @@ public:
 
 #endif
 
-  std::map<int,int> fd2IndexMap;
+  // connId of each file descriptor, indexed by the fd, -1 if the fd is not a connection
+  std::vector<int> fd2IndexTable;
+  inline int fd2Index(int fd) const {
+    return ((unsigned int)fd < fd2IndexTable.size()) ? fd2IndexTable[fd] : -1;
+  }
 
   bool mapped;
   bool debugAllowed;
@@ -764,6 +805,12 @@ public:
       Socket__API__Definitions::f__getMsgLen& f,
       const Socket__API__Definitions::ro__integer& msgLenArgs);
 
+  friend void f__IPL4__PROVIDER__setNativeGetMsgLen(
+      IPL4asp__PT_PROVIDER& portRef,
+      const Socket__API__Definitions::ConnectionId& connId,
+      NativeGetMsgLen f,
+      const Socket__API__Definitions::ro__integer& msgLenArgs);
+
   friend void f__IPL4__PROVIDER__setGetMsgLen__forConnClosedEvent(
       IPL4asp__PT_PROVIDER& portRef,
       const Socket__API__Definitions::ConnectionId& connId,
@@ -950,5 +997,14 @@ int SetLocalSockAddr(const char* debug_str, IPL4asp__PT_PROVIDER& portRef,
     int def_addr_family,
     const char *locName, int locPort,
     SockAddr& sockAddr, socklen_t& sockAddrLen);
+
+// Like f__IPL4__PROVIDER__setGetMsgLen, but installs a native message length calculator. NULL
+// switches back to the TTCN-3 function set by f__IPL4__PROVIDER__setGetMsgLen.
+void f__IPL4__PROVIDER__setNativeGetMsgLen(IPL4asp__PT_PROVIDER& portRef,
+    const Socket__API__Definitions::ConnectionId& connId, NativeGetMsgLen f,
+    const Socket__API__Definitions::ro__integer& msgLenArgs);
+
+// Native version of f_IPL4_fixedMsgLen
+int fixedMsgLen(const unsigned char* data, size_t len, Socket__API__Definitions::ro__integer& msgLenArgs);
 } /*end of namespace*/
 #endif
@@ -0,0 +1,199 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               IPL4asp_fdTableBench.cc
+//  Description:        Stress benchmark of the fd -> connId lookup of the IPL4 test port
+//  Rev:                R2I
+//
+//  Stand-alone program, not part of the test suite build (oneM2MTester.tpd).
+//  It opens N concurrent loopback TCP connections, makes all of them readable,
+//  looks each of them up 10 times as Handle_Fd_Event_Readable does, then closes
+//  them, for the given number of rounds. The accepted ends are bookkept both in a
+//  std::map<int,int> (the former fd2IndexMap) and in an fd-indexed table with -1
+//  for unused fds (fd2IndexTable of IPL4asp__PT_PROVIDER). The connecting ends
+//  live in a child process, so the measured process only holds N + 1 fds.
+//
+//  Build and run (Linux):
+//    g++ -O2 -o IPL4asp_fdTableBench IPL4asp_fdTableBench.cc
+//    ./IPL4asp_fdTableBench [connections (10000)] [rounds (3)]
+//  The open file limit (ulimit -n) must be above the number of connections.
+//  The insert and erase times include the overhead of clock_gettime().
+
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <map>
+#include <vector>
+
+static double now()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// the former fd2IndexMap
+struct MapTable {
+  std::map<int,int> fd2IndexMap;
+  void add(int fd, int connId) { fd2IndexMap[fd] = connId; }
+  void del(int fd) { fd2IndexMap.erase(fd); }
+  int get(int fd) const {
+    std::map<int,int>::const_iterator it = fd2IndexMap.find(fd);
+    return it == fd2IndexMap.end() ? -1 : it->second;
+  }
+};
+
+// fd2IndexTable, as in ConnAdd, ConnDel and fd2Index
+struct VectorTable {
+  std::vector<int> fd2IndexTable;
+  void add(int fd, int connId) {
+    if ((unsigned int)fd >= fd2IndexTable.size())
+      fd2IndexTable.resize(fd + 1, -1);
+    fd2IndexTable[fd] = connId;
+  }
+  void del(int fd) {
+    if ((unsigned int)fd < fd2IndexTable.size())
+      fd2IndexTable[fd] = -1;
+  }
+  int get(int fd) const {
+    return ((unsigned int)fd < fd2IndexTable.size()) ? fd2IndexTable[fd] : -1;
+  }
+};
+
+// one byte handshakes between the two processes
+static void sync_wait(int fd)
+{
+  char c;
+  if (read(fd, &c, 1) != 1) { perror("read"); exit(1); }
+}
+
+static void sync_post(int fd)
+{
+  if (write(fd, "s", 1) != 1) { perror("write"); exit(1); }
+}
+
+template<class Table>
+static void run(const char *name, int conns, int rounds)
+{
+  Table table;
+  double tAdd = 0, tGet = 0, tDel = 0;
+  long events = 0, check = 0;
+
+  int listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  int one = 1;
+  setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addrLen = sizeof(addr);
+  if (bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) == -1 ||
+      getsockname(listenFd, (struct sockaddr *)&addr, &addrLen) == -1 ||
+      listen(listenFd, SOMAXCONN) == -1) {
+    perror("listen");
+    exit(1);
+  }
+  int up[2], down[2];
+  if (pipe(up) == -1 || pipe(down) == -1) { perror("pipe"); exit(1); }
+
+  pid_t pid = fork();
+  if (pid == 0) { // the connecting ends
+    std::vector<int> fds(conns);
+    for (int r = 0; r < rounds; r++) {
+      for (int i = 0; i < conns; i++) {
+        fds[i] = socket(AF_INET, SOCK_STREAM, 0);
+        if (fds[i] == -1 || connect(fds[i], (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+          perror("connect");
+          _exit(1);
+        }
+        // keep the accept queue short
+        if (i % 100 == 99) { sync_post(up[1]); sync_wait(down[0]); }
+      }
+      for (int i = 0; i < conns; i++)
+        if (write(fds[i], "x", 1) != 1) { perror("write"); _exit(1); }
+      sync_post(up[1]); sync_wait(down[0]);
+      for (int i = 0; i < conns; i++)
+        close(fds[i]);
+      sync_post(up[1]); sync_wait(down[0]);
+    }
+    _exit(0);
+  }
+
+  std::vector<int> fds(conns);
+  double start = now();
+  for (int r = 0; r < rounds; r++) {
+    for (int i = 0; i < conns; i++) {
+      fds[i] = accept(listenFd, NULL, NULL);
+      if (fds[i] == -1) { perror("accept"); exit(1); }
+      fcntl(fds[i], F_SETFL, O_NONBLOCK);
+      double t = now();
+      table.add(fds[i], i + 1);
+      tAdd += now() - t;
+      if (i % 100 == 99) { sync_wait(up[0]); sync_post(down[1]); }
+    }
+    sync_wait(up[0]); // every connection is readable now
+    for (int pass = 0; pass < 10; pass++) {
+      double t = now();
+      for (int i = 0; i < conns; i++)
+        check += table.get(fds[i]);
+      tGet += now() - t;
+      events += conns;
+    }
+    sync_post(down[1]); sync_wait(up[0]);
+    for (int i = 0; i < conns; i++) {
+      close(fds[i]);
+      double t = now();
+      table.del(fds[i]);
+      tDel += now() - t;
+    }
+    sync_post(down[1]);
+  }
+  waitpid(pid, NULL, 0);
+  close(listenFd);
+  close(up[0]); close(up[1]); close(down[0]); close(down[1]);
+
+  long ops = (long)conns * rounds;
+  printf("%-6s connections: %d, rounds: %d  insert %6.1f ns  lookup %6.1f ns/event  erase %6.1f ns"
+      "  (%.2f s, check %ld)\n", name, conns, rounds, tAdd / ops * 1e9, tGet / events * 1e9,
+      tDel / ops * 1e9, now() - start, check);
+}
+
+int main(int argc, char **argv)
+{
+  int conns = argc > 1 ? atoi(argv[1]) : 10000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 3;
+  if (conns <= 0 || rounds <= 0) {
+    fprintf(stderr, "usage: %s [connections] [rounds]\n", argv[0]);
+    return 1;
+  }
+  struct rlimit rl;
+  if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < (rlim_t)conns + 16) {
+    rl.rlim_cur = (rl.rlim_max == RLIM_INFINITY || rl.rlim_max >= (rlim_t)conns + 16) ? (rlim_t)conns + 16 : rl.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &rl);
+  }
+
+  run<MapTable>("map", conns, rounds);
+  run<VectorTable>("vector", conns, rounds);
+  run<MapTable>("map", conns, rounds);
+  run<VectorTable>("vector", conns, rounds);
+  return 0;
+}
@@ -0,0 +1,78 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               CoAP_Size.cc
+//  Description:        Message length calculator of CoAP over TCP for the IPL4 test port
+//  Rev:                R2I
+
+#include "CoAP_IPL4SizeFunction.hh"
+#include "IPL4asp_PT.hh"
+
+#include <limits.h>
+
+namespace CoAP__IPL4SizeFunction {
+
+// Native message length calculator of the IPL4 test port, f__CoAP__TCP__getMsgLen without the octetstring
+static int CoAP_TCP_getMsgLen(const unsigned char* data, size_t len, Socket__API__Definitions::ro__integer& /*args*/)
+{
+  if(len == 0) return -1;
+
+  // Len (4 bits) | TKL (4 bits), extended length, Code, Token, Options and Payload
+  unsigned int length_nibble = data[0] >> 4;
+  unsigned int token_length = data[0] & 0x0F;
+  size_t extended_length_size;
+  unsigned long long length;
+
+  if(token_length > 8) return (int)(len > INT_MAX ? INT_MAX : len); // reserved, message format error
+
+  switch(length_nibble)
+  {
+    case 13: extended_length_size = 1; break;
+    case 14: extended_length_size = 2; break;
+    case 15: extended_length_size = 4; break;
+    default: extended_length_size = 0;
+  }
+  if(len < 1 + extended_length_size) return -1;
+
+  const unsigned char* extended_length = data + 1;
+  switch(length_nibble)
+  {
+    case 13:
+      length = extended_length[0] + 13ULL;
+      break;
+    case 14:
+      length = ((extended_length[0] << 8) | extended_length[1]) + 269ULL;
+      break;
+    case 15:
+      length = (((unsigned long long)extended_length[0] << 24) | (extended_length[1] << 16) |
+        (extended_length[2] << 8) | extended_length[3]) + 65805ULL;
+      break;
+    default:
+      length = length_nibble;
+  }
+
+  unsigned long long msg_len = 1 + extended_length_size + 1 + token_length + length;
+  if(msg_len > INT_MAX) return (int)(len > INT_MAX ? INT_MAX : len); // cannot be delivered as one message
+  return (int)msg_len;
+}
+
+INTEGER f__CoAP__TCP__getMsgLen(const OCTETSTRING& stream, Socket__API__Definitions::ro__integer& args)
+{
+  return CoAP_TCP_getMsgLen((const unsigned char*)stream, stream.lengthof(), args);
+}
+
+// f_IPL4_setGetMsgLen installs CoAP_TCP_getMsgLen instead of f_CoAP_TCP_getMsgLen
+static IPL4asp__PortType::NativeGetMsgLenRegistrar native_getMsgLen_registrar(f__CoAP__TCP__getMsgLen, CoAP_TCP_getMsgLen);
+
+}
@@ -21,6 +21,11 @@
 #include "HTTPmsg_PT.hh"
 #include "HTTPmsg_Types.hh"
 #include "HTTPmsg_MessageLen.hh"
+#include "IPL4asp_PT.hh"
+
+#include <ctype.h>
+#include <limits.h>
+#include <string.h>
 
 using namespace HTTPmsg__Types;
 using namespace HTTPmsg__PortType;
@@ -28,22 +33,376 @@ using namespace HTTPmsg__PortType;
 namespace HTTPmsg__MessageLen {
 INTEGER f__HTTPMessage__len(OCTETSTRING const& stream) {
    HTTPMessage msg;
-   TTCN_Buffer *buf_p = new TTCN_Buffer() ;
-   buf_p->put_os(stream);
-
-   int buf_len = buf_p->get_read_len();
+   int buf_len = stream.lengthof();
    if( buf_len > 0)
    {
-       if(f_HTTP_decodeCommon(buf_p, msg, true, false, NULL, NULL))
+       HTTP_Read_Cursor cursor((const unsigned char*)stream, buf_len);
+       if(HTTP_decode_message(cursor, msg, true, false, NULL, NULL))
        {
-         buf_len -= buf_p->get_read_len();
+         buf_len = cursor.pos;
        }
        else
          buf_len = -1;
 
 
    } else buf_len = -1;
-   delete buf_p;
    return buf_len;
 }
+
+// Elements of the args of f__HTTPMessage__getMsgLen, holding the scanner state between the calls
+enum {
+  FRAME_STATE_PHASE,
+  FRAME_STATE_OFFSET,         // first byte of the stream that has not been processed yet
+  FRAME_STATE_CONTENT_LENGTH, // -1 until a Content-Length header is found, clamped to the int range
+  FRAME_STATE_FLAGS,
+  FRAME_STATE_SIZE
+};
+
+enum {
+  PHASE_START_LINE,
+  PHASE_HEADERS,
+  PHASE_CHUNK_SIZE,
+  PHASE_CHUNK_DATA,    // the offset is the end of the chunk data
+  PHASE_CHUNK_TRAILER, // the line after the last chunk
+  PHASE_UNTIL_CLOSE    // the announced length does not fit into a message, it is never complete
+};
+
+#define FRAME_FLAG_RESPONSE        0x01
+#define FRAME_FLAG_NO_BODY_STATUS  0x02 // 1xx, 204 or 304 status code
+#define FRAME_FLAG_LENGTH_RECEIVED 0x04
+#define FRAME_FLAG_CHUNKED         0x08
+
+static void frame_reset(Socket__API__Definitions::ro__integer& args)
+{
+  args.set_size(FRAME_STATE_SIZE);
+  args[FRAME_STATE_PHASE] = PHASE_START_LINE;
+  args[FRAME_STATE_OFFSET] = 0;
+  args[FRAME_STATE_CONTENT_LENGTH] = -1;
+  args[FRAME_STATE_FLAGS] = 0;
+}
+
+// Finds the end of the line starting at pos like HTTP_find_line() does. FALSE is returned not only if the
+// line is incomplete, but also while the byte deciding about a folded header line is still missing.
+static int frame_line(const unsigned char* data, int len, int pos, bool concatenate_header_lines,
+    int& line_end, int& next)
+{
+  int i = pos;
+
+  while(1)
+  {
+    for( ; i < len && data[i] != '\0' && data[i] != '\r' && data[i] != '\n'; i++);
+
+    if(i >= len)
+      return FALSE;
+
+    if(data[i] == '\n')
+    {
+      if(HTTPmsg__Types::crlf__mode == HTTPmsg__Types::strict__crlf__mode::ERROR_)
+        return BUFFER_FAIL;
+      if(i > pos && concatenate_header_lines)
+      {
+        if(i + 1 >= len)
+          return FALSE;
+        if(data[i + 1] == ' ' || data[i + 1] == '\t')
+        {
+          i += 1;
+          continue;
+        }
+      }
+      line_end = i;
+      next = i + 1;
+    }
+    else
+    {
+      if(i + 1 >= len)
+        return FALSE;
+      if(data[i + 1] != '\n')
+        return BUFFER_FAIL;
+      if(i > pos && concatenate_header_lines)
+      {
+        if(i + 2 >= len)
+          return FALSE;
+        if(data[i + 2] == ' ' || data[i + 2] == '\t')
+        {
+          i += 2;
+          continue;
+        }
+      }
+      line_end = i;
+      next = i + 2;
+    }
+    return line_end == pos ? BUFFER_CRLF : TRUE;
+  }
+}
+
+// Reads a number like the %d (base 10) and %x (base 16) conversions of sscanf, returns false if there is none
+static bool frame_number(const unsigned char*& p, const unsigned char* end, unsigned long base,
+    unsigned long& magnitude, bool& negative)
+{
+  while(p < end && isspace(*p))
+    p++;
+
+  negative = false;
+  if(p < end && (*p == '+' || *p == '-'))
+  {
+    negative = *p == '-';
+    p++;
+  }
+  if(base == 16 && end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X') && isxdigit(p[2]))
+    p += 2;
+
+  const unsigned char* digits = p;
+  magnitude = 0;
+  for( ; p < end && (base == 16 ? isxdigit(*p) : isdigit(*p)); p++)
+  {
+    unsigned long digit = isdigit(*p) ? *p - '0' : tolower(*p) - 'a' + 10;
+    magnitude = magnitude > (ULONG_MAX - digit) / base ? ULONG_MAX : magnitude * base + digit;
+  }
+  return p != digits;
+}
+
+// Checks the request or status line like f_HTTP_decodeCommon() does, returns false if it is malformed
+static bool frame_start_line(const unsigned char* line, const unsigned char* end, int& flags)
+{
+  const unsigned char* space = (const unsigned char*)memchr(line, ' ', end - line);
+  const unsigned char* p;
+  unsigned long number;
+  bool negative;
+
+  if(space == NULL)
+    return false;
+
+  if(space - line >= 5 && strncasecmp((const char*)line, "HTTP/", 5) == 0)
+  {
+    // "HTTP/%d.%d %d"
+    if(memcmp(line, "HTTP/", 5) != 0)
+      return false;
+    p = line + 5;
+    if(!frame_number(p, end, 10, number, negative) || p == end || *p++ != '.' ||
+       !frame_number(p, end, 10, number, negative) || !frame_number(p, end, 10, number, negative))
+      return false;
+
+    flags |= FRAME_FLAG_RESPONSE;
+    if(!negative && ((number > 99 && number < 200) || number == 204 || number == 304))
+      flags |= FRAME_FLAG_NO_BODY_STATUS;
+  }
+  else
+  {
+    // "%s HTTP/%d.%d" after the method
+    for(p = space + 1; p < end && isspace(*p); p++);
+    const unsigned char* uri = p;
+    for( ; p < end && !isspace(*p); p++);
+    if(p == uri)
+      return false;
+    for( ; p < end && isspace(*p); p++);
+    if(end - p < 5 || memcmp(p, "HTTP/", 5) != 0)
+      return false;
+    p += 5;
+    if(!frame_number(p, end, 10, number, negative) || p == end || *p++ != '.' ||
+       !frame_number(p, end, 10, number, negative))
+      return false;
+  }
+  return true;
+}
+
+// Picks the Content-Length and Transfer-Encoding headers like HTTP_decode_header_line() does
+static void frame_header(const unsigned char* line, const unsigned char* end, int& content_length, int& flags)
+{
+  const unsigned char* separator = (const unsigned char*)memchr(line, ':', end - line);
+
+  if(separator == NULL)
+    return;
+
+  const unsigned char* value = separator + 1;
+  while(value < end && isspace(*value))
+    value++;
+  while(end > value && isspace(end[-1]))
+    end--;
+
+  if(separator - line == 14 && strncasecmp((const char*)line, "Content-Length", 14) == 0)
+  {
+    unsigned long number;
+    bool negative;
+    if(frame_number(value, end, 10, number, negative))
+    {
+      if(negative)
+        content_length = number > (unsigned long)INT_MAX ? INT_MIN : -(int)number;
+      else
+        content_length = number > (unsigned long)INT_MAX ? INT_MAX : (int)number;
+    }
+    flags |= FRAME_FLAG_LENGTH_RECEIVED;
+  }
+  else if(separator - line == 17 && strncasecmp((const char*)line, "Transfer-Encoding", 17) == 0 &&
+          end - value == 7 && strncasecmp((const char*)value, "chunked", 7) == 0)
+    flags |= FRAME_FLAG_CHUNKED;
+}
+
+// Position after the '\n' that f_HTTP_decodeCommon() skips after a chunk, if it is there
+static int frame_skip_lf(const unsigned char* data, int len, int pos)
+{
+  return pos < len && data[pos] == '\n' ? pos + 1 : pos;
+}
+
+// Native message length calculator of the IPL4 test port, f__HTTPMessage__getMsgLen without the octetstring
+static int HTTPMessage_getMsgLen(const unsigned char* data, size_t data_len, Socket__API__Definitions::ro__integer& args)
+{
+  int len = data_len > (size_t)INT_MAX ? INT_MAX : (int)data_len;
+
+  // anything else than the state of the previous call for a shorter part of the same stream starts a new scan
+  if(args.size_of() != FRAME_STATE_SIZE || (int)args[FRAME_STATE_OFFSET] > len)
+    frame_reset(args);
+
+  int phase = args[FRAME_STATE_PHASE];
+  int offset = args[FRAME_STATE_OFFSET];
+  int content_length = args[FRAME_STATE_CONTENT_LENGTH];
+  int flags = args[FRAME_STATE_FLAGS];
+
+  int msg_len = -1;
+  bool more_data_needed = len == 0;
+  int line_end, next;
+
+  while(msg_len == -1 && !more_data_needed)
+  {
+    switch(phase)
+    {
+    case PHASE_START_LINE:
+      switch(frame_line(data, len, offset, false, line_end, next))
+      {
+      case TRUE:
+        if(frame_start_line(data + offset, data + line_end, flags))
+        {
+          offset = next;
+          phase = PHASE_HEADERS;
+        }
+        else
+          msg_len = len; // the whole stream is reported as an erronous message, like in f__HTTPMessage__len
+        break;
+      case FALSE:
+        more_data_needed = true;
+        break;
+      default:
+        msg_len = len;
+      }
+      break;
+
+    case PHASE_HEADERS:
+      switch(frame_line(data, len, offset, true, line_end, next))
+      {
+      case TRUE:
+        frame_header(data + offset, data + line_end, content_length, flags);
+        offset = next;
+        break;
+      case BUFFER_CRLF:
+        offset = next;
+        if(content_length == -1 && (flags & FRAME_FLAG_NO_BODY_STATUS))
+          content_length = 0;
+        if(!(flags & (FRAME_FLAG_RESPONSE | FRAME_FLAG_LENGTH_RECEIVED | FRAME_FLAG_CHUNKED)))
+          content_length = 0;
+
+        if(flags & FRAME_FLAG_CHUNKED)
+          phase = PHASE_CHUNK_SIZE;
+        else if(content_length < 0)
+          msg_len = len; // like f__HTTPMessage__len, everything received so far is taken as the body
+        else if(content_length <= INT_MAX - offset)
+          msg_len = offset + content_length;
+        else
+          phase = PHASE_UNTIL_CLOSE;
+        break;
+      case FALSE:
+        more_data_needed = true;
+        break;
+      default:
+        msg_len = len;
+      }
+      break;
+
+    case PHASE_CHUNK_SIZE:
+      switch(frame_line(data, len, offset, false, line_end, next))
+      {
+      case TRUE:
+        {
+          const unsigned char* p = data + offset;
+          unsigned long chunk_size;
+          bool negative;
+
+          if(!frame_number(p, data + line_end, 16, chunk_size, negative))
+          {
+            msg_len = len;
+            break;
+          }
+          offset = next;
+          if(chunk_size == 0)
+            phase = PHASE_CHUNK_TRAILER;
+          else if(negative || chunk_size > (unsigned long)(INT_MAX - offset))
+            phase = PHASE_UNTIL_CLOSE;
+          else
+          {
+            offset += chunk_size;
+            phase = PHASE_CHUNK_DATA;
+          }
+        }
+        break;
+      case BUFFER_CRLF:
+        offset = next;
+        break;
+      case BUFFER_FAIL:
+        // f_HTTP_decodeCommon() ends the body before a malformed line
+        msg_len = frame_skip_lf(data, len, offset);
+        break;
+      default:
+        more_data_needed = true;
+      }
+      break;
+
+    case PHASE_CHUNK_DATA:
+      if(offset < len)
+      {
+        offset = frame_skip_lf(data, len, offset);
+        phase = PHASE_CHUNK_SIZE;
+      }
+      else
+        more_data_needed = true;
+      break;
+
+    case PHASE_CHUNK_TRAILER:
+      switch(frame_line(data, len, offset, false, line_end, next))
+      {
+      case TRUE:
+      case BUFFER_CRLF:
+        msg_len = frame_skip_lf(data, len, next);
+        break;
+      case BUFFER_FAIL:
+        msg_len = frame_skip_lf(data, len, offset);
+        break;
+      default:
+        more_data_needed = true;
+      }
+      break;
+
+    default:
+      more_data_needed = true;
+    }
+  }
+
+  if(msg_len != -1)
+  {
+    frame_reset(args);
+  }
+  else
+  {
+    args[FRAME_STATE_PHASE] = phase;
+    args[FRAME_STATE_OFFSET] = offset;
+    args[FRAME_STATE_CONTENT_LENGTH] = content_length;
+    args[FRAME_STATE_FLAGS] = flags;
+  }
+  return msg_len;
+}
+
+INTEGER f__HTTPMessage__getMsgLen(OCTETSTRING const& stream, Socket__API__Definitions::ro__integer& args)
+{
+  return HTTPMessage_getMsgLen((const unsigned char*)stream, stream.lengthof(), args);
+}
+
+// f_IPL4_setGetMsgLen installs HTTPMessage_getMsgLen instead of f_HTTPMessage_getMsgLen
+static IPL4asp__PortType::NativeGetMsgLenRegistrar native_getMsgLen_registrar(f__HTTPMessage__getMsgLen, HTTPMessage_getMsgLen);
 }
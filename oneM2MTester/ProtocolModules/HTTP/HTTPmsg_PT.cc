@@ -45,6 +45,12 @@ HTTPmsg__PT::HTTPmsg__PT(const char *par_port_name)
     adding_client_connection = false;
     adding_ssl_connection = false;
     server_use_ssl = false;
+    keep_alive_pool = false;
+    keep_alive_idle_timeout = 30.0;
+    max_requests_per_connection = 0;
+    max_pipelined_requests = 1;
+    adding_pool_connection = false;
+    pool_timer_set = false;
 #ifdef AS_USE_SSL
     
     set_ssl_use_ssl(true);
@@ -53,7 +59,8 @@ HTTPmsg__PT::HTTPmsg__PT(const char *par_port_name)
 
 HTTPmsg__PT::~HTTPmsg__PT()
 {
-
+    for(size_t i = 0; i < decoding_states.size(); i++)
+        delete decoding_states[i];
 }
 
 void HTTPmsg__PT::set_parameter(const char *parameter_name,
@@ -65,6 +72,29 @@ void HTTPmsg__PT::set_parameter(const char *parameter_name,
         else if (strcasecmp(parameter_value,"no")==0) use_notification_ASPs = false;
         else log_error("Parameter value '%s' not recognized for parameter '%s'", parameter_value, use_notification_ASPs_name());
     }
+    else if(strcasecmp(parameter_name, keep_alive_pool_name()) == 0) {
+        if (strcasecmp(parameter_value,"yes")==0) keep_alive_pool = true;
+        else if (strcasecmp(parameter_value,"no")==0) keep_alive_pool = false;
+        else log_error("Parameter value '%s' not recognized for parameter '%s'", parameter_value, keep_alive_pool_name());
+    }
+    else if(strcasecmp(parameter_name, keep_alive_idle_timeout_name()) == 0) {
+        char* end;
+        keep_alive_idle_timeout = strtod(parameter_value, &end);
+        if (end == parameter_value || *end != '\0' || keep_alive_idle_timeout <= 0.0)
+            log_error("Parameter value '%s' not recognized for parameter '%s'", parameter_value, keep_alive_idle_timeout_name());
+    }
+    else if(strcasecmp(parameter_name, max_requests_per_connection_name()) == 0) {
+        char* end;
+        max_requests_per_connection = strtol(parameter_value, &end, 10);
+        if (end == parameter_value || *end != '\0' || max_requests_per_connection < 0)
+            log_error("Parameter value '%s' not recognized for parameter '%s'", parameter_value, max_requests_per_connection_name());
+    }
+    else if(strcasecmp(parameter_name, max_pipelined_requests_name()) == 0) {
+        char* end;
+        max_pipelined_requests = strtol(parameter_value, &end, 10);
+        if (end == parameter_value || *end != '\0' || max_pipelined_requests < 1)
+            log_error("Parameter value '%s' not recognized for parameter '%s'", parameter_value, max_pipelined_requests_name());
+    }
     else if((strcasecmp(parameter_name, use_connection_ASPs_name()) == 0) || !parameter_set(parameter_name ,parameter_value)) {
         log_warning("HTTPmsg__PT::set_parameter(): Unsupported Test Port parameter: %s", parameter_name);
     }
@@ -83,6 +113,7 @@ void HTTPmsg__PT::Handle_Timeout(double time_since_last_call)
 {
     log_debug("entering HTTPmsg__PT::Handle_Timeout()");
     Handle_Timeout_Event(time_since_last_call);
+    close_idle_pool_connections();
     log_debug("leaving HTTPmsg__PT::Handle_Timeout()");
 }
 
@@ -103,6 +134,12 @@ void HTTPmsg__PT::user_unmap(const char *system_port)
 
   unmap_user();
 
+  if(pool_timer_set)
+  {
+    Timer_Set_Handler(0.0);
+    pool_timer_set = false;
+  }
+
   log_debug("leaving HTTPmsg__PT::user_unmap()");
 }
 
@@ -204,8 +241,10 @@ void HTTPmsg__PT::outgoing_send(const HTTPmsg__Types::HTTPMessage& send_par)
 {
     log_debug("entering HTTPmsg__PT::outgoing_send(HTTPMessage)");
 
-    TTCN_Buffer snd_buf;
+    TTCN_Buffer head;
     int client_id = -1;
+    bool is_request = false;
+    bool head_request = false;
 
     switch(send_par.get_selection())
     {
@@ -213,12 +252,20 @@ void HTTPmsg__PT::outgoing_send(const HTTPmsg__Types::HTTPMessage& send_par)
         {
             if(send_par.request().client__id().ispresent())
                 client_id = send_par.request().client__id()();
+            else if(keep_alive_pool)
+                client_id = get_pool_connection(send_par.request().uri(), send_par.request().header());
+            is_request = true;
+            head_request = send_par.request().method() == "HEAD";
             break;
         }
         case HTTPmsg__Types::HTTPMessage::ALT_request__binary:
         {
             if(send_par.request__binary().client__id().ispresent())
                 client_id = send_par.request__binary().client__id()();
+            else if(keep_alive_pool)
+                client_id = get_pool_connection(send_par.request__binary().uri(), send_par.request__binary().header());
+            is_request = true;
+            head_request = send_par.request__binary().method() == "HEAD";
             break;
         }
         case HTTPmsg__Types::HTTPMessage::ALT_response:
@@ -243,12 +290,22 @@ void HTTPmsg__PT::outgoing_send(const HTTPmsg__Types::HTTPMessage& send_par)
             TTCN_error("Unknown HTTP_Message type to encode and send!");
     }
 
-    f_HTTP_encodeCommon(send_par, snd_buf);
+    // A long body is sent from send_par after the encoded head without copying it into one buffer,
+    // below HTTP_SCATTER_MIN_BODY the copy is cheaper than the gathering write
+    const unsigned char* body;
+    size_t body_length;
+    f_HTTP_encodeHead(send_par, head, body, body_length, HTTP_SCATTER_MIN_BODY);
 
-    if(client_id >= 0)
-        send_outgoing(snd_buf.get_data(), snd_buf.get_len(), client_id);
-    else
-        send_outgoing(snd_buf.get_data(), snd_buf.get_len());
+    struct iovec fragments[2];
+    fragments[0].iov_base = (void*)head.get_data();
+    fragments[0].iov_len = head.get_len();
+    fragments[1].iov_base = (void*)body;
+    fragments[1].iov_len = body_length;
+
+    send_outgoing_v(fragments, body_length > 0 ? 2 : 1, client_id);
+
+    if(is_request)
+        request_sent(client_id, head_request);
 
     log_debug("leaving HTTPmsg__PT::outgoing_send(HTTPMessage)");
 }
@@ -257,6 +314,13 @@ void HTTPmsg__PT::client_connection_opened(int client_id)
 {
     log_debug("entering HTTPmsg__PT::client_connection_opened(%d)", client_id);
 
+    if(adding_pool_connection)
+    {
+        // get_pool_connection() handles the result, the test does not know about the connections of the pool
+        log_debug("leaving HTTPmsg__PT::client_connection_opened() for a keep-alive connection");
+        return;
+    }
+
     if(use_notification_ASPs)
     {
         HTTPmsg__Types::Connect__result asp;
@@ -298,6 +362,13 @@ void HTTPmsg__PT::message_incoming(const unsigned char* /*msg*/, int /*messageLe
             break;
     }
 
+    const HTTP_Connection_State& conn = get_connection_state(client_id);
+    if(!conn.pool_key.empty() && conn.closing && conn.pending.empty())
+    {
+        log_debug("HTTPmsg__PT::message_incoming(): closing keep-alive connection %d after its last response", client_id);
+        remove_client(client_id);
+    }
+
     log_debug("leaving HTTPmsg__PT::message_incoming()");
 }
 
@@ -306,7 +377,6 @@ void HTTPmsg__PT::peer_half_closed(int client_id)
     log_debug("entering HTTPmsg__PT::peer_half_closed(client_id: %d)", client_id);
 
     TTCN_Buffer* buf_p = get_buffer(client_id);
-    buf_p->rewind();
     while(buf_p->get_read_len() > 0)
     {
         log_debug("HTTPmsg__PT::remove_client(): decoding next message, len: %d", (int)buf_p->get_read_len());
@@ -314,6 +384,14 @@ void HTTPmsg__PT::peer_half_closed(int client_id)
             break;
     }
 
+    if(!get_connection_state(client_id).pool_key.empty())
+    {
+        // the port closes its keep-alive connections itself, without telling the test
+        remove_client(client_id);
+        log_debug("leaving HTTPmsg__PT::peer_half_closed(client_id: %d) after closing the keep-alive connection", client_id);
+        return;
+    }
+
     HTTPmsg__Types::Half__close asp;
     asp.client__id() = client_id;
     incoming_message(asp);
@@ -325,7 +403,9 @@ void HTTPmsg__PT::peer_disconnected(int client_id)
 {
     log_debug("entering HTTPmsg__PT::peer_disconnected(client_id: %d)", client_id);
 
-    if(use_notification_ASPs)
+    if(!get_connection_state(client_id).pool_key.empty())
+        log_debug("keep-alive connection %d closed", client_id);
+    else if(use_notification_ASPs)
     {
         HTTPmsg__Types::Close asp;
         asp.client__id() = client_id;
@@ -363,6 +443,17 @@ bool HTTPmsg__PT::add_user_data(int client_id)
 
     set_server_mode(!adding_client_connection);
 
+    // a new connection starts with a new message
+    if(client_id >= 0 && (size_t)client_id < decoding_states.size() && decoding_states[client_id] != NULL)
+        decoding_states[client_id]->reset();
+    if(client_id >= 0)
+    {
+        HTTP_Connection_State& conn = get_connection_state(client_id);
+        conn = HTTP_Connection_State();
+        conn.open = true;
+        conn.last_used = TTCN_Snapshot::time_now();
+    }
+
     if((adding_client_connection && !adding_ssl_connection) || (!adding_client_connection && !server_use_ssl))
     {
         log_debug("leaving HTTPmsg__PT::add_user_data() with returning Abstract_Socket::add_user_data()");
@@ -386,6 +477,22 @@ bool HTTPmsg__PT::remove_user_data(int client_id)
 {
     log_debug("entering HTTPmsg__PT::remove_user_data(client_id: %d", client_id);
 
+    if(client_id >= 0 && (size_t)client_id < decoding_states.size())
+    {
+        delete decoding_states[client_id];
+        decoding_states[client_id] = NULL;
+    }
+    if(client_id >= 0 && (size_t)client_id < connection_states.size())
+    {
+        // the pool key is kept, so peer_disconnected() still knows that the port owned the connection
+        HTTP_Connection_State& conn = connection_states[client_id];
+        if(!conn.pool_key.empty() && !conn.pending.empty())
+            log_warning("%s: keep-alive connection %d to %s is closed, %d requests are not answered",
+                get_name(), client_id, conn.pool_key.c_str(), (int)conn.pending.size());
+        conn.open = false;
+        conn.pending.clear();
+    }
+
 #ifdef AS_USE_SSL
     if(get_user_data(client_id))
     {
@@ -421,7 +528,6 @@ void HTTPmsg__PT::remove_client(int client_id)
     log_debug("entering HTTPmsg__PT::remove_client(client_id: %d)", client_id);
 
     TTCN_Buffer* buf_p = get_buffer(client_id);
-
     while(buf_p->get_read_len() > 0)
     {
         log_debug("HTTPmsg__PT::remove_client(): decoding next message, len: %d", (int)buf_p->get_read_len());
@@ -476,6 +582,40 @@ int HTTPmsg__PT::send_message_on_nonblocking_fd(int client_id, const unsigned ch
     return Abstract_Socket::send_message_on_nonblocking_fd(client_id, message_buffer, length_of_message);
 }
 
+int HTTPmsg__PT::send_message_on_fd_v(int client_id, const struct iovec* fragments, int fragment_count)
+{
+    log_debug("entering HTTPmsg__PT::send_message_on_fd_v(client_id: %d)", client_id);
+
+#ifdef AS_USE_SSL
+    if(get_user_data(client_id))
+    {
+        // INFO: it is assumed that only SSL_Socket assigns user data to each peer
+        log_debug("leaving HTTPmsg__PT::send_message_on_fd_v() with returning SSL_Socket::send_message_on_fd_v()");
+        return SSL_Socket::send_message_on_fd_v(client_id, fragments, fragment_count);
+    }
+#endif
+
+    log_debug("leaving HTTPmsg__PT::send_message_on_fd_v() with returning Abstract_Socket::send_message_on_fd_v()");
+    return Abstract_Socket::send_message_on_fd_v(client_id, fragments, fragment_count);
+}
+
+int HTTPmsg__PT::send_message_on_nonblocking_fd_v(int client_id, const struct iovec* fragments, int fragment_count)
+{
+    log_debug("entering HTTPmsg__PT::send_message_on_nonblocking_fd_v(client_id: %d)", client_id);
+
+#ifdef AS_USE_SSL
+    if(get_user_data(client_id))
+    {
+        // INFO: it is assumed that only SSL_Socket assigns user data to each peer
+        log_debug("leaving HTTPmsg__PT::send_message_on_nonblocking_fd_v() with returning SSL_Socket::send_message_on_nonblocking_fd_v()");
+        return SSL_Socket::send_message_on_nonblocking_fd_v(client_id, fragments, fragment_count);
+    }
+#endif
+
+    log_debug("leaving HTTPmsg__PT::send_message_on_nonblocking_fd_v() with returning Abstract_Socket::send_message_on_nonblocking_fd_v()");
+    return Abstract_Socket::send_message_on_nonblocking_fd_v(client_id, fragments, fragment_count);
+}
+
 // HTTP specific functions
 
 // replaced by f_HTTP_encodeCommon:
@@ -484,100 +624,178 @@ int HTTPmsg__PT::send_message_on_nonblocking_fd(int client_id, const unsigned ch
 //   f_HTTP_encodeCommon( msg, buf);
 // }
 
-//Encodes msg type of "HTTPMessage" into buffer
-void f_HTTP_encodeCommon(const HTTPmsg__Types::HTTPMessage& msg, TTCN_Buffer& buf)
+// Writes the encoded message into space of the exact size, or only counts its length without a target
+class HTTP_Writer
 {
-    buf.clear();
-    if( msg.get_selection() == HTTPmsg__Types::HTTPMessage::ALT_erronous__msg )
-        buf.put_cs(msg.erronous__msg().msg());
-    else
+public:
+    explicit HTTP_Writer(unsigned char* target = NULL) : data(target), len(0) {}
+
+    void put(const char* s, size_t n)
     {
-        const HTTPmsg__Types::HeaderLines* header = NULL;
-        const HTTPmsg__Types::HTTPRequest* request = NULL;
-        const HTTPmsg__Types::HTTPResponse* response = NULL;
-        const HTTPmsg__Types::HTTPRequest__binary__body* request_binary = NULL;
-        const HTTPmsg__Types::HTTPResponse__binary__body* response_binary = NULL;
-        const CHARSTRING* body = NULL;
-        const OCTETSTRING* body_binary = NULL;
-
-        if(msg.get_selection() == HTTPmsg__Types::HTTPMessage::ALT_request)
-        {
-            request = &msg.request();
-            header = &request->header();
-            body = &request->body();
-            buf.put_cs(request->method());
-            buf.put_c(' ');
-            buf.put_cs(request->uri());
-            buf.put_cs(" HTTP/");
-            buf.put_cs(int2str(request->version__major()));
-            buf.put_c('.');
-            buf.put_cs(int2str(request->version__minor()));
-            buf.put_cs("\r\n");
-        }
-        else if(msg.get_selection() == HTTPmsg__Types::HTTPMessage::ALT_response)
+        if(data != NULL)
+            memcpy(data + len, s, n);
+        len += n;
+    }
+
+    void put(const CHARSTRING& cs) { put((const char*)cs, cs.lengthof()); }
+
+    // formats the integer on the stack instead of through int2str()
+    void put_int(const INTEGER& value)
+    {
+        if(!value.is_native())
         {
-            response = &msg.response();
-            header = &response->header();
-            body = &response->body();
-            buf.put_cs("HTTP/");
-            buf.put_cs(int2str(response->version__major()));
-            buf.put_c('.');
-            buf.put_cs(int2str(response->version__minor()));
-            buf.put_c(' ');
-            buf.put_cs(int2str(response->statuscode()));
-            buf.put_c(' ');
-            buf.put_cs(response->statustext());
-            buf.put_cs("\r\n");
+            put(int2str(value));
+            return;
         }
-        else if(msg.get_selection() == HTTPmsg__Types::HTTPMessage::ALT_request__binary)
+        int v = (int)value;
+        unsigned int u = v < 0 ? 0u - (unsigned int)v : (unsigned int)v;
+        char digits[12];
+        char* p = digits + sizeof(digits);
+        do
         {
-            request_binary = &msg.request__binary();
-            header = &request_binary->header();
-            body_binary = &request_binary->body();
-            buf.put_cs(request_binary->method());
-            buf.put_c(' ');
-            buf.put_cs(request_binary->uri());
-            buf.put_cs(" HTTP/");
-            buf.put_cs(int2str(request_binary->version__major()));
-            buf.put_c('.');
-            buf.put_cs(int2str(request_binary->version__minor()));
-            buf.put_cs("\r\n");
-        }
-        else if(msg.get_selection() == HTTPmsg__Types::HTTPMessage::ALT_response__binary)
+            *--p = (char)('0' + u % 10);
+            u /= 10;
+        } while(u != 0);
+        if(v < 0)
+            *--p = '-';
+        put(p, digits + sizeof(digits) - p);
+    }
+
+    size_t length() const { return len; }
+
+private:
+    unsigned char* data;
+    size_t len;
+};
+
+// Writes the start line, the header lines and the empty line of msg, and returns where its body is
+static void HTTP_write_head(const HTTPmsg__Types::HTTPMessage& msg, HTTP_Writer& out,
+    const unsigned char*& body, size_t& body_length)
+{
+    const HTTPmsg__Types::HeaderLines* header = NULL;
+    body = NULL;
+    body_length = 0;
+
+    switch(msg.get_selection())
+    {
+        case HTTPmsg__Types::HTTPMessage::ALT_request:
         {
-            response_binary = &msg.response__binary();
-            header = &response_binary->header();
-            body_binary = &response_binary->body();
-            buf.put_cs("HTTP/");
-            buf.put_cs(int2str(response_binary->version__major()));
-            buf.put_c('.');
-            buf.put_cs(int2str(response_binary->version__minor()));
-            buf.put_c(' ');
-            buf.put_cs(int2str(response_binary->statuscode()));
-            buf.put_c(' ');
-            buf.put_cs(response_binary->statustext());
-            buf.put_cs("\r\n");
+            const HTTPmsg__Types::HTTPRequest& request = msg.request();
+            out.put(request.method());
+            out.put(" ", 1);
+            out.put(request.uri());
+            out.put(" HTTP/", 6);
+            out.put_int(request.version__major());
+            out.put(".", 1);
+            out.put_int(request.version__minor());
+            header = &request.header();
+            body = (const unsigned char*)(const char*)request.body();
+            body_length = request.body().lengthof();
+            break;
         }
-
-        for( int i = 0; i < header->size_of(); i++ )
+        case HTTPmsg__Types::HTTPMessage::ALT_response:
         {
-            buf.put_cs((*header)[i].header__name());
-            buf.put_cs(": ");
-            buf.put_cs((*header)[i].header__value());
-            buf.put_cs("\r\n");
+            const HTTPmsg__Types::HTTPResponse& response = msg.response();
+            out.put("HTTP/", 5);
+            out.put_int(response.version__major());
+            out.put(".", 1);
+            out.put_int(response.version__minor());
+            out.put(" ", 1);
+            out.put_int(response.statuscode());
+            out.put(" ", 1);
+            out.put(response.statustext());
+            header = &response.header();
+            body = (const unsigned char*)(const char*)response.body();
+            body_length = response.body().lengthof();
+            break;
         }
-
-        buf.put_cs("\r\n");
-
-        if(body && body->lengthof() > 0)
+        case HTTPmsg__Types::HTTPMessage::ALT_request__binary:
         {
-            buf.put_cs(*body);
+            const HTTPmsg__Types::HTTPRequest__binary__body& request = msg.request__binary();
+            out.put(request.method());
+            out.put(" ", 1);
+            out.put(request.uri());
+            out.put(" HTTP/", 6);
+            out.put_int(request.version__major());
+            out.put(".", 1);
+            out.put_int(request.version__minor());
+            header = &request.header();
+            body = (const unsigned char*)request.body();
+            body_length = request.body().lengthof();
+            break;
         }
-        else if(body_binary && body_binary->lengthof() > 0)
+        case HTTPmsg__Types::HTTPMessage::ALT_response__binary:
         {
-            buf.put_os(*body_binary);
+            const HTTPmsg__Types::HTTPResponse__binary__body& response = msg.response__binary();
+            out.put("HTTP/", 5);
+            out.put_int(response.version__major());
+            out.put(".", 1);
+            out.put_int(response.version__minor());
+            out.put(" ", 1);
+            out.put_int(response.statuscode());
+            out.put(" ", 1);
+            out.put(response.statustext());
+            header = &response.header();
+            body = (const unsigned char*)response.body();
+            body_length = response.body().lengthof();
+            break;
         }
+        case HTTPmsg__Types::HTTPMessage::ALT_erronous__msg:
+            // sent as it is
+            out.put(msg.erronous__msg().msg());
+            return;
+        default:
+            TTCN_error("Unknown HTTP_Message type to encode!");
+    }
+    out.put("\r\n", 2);
+
+    for( int i = 0; i < header->size_of(); i++ )
+    {
+        out.put((*header)[i].header__name());
+        out.put(": ", 2);
+        out.put((*header)[i].header__value());
+        out.put("\r\n", 2);
     }
+
+    out.put("\r\n", 2);
+}
+
+// Encodes the head of msg into buf, reserved once at its exact size, and appends the body if it is shorter
+// than inline_body_limit. body_length is 0 if the body has been appended.
+static void HTTP_encode_reserved(const HTTPmsg__Types::HTTPMessage& msg, TTCN_Buffer& buf, const size_t inline_body_limit,
+    const unsigned char*& body, size_t& body_length)
+{
+    HTTP_Writer counter;
+    HTTP_write_head(msg, counter, body, body_length);
+    const bool with_body = body_length < inline_body_limit;
+    size_t total = counter.length() + (with_body ? body_length : 0);
+
+    buf.clear();
+    unsigned char* end_ptr;
+    size_t end_len = total;
+    buf.get_end(end_ptr, end_len);
+
+    HTTP_Writer writer(end_ptr);
+    HTTP_write_head(msg, writer, body, body_length);
+    if(with_body && body_length > 0)
+        memcpy(end_ptr + writer.length(), body, body_length);
+    buf.increase_length(total);
+    if(with_body)
+        body_length = 0;
+}
+
+//Encodes msg type of "HTTPMessage" into buffer
+void f_HTTP_encodeCommon(const HTTPmsg__Types::HTTPMessage& msg, TTCN_Buffer& buf)
+{
+    const unsigned char* body;
+    size_t body_length;
+    HTTP_encode_reserved(msg, buf, (size_t)-1, body, body_length);
+}
+
+void f_HTTP_encodeHead(const HTTPmsg__Types::HTTPMessage& msg, TTCN_Buffer& head, const unsigned char*& body, size_t& body_length,
+    const size_t inline_body_limit)
+{
+    HTTP_encode_reserved(msg, head, inline_body_limit, body, body_length);
 }
 
 bool HTTPmsg__PT::HTTP_decode(TTCN_Buffer* buffer, const int client_id, const bool connection_closed)
@@ -586,11 +804,19 @@ bool HTTPmsg__PT::HTTP_decode(TTCN_Buffer* buffer, const int client_id, const bo
   //HTTPmsg__Types::HTTPMessage * msg = new HTTPmsg__Types::HTTPMessage();
 
   HTTPmsg__Types::HTTPMessage msg;
+  HTTP_Decoding_State* state = get_decoding_state(client_id);
+  if(state != NULL)
+  {
+    const HTTP_Connection_State& conn = get_connection_state(client_id);
+    state->head_request = !conn.pending.empty() && conn.pending.front();
+  }
 
-  if(f_HTTP_decodeCommon(buffer, msg, connection_closed, get_socket_debugging(), test_port_type, test_port_name ))
+  if(f_HTTP_decodeCommon(buffer, msg, connection_closed, get_socket_debugging(), test_port_type, test_port_name, state))
   {
     TTCN_Logger::log(TTCN_DEBUG,"HTTPmsg__PT::HTTP_decode, before calling incoming_message");
     f_setClientId(msg,client_id);
+    if(client_id >= 0)
+      response_received(client_id, msg);
     incoming_message(msg);
     TTCN_Logger::log(TTCN_DEBUG,"HTTPmsg__PT::HTTP_decode, after calling incoming_message");
     return true;
@@ -598,6 +824,237 @@ bool HTTPmsg__PT::HTTP_decode(TTCN_Buffer* buffer, const int client_id, const bo
   return false;
 }
 
+HTTP_Decoding_State* HTTPmsg__PT::get_decoding_state(int client_id)
+{
+  if(client_id < 0)
+    return NULL;
+  if((size_t)client_id >= decoding_states.size())
+    decoding_states.resize(client_id + 1, NULL);
+  if(decoding_states[client_id] == NULL)
+    decoding_states[client_id] = new HTTP_Decoding_State;
+  return decoding_states[client_id];
+}
+
+HTTP_Connection_State& HTTPmsg__PT::get_connection_state(int client_id)
+{
+  if((size_t)client_id >= connection_states.size())
+    connection_states.resize(client_id + 1);
+  return connection_states[client_id];
+}
+
+// Host and port of the Host header of a request, the port is default_port if the header does not give it
+static bool HTTP_request_host(const HTTPmsg__Types::HeaderLines& header, int default_port, std::string& host, int& port)
+{
+  for(int i = 0; i < header.size_of(); i++)
+  {
+    if(strcasecmp((const char*)header[i].header__name(), "Host") != 0)
+      continue;
+
+    std::string value((const char*)header[i].header__value());
+    size_t start = value.find_first_not_of(" \t");
+    if(start == std::string::npos)
+      return false;
+    value = value.substr(start, value.find_last_not_of(" \t") - start + 1);
+
+    // the colon of an IPv6 address is inside the brackets
+    size_t colon = value.rfind(':');
+    if(colon != std::string::npos && value.find(']', colon) == std::string::npos)
+    {
+      port = atoi(value.c_str() + colon + 1);
+      host = value.substr(0, colon);
+    }
+    else
+    {
+      port = default_port;
+      host = value;
+    }
+    if(host.size() > 1 && host[0] == '[' && host[host.size() - 1] == ']')
+      host = host.substr(1, host.size() - 2);
+    return !host.empty() && port > 0;
+  }
+  return false;
+}
+
+// True if the connection is not kept alive after the message: HTTP/1.0 without "Connection: keep-alive"
+// or a "close" token in the Connection header
+static bool HTTP_closes_connection(int version_major, int version_minor, const HTTPmsg__Types::HeaderLines& header)
+{
+  bool keep_alive = version_major > 1 || (version_major == 1 && version_minor >= 1);
+  for(int i = 0; i < header.size_of(); i++)
+  {
+    const CHARSTRING& name = header[i].header__name();
+    if(HTTP_header_id((const char*)name, name.lengthof()) != HTTP_HEADER_CONNECTION)
+      continue;
+
+    const char* token = header[i].header__value();
+    while(*token != '\0')
+    {
+      while(*token == ' ' || *token == '\t' || *token == ',')
+        token++;
+      size_t length = strcspn(token, ",");
+      size_t end = length;
+      while(end > 0 && (token[end - 1] == ' ' || token[end - 1] == '\t'))
+        end--;
+      if(end == 5 && strncasecmp(token, "close", 5) == 0)
+        return true;
+      if(end == 10 && strncasecmp(token, "keep-alive", 10) == 0)
+        keep_alive = true;
+      token += length;
+    }
+  }
+  return !keep_alive;
+}
+
+// Returns a connection of the keep-alive pool to the host of the Host header, a new one if all of them are busy.
+// The connection uses SSL if the request URI is an absolute https URI, the pool is keyed on scheme, host and port.
+// Returns -1 if the request has no Host header, then it is sent like without the pool.
+int HTTPmsg__PT::get_pool_connection(const CHARSTRING& uri, const HTTPmsg__Types::HeaderLines& header)
+{
+  const bool use_ssl = uri.lengthof() >= 8 && strncasecmp((const char*)uri, "https://", 8) == 0;
+  std::string host;
+  int port;
+  if(!HTTP_request_host(header, use_ssl ? 443 : 80, host, port))
+  {
+    log_debug("HTTPmsg__PT::get_pool_connection(): no Host header in the request, it is not sent on a keep-alive connection");
+    return -1;
+  }
+
+#ifndef AS_USE_SSL
+  if(use_ssl)
+  {
+    log_error("%s: HTTP test port is not compiled to support SSL connections. Please check the User's Guide for instructions on compiling the HTTP test port with SSL support.", get_name());
+  }
+#endif
+
+  char port_str[16];
+  sprintf(port_str, "%d", port);
+  const std::string key = (use_ssl ? "https://" : "http://") + host + ":" + port_str;
+
+  int client_id = -1;
+  for(size_t i = 0; i < connection_states.size(); i++)
+  {
+    const HTTP_Connection_State& conn = connection_states[i];
+    if(conn.open && !conn.closing && conn.pool_key == key && conn.pending.size() < (size_t)max_pipelined_requests &&
+       (client_id < 0 || conn.pending.size() < connection_states[client_id].pending.size()))
+      client_id = i;
+  }
+  if(client_id >= 0)
+  {
+    log_debug("HTTPmsg__PT::get_pool_connection(): reusing keep-alive connection %d to %s", client_id, key.c_str());
+    return client_id;
+  }
+
+  adding_ssl_connection = use_ssl;
+  adding_client_connection = true;
+  adding_pool_connection = true;
+  client_id = open_client_connection(host.c_str(), port_str, NULL, NULL);
+  adding_ssl_connection = false;
+  adding_client_connection = false;
+  adding_pool_connection = false;
+
+  if(client_id < 0)
+    log_error("%s: cannot open a keep-alive connection to %s", get_name(), key.c_str());
+  get_connection_state(client_id).pool_key = key;
+  log_debug("HTTPmsg__PT::get_pool_connection(): opened keep-alive connection %d to %s", client_id, key.c_str());
+
+  if(!pool_timer_set)
+  {
+    Timer_Set_Handler(keep_alive_idle_timeout / 2, FALSE);
+    pool_timer_set = true;
+  }
+  return client_id;
+}
+
+// Queues the request as waiting for its response on the connection it has been sent on
+void HTTPmsg__PT::request_sent(int client_id, bool head_request)
+{
+  if(client_id < 0)
+  {
+    // sent on the only connection, see Abstract_Socket::send_outgoing_v()
+    if(peer_list_get_nr_of_peers() != 1)
+      return;
+    client_id = peer_list_get_first_peer();
+  }
+
+  HTTP_Connection_State& conn = get_connection_state(client_id);
+  if(!conn.open)
+  {
+    log_warning("%s: connection %d was closed while sending a request on it", get_name(), client_id);
+    return;
+  }
+  conn.pending.push_back(head_request);
+  conn.requests_sent++;
+  conn.last_used = TTCN_Snapshot::time_now();
+  if(!conn.pool_key.empty() && max_requests_per_connection > 0 && conn.requests_sent >= max_requests_per_connection)
+    conn.closing = true;
+}
+
+// Matches a received response to the oldest request waiting on the connection
+void HTTPmsg__PT::response_received(int client_id, const HTTPmsg__Types::HTTPMessage& msg)
+{
+  int statuscode;
+  bool closes_connection;
+  switch(msg.get_selection())
+  {
+    case HTTPmsg__Types::HTTPMessage::ALT_response:
+    {
+      const HTTPmsg__Types::HTTPResponse& response = msg.response();
+      statuscode = response.statuscode();
+      closes_connection = HTTP_closes_connection(response.version__major(), response.version__minor(), response.header());
+      break;
+    }
+    case HTTPmsg__Types::HTTPMessage::ALT_response__binary:
+    {
+      const HTTPmsg__Types::HTTPResponse__binary__body& response = msg.response__binary();
+      statuscode = response.statuscode();
+      closes_connection = HTTP_closes_connection(response.version__major(), response.version__minor(), response.header());
+      break;
+    }
+    default:
+      return;
+  }
+
+  HTTP_Connection_State& conn = get_connection_state(client_id);
+  if(conn.pending.empty())
+    return;
+  // an interim response is followed by the final response to the same request
+  if(statuscode >= 100 && statuscode < 200 && statuscode != 101)
+    return;
+
+  conn.pending.pop_front();
+  conn.last_used = TTCN_Snapshot::time_now();
+  if(closes_connection)
+    conn.closing = true;
+  log_debug("HTTPmsg__PT::response_received(): response %d matched, %d requests are waiting on connection %d",
+    statuscode, (int)conn.pending.size(), client_id);
+}
+
+// Closes the keep-alive connections that have not been used for keep_alive_idle_timeout
+void HTTPmsg__PT::close_idle_pool_connections()
+{
+  double now = TTCN_Snapshot::time_now();
+  bool pool_used = false;
+  for(size_t i = 0; i < connection_states.size(); i++)
+  {
+    const HTTP_Connection_State& conn = connection_states[i];
+    if(!conn.open || conn.pool_key.empty())
+      continue;
+    if(conn.pending.empty() && now - conn.last_used >= keep_alive_idle_timeout)
+    {
+      log_debug("HTTPmsg__PT::close_idle_pool_connections(): closing idle keep-alive connection %d to %s", (int)i, conn.pool_key.c_str());
+      remove_client(i);
+    }
+    else
+      pool_used = true;
+  }
+
+  if(!pool_used && pool_timer_set)
+  {
+    Timer_Set_Handler(0.0);
+    pool_timer_set = false;
+  }
+}
+
 void f_setClientId( HTTPmsg__Types::HTTPMessage& msg, const int client_id)
 {
   switch(msg.get_selection())
@@ -633,428 +1090,562 @@ void f_setClientId( HTTPmsg__Types::HTTPMessage& msg, const int client_id)
   return;
 }//f_setClientId
 
+void HTTP_Decoding_State::reset()
+{
+    phase = HTTP_PHASE_START_LINE;
+    pos = 0;
+    isResponse = false;
+    method_name = "";
+    stext = "";
+    version__major = 0;
+    version__minor = 0;
+    statusCode = 0;
+    header = NULL_VALUE;
+    header_index = 0;
+    length_received = false;
+    chunk_size = 0;
+    body_start = 0;
+    body_length = 0;
+    decoding_params.non_persistent_connection = FALSE;
+    decoding_params.chunked_body = FALSE;
+    decoding_params.content_length = -1;
+    decoding_params.error = FALSE;
+    decoding_params.isMessage = TRUE;
+}
+
 //
 // returns with true if the buffer is not empty and it contain valid message
 // Postcondition: if buffer contains valid message, msg will contain the first decoded HTTP message, the decoded part will be removed from the buffer
+// If a state is given, it keeps the parsed part of an incomplete message, so the next call continues from there.
+// The message is decoded from the read position of the buffer. Decoded messages are skipped by moving the read
+// position, and only cut from the buffer once they take more than half of it, so pipelined messages are not
+// moved to the front one by one.
 bool f_HTTP_decodeCommon( TTCN_Buffer* buffer, HTTPmsg__Types::HTTPMessage& msg, const bool connection_closed,
-    const bool socket_debugging, const char *test_port_type, const char *test_port_name)
+    const bool socket_debugging, const char *test_port_type, const char *test_port_name, HTTP_Decoding_State* state)
 {
 
     TTCN_Logger::log(TTCN_DEBUG, "starting f_HTTP_decodeCommon ");
     if(buffer->get_read_len() <= 0)
         return FALSE;
 
-    buffer->rewind();
+    const size_t start = buffer->get_pos();
+    HTTP_Read_Cursor cursor(buffer->get_read_data(), buffer->get_read_len());
+    cursor.buffer = buffer;
+    bool decoded = HTTP_decode_message(cursor, msg, connection_closed, socket_debugging, test_port_type, test_port_name, state);
+    if(decoded)
+    {
+        buffer->set_pos(start + cursor.pos);
+        if(buffer->get_pos() > buffer->get_len() / 2)
+            buffer->cut();
+    }
+    return decoded;
+}
 
-    Decoding_Params decoding_params;
-    decoding_params.non_persistent_connection = FALSE;
-    decoding_params.chunked_body = FALSE;
-    decoding_params.content_length = -1;
-    decoding_params.error = FALSE;
-    decoding_params.isMessage = TRUE;
+// Decodes the first message of the data of the cursor in place, see HTTP_Read_Cursor
+bool HTTP_decode_message(HTTP_Read_Cursor& cursor, HTTPmsg__Types::HTTPMessage& msg, const bool connection_closed,
+    const bool socket_debugging, const char *test_port_type, const char *test_port_name, HTTP_Decoding_State* state)
+{
+    const unsigned char* data = cursor.data;
+    unsigned char* writable_data = NULL;
+    const size_t len = cursor.len;
+
+    HTTP_Decoding_State local_state;
+    if(state == NULL)
+        state = &local_state;
+    else if(state->pos > len)
+        state->reset(); // the buffer has been cleared since the previous call
 
     if (TTCN_Logger::log_this_event(TTCN_DEBUG))
     {
         if( test_port_name!= NULL)
           TTCN_Logger::log(TTCN_DEBUG, "%s DECODER: <%s>\n", test_port_name,
-            (const char*)CHARSTRING(buffer->get_read_len(), (const char*)buffer->get_read_data()));
+            (const char*)CHARSTRING(len, (const char*)data));
         else
           TTCN_Logger::log(TTCN_DEBUG, "DECODER: <%s>\n",
-            (const char*)CHARSTRING(buffer->get_read_len(), (const char*)buffer->get_read_data()));
+            (const char*)CHARSTRING(len, (const char*)data));
     }
 
-    CHARSTRING first;
-    bool isResponse;
+    Decoding_Params& decoding_params = state->decoding_params;
+    size_t line_end, next;
+    bool complete = false;
+    bool more_data_needed = false;
 
-    // Decoding the first line
-
-    switch(get_line(buffer, first, false))
+    while(!complete && !more_data_needed && !decoding_params.error)
     {
-    case TRUE: // The first line is available
+        switch(state->phase)
         {
-            //HTTPmsg__Types::HTTPMessage msg;
-            HTTPmsg__Types::HeaderLines header = NULL_VALUE;
-            OCTETSTRING body=OCTETSTRING(0, (const unsigned char*)"");
-            const char *cc_first = (const char *)first;
-            //fprintf(stderr, "first: %s\n", cc_first);
-            int version__major, version__minor, statusCode;
-
-            char* method_name;
-            const char* pos = strchr(cc_first, ' ');
-            if(pos == NULL)
+        case HTTP_PHASE_START_LINE:
+            switch(HTTP_find_line(data, len, state->pos, false, connection_closed, line_end, next))
             {
-                TTCN_Logger::log(TTCN_DEBUG, "could not find space in the first line of response: <%s>", cc_first);
-                decoding_params.isMessage = FALSE;
+            case TRUE:
+                {
+                    CHARSTRING first(line_end - state->pos, (const char*)data + state->pos);
+                    state->pos = next;
+                    if(HTTP_decode_start_line(first, *state))
+                        state->phase = HTTP_PHASE_HEADERS;
+                    else
+                        decoding_params.error = TRUE;
+                }
+                break;
+            case BUFFER_CRLF:
+                state->pos = next;
+                decoding_params.error = TRUE;
+                break;
+            case BUFFER_FAIL:
                 decoding_params.error = TRUE;
                 break;
+            default:
+                more_data_needed = true;
             }
-            method_name = (char*)Malloc(pos - cc_first + 1);
-            strncpy(method_name, cc_first, pos - cc_first);
-            method_name[pos - cc_first] = '\0';
-
-            char* stext = (char*)Malloc(strlen(cc_first));
-            stext[0] = '\0';
-	    
-            TTCN_Logger::log(TTCN_DEBUG, "method_name: <%s>", method_name);
-            if(strncasecmp(method_name, "HTTP/", 5) == 0)
+            break;
+
+        case HTTP_PHASE_HEADERS:
+            switch(HTTP_find_line(data, len, state->pos, true, connection_closed, line_end, next))
             {
-                // The first line contains a response like HTTP/1.1 200 OK
-                isResponse = true;
+            case TRUE:
+                HTTP_decode_header_line(data + state->pos, line_end - state->pos, *state, socket_debugging, test_port_type, test_port_name);
+                state->pos = next;
+                break;
+            case BUFFER_CRLF:
+                state->pos = next;
+                TTCN_Logger::log(TTCN_DEBUG, "Headers decoded.");
+                if(!state->isResponse && !state->length_received && !decoding_params.chunked_body)
+                    decoding_params.content_length = 0;
+                if(state->isResponse && decoding_params.content_length == -1 &&
+                   ((state->statusCode > 99 && state->statusCode < 200) || state->statusCode == 204 || state->statusCode == 304))
+                    decoding_params.content_length = 0;
+                if(state->isResponse && state->head_request)
+                {
+                    // the headers describe the body a GET would have got
+                    decoding_params.content_length = 0;
+                    decoding_params.chunked_body = FALSE;
+                }
+                if(len > state->pos)
+                    HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "Decoding body, buffer length: %d", (int)(len - state->pos));
+                state->phase = decoding_params.chunked_body ? HTTP_PHASE_CHUNK_SIZE : HTTP_PHASE_BODY;
+                break;
+            case BUFFER_FAIL:
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name, "BUFFER_FAIL in HTTP_decode_header!");
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name, "whole bufer now: <%s>", (const char*)CHARSTRING(len, (const char*)data));
+                log_to_hexa(data, len);
+                decoding_params.error = TRUE;
+                break;
+            default:
+                more_data_needed = true;
+            }
+            break;
 
-                if(sscanf(cc_first, "HTTP/%d.%d %d %[^\r]", &version__major, &version__minor,
-                          &statusCode, stext) < 3)
+        case HTTP_PHASE_BODY:
+            if(decoding_params.content_length >= 0)
+            {
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "lengthof body: %d, content_length given: %d", (int)(len - state->pos), decoding_params.content_length);
+                if(len - state->pos >= (size_t)decoding_params.content_length)
+                    complete = true;
+                else
                 {
-                    decoding_params.isMessage = FALSE;
-                    decoding_params.error = TRUE;
-            Free(method_name);
-            Free(stext);
-                    break;
+                    HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "The decoder's body length %d is less than the Content_length in the message header %d; The HTTP port is waiting for additional data.", (int)(len - state->pos), decoding_params.content_length);
+                    more_data_needed = true;
                 }
-                if (version__minor == 0)
-                    decoding_params.non_persistent_connection = TRUE;
+            }
+            else if(connection_closed)
+            {
+                decoding_params.content_length = len - state->pos;
+                complete = true;
             }
             else
             {
-                isResponse = false;
-                // The first line contains a request
-                // like "POST / HTTP/1.0"
-                if(sscanf(pos + 1, "%s HTTP/%d.%d",
-                          stext, &version__major, &version__minor ) != 3)
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "The HTTP port is waiting for additional data.");
+                more_data_needed = true;
+            }
+            break;
+
+        case HTTP_PHASE_CHUNK_SIZE:
+            switch(HTTP_find_line(data, len, state->pos, false, connection_closed, line_end, next))
+            {
+            case TRUE:
                 {
-                    decoding_params.isMessage = FALSE;
-                    decoding_params.error = TRUE;
-            Free(method_name);
-            Free(stext);
-                    break;
+                    CHARSTRING line(line_end - state->pos, (const char*)data + state->pos);
+                    unsigned int chunk_size;
+                    HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "line: <%s>", (const char*)line);
+                    state->pos = next;
+                    if(sscanf((const char *)line, "%x", &chunk_size) != 1)
+                    {
+                        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "No chunksize found");
+                        state->pos = HTTP_skip_chunk_lf(data, len, state->pos);
+                        decoding_params.error = TRUE;
+                    }
+                    else if(chunk_size == 0)
+                    {
+                        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name, "chunk_size 0 -> closing chunk");
+                        state->phase = HTTP_PHASE_CHUNK_TRAILER;
+                    }
+                    else
+                    {
+                        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "processing next chunk, size: %d", chunk_size);
+                        state->chunk_size = chunk_size;
+                        state->phase = HTTP_PHASE_CHUNK_DATA;
+                    }
                 }
+                break;
+            case BUFFER_CRLF:
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "beginning CRLF removed");
+                state->pos = next;
+                break;
+            case BUFFER_FAIL:
+                // the body ends before the malformed line
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "BUFFER_FAIL");
+                state->pos = HTTP_skip_chunk_lf(data, len, state->pos);
+                complete = true;
+                break;
+            default:
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "buffer does not contain a whole line, more data is needed");
+                more_data_needed = true;
             }
+            break;
 
-            // Additional header lines
-            TTCN_Logger::log(TTCN_DEBUG, "Decoding the headers");
-            HTTP_decode_header(buffer, header, decoding_params, socket_debugging, isResponse, test_port_type, test_port_name);
-            TTCN_Logger::log(TTCN_DEBUG, "Headers decoded. %s headers.", decoding_params.isMessage ? "Valid" : "Invalid");
-
-            if(isResponse && decoding_params.content_length==-1){
-              if( (statusCode>99 && statusCode <200) || statusCode==204 || statusCode==304 ) decoding_params.content_length=0;
+        case HTTP_PHASE_CHUNK_DATA:
+            // the byte after the chunk is needed to skip a '\n' there
+            if(len - state->pos < state->chunk_size || (len - state->pos == state->chunk_size && !connection_closed))
+            {
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "chunk size is greater than the buffer length, more data is needed");
+                more_data_needed = true;
+                break;
             }
-
-            if(decoding_params.isMessage)
-                HTTP_decode_body(buffer, body, decoding_params, connection_closed, socket_debugging, test_port_type, test_port_name);
-
-            if(decoding_params.isMessage)
+            HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "pull %d bytes from %d", (int)state->chunk_size, (int)(len - state->pos));
+            if(state->body_length == 0)
+                state->body_start = state->pos;
+            else
             {
-                TTCN_Logger::log(TTCN_DEBUG, "Message successfully decoded");
-                bool foundBinaryCharacter = false;
-
-                int len = body.lengthof();
-                const unsigned char* ptr = (const unsigned char*)body;
-                for(int i = 0; i < len && !foundBinaryCharacter; i++)
+                // overwrite the chunk size line and the line end before this chunk
+                if(writable_data == NULL)
                 {
-                    if(!isascii(ptr[i]))
-                        foundBinaryCharacter = true;
+                    writable_data = HTTP_writable_data(cursor);
+                    data = writable_data;
                 }
-                if(foundBinaryCharacter)
-                    TTCN_Logger::log(TTCN_DEBUG, "Binary data found");
-                if(isResponse)
+                memmove(writable_data + state->body_start + state->body_length, writable_data + state->pos, state->chunk_size);
+            }
+            state->body_length += state->chunk_size;
+            state->pos = HTTP_skip_chunk_lf(data, len, state->pos + state->chunk_size);
+            state->phase = HTTP_PHASE_CHUNK_SIZE;
+            break;
+
+        case HTTP_PHASE_CHUNK_TRAILER:
+            switch(HTTP_find_line(data, len, state->pos, false, connection_closed, line_end, next))
+            {
+            case BUFFER_CRLF:
+                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "Trailing \\r\\n ok!");
+                state->pos = HTTP_skip_chunk_lf(data, len, next);
+                complete = true;
+                break;
+            case TRUE:
+                TTCN_Logger::log(TTCN_WARNING,"Trailing \\r\\n after the closing chunk is not present, instead it is <%s>!",
+                    (const char*)CHARSTRING(line_end - state->pos, (const char*)data + state->pos));
+                state->pos = HTTP_skip_chunk_lf(data, len, next);
+                complete = true;
+                break;
+            case BUFFER_FAIL:
+                TTCN_Logger::log(TTCN_WARNING,"Trailing \\r\\n after the closing chunk is not present");
+                state->pos = HTTP_skip_chunk_lf(data, len, state->pos);
+                complete = true;
+                break;
+            default:
+                if(connection_closed)
                 {
-                  if(foundBinaryCharacter)
-                  {
-                    HTTPmsg__Types::HTTPResponse__binary__body& response_binary = msg.response__binary();
-                    response_binary.client__id() = OMIT_VALUE;
-                    response_binary.version__major() = version__major;
-                    response_binary.version__minor() = version__minor;
-                    response_binary.statuscode() = statusCode;
-                    if(strlen(stext) > 0)
-                        response_binary.statustext() = CHARSTRING(stext);
-                    else
-                        response_binary.statustext() = "";
-                    response_binary.header() = header;
-                    response_binary.body() = body;
-                  }
-                  else
-                  {
-                    HTTPmsg__Types::HTTPResponse& response = msg.response();
-                    response.client__id() = OMIT_VALUE;
-                    response.version__major() = version__major;
-                    response.version__minor() = version__minor;
-                    response.statuscode() = statusCode;
-                    if(strlen(stext) > 0)
-                        response.statustext() = CHARSTRING(stext);
-                    else
-                        response.statustext() = "";
-                    response.header() = header;
-                    response.body() = oct2char(body);
-                  }
+                    TTCN_Logger::log(TTCN_WARNING,"Trailing \\r\\n after the closing chunk is not present");
+                    state->pos = HTTP_skip_chunk_lf(data, len, state->pos);
+                    complete = true;
                 }
                 else
-                {
-                  if(foundBinaryCharacter)
-                  {
-                    HTTPmsg__Types::HTTPRequest__binary__body& request_binary = msg.request__binary();
-                    request_binary.client__id() = OMIT_VALUE;
-                    request_binary.method() = CHARSTRING(method_name);
-                    request_binary.uri() = CHARSTRING(stext);
-                    request_binary.version__major() = version__major;
-                    request_binary.version__minor() = version__minor;
-                    request_binary.header() = header;
-                    request_binary.body() = body;
-                  }
-                  else
-                  {
-                    HTTPmsg__Types::HTTPRequest& request = msg.request();
-                    request.client__id() = OMIT_VALUE;
-                    request.method() = CHARSTRING(method_name);
-                    request.uri() = CHARSTRING(stext);
-                    request.version__major() = version__major;
-                    request.version__minor() = version__minor;
-                    request.header() = header;
-                    request.body() = oct2char(body);
-                  }
-                }
-                //incoming_message(msg); <- outer function calls if necessary
+                    more_data_needed = true;
             }
-            Free(method_name);
-            Free(stext);
+            break;
         }
-        break;
-    case BUFFER_CRLF:
-    case BUFFER_FAIL:
-        decoding_params.error = TRUE;
-    case FALSE:
-        decoding_params.isMessage = FALSE;
     }
 
     if(decoding_params.error)
     {
-
-        if(buffer->get_read_len() > 0)
-          msg.erronous__msg().msg() = CHARSTRING(buffer->get_read_len(), (const char*)buffer->get_read_data());
+        if(len > state->pos)
+          msg.erronous__msg().msg() = CHARSTRING(len - state->pos, (const char*)data + state->pos);
         else
           msg.erronous__msg().msg() = "The previous message is erronous.";
         msg.erronous__msg().client__id() = OMIT_VALUE;
-        //incoming_message(msg);
-        buffer->clear();
-        decoding_params.isMessage = TRUE;
+        //incoming_message(msg); <- outer function calls if necessary
+        cursor.pos = len;
+        state->reset();
+        return TRUE;
     }
 
-    if(decoding_params.isMessage)
+    if(!complete)
     {
-        buffer->cut();
+        // a partly received body is consumed from the buffer, everything else is kept
+        cursor.pos = state->phase == HTTP_PHASE_BODY ? len : state->pos;
+        return FALSE;
+    }
+
+    if(decoding_params.chunked_body)
+        HTTP_build_message(*state, data + state->body_start, state->body_length, msg);
+    else
+    {
+        HTTP_build_message(*state, data + state->pos, decoding_params.content_length, msg);
+        state->pos += decoding_params.content_length;
     }
+    TTCN_Logger::log(TTCN_DEBUG, "Message successfully decoded");
 
-    return decoding_params.isMessage;
+    cursor.pos = state->pos;
+    state->reset();
+    return TRUE;
 }
 
-void HTTP_decode_header(TTCN_Buffer* buffer, HTTPmsg__Types::HeaderLines& headers, Decoding_Params& decoding_params,
-    const bool socket_debugging, const bool resp, const char *test_port_type, const char *test_port_name)
+// Parses the request or status line, returns false if it is malformed
+bool HTTP_decode_start_line(const CHARSTRING& first, HTTP_Decoding_State& state)
 {
-    CHARSTRING cstr;
-    const char* separator;
-    char* header_name = NULL;
-    bool length_received = false;
+    const char *cc_first = (const char *)first;
+    const char* pos = strchr(cc_first, ' ');
+    if(pos == NULL)
+    {
+        TTCN_Logger::log(TTCN_DEBUG, "could not find space in the first line of response: <%s>", cc_first);
+        return false;
+    }
+
+    bool valid = true;
+    char* stext = (char*)Malloc(first.lengthof() + 1);
+    stext[0] = '\0';
+    state.method_name = CHARSTRING(pos - cc_first, cc_first);
 
-    for(int i = 0; ; i++)
+    TTCN_Logger::log(TTCN_DEBUG, "method_name: <%s>", (const char*)state.method_name);
+    if(strncasecmp(state.method_name, "HTTP/", 5) == 0)
     {
-        switch(get_line(buffer, cstr, true))
-        {
-        case TRUE:
-            {
-                char h[cstr.lengthof() + 1];
-                strcpy(h, (const char*)cstr);
-                separator = strchr(h, ':');
-                if(separator)
-                {
-                    header_name = (char*)Realloc(header_name, separator - h + 1);
-                    strncpy(header_name, h, separator - h);
-                    header_name[separator - h] = '\0';
-                    separator++;
-                    while(*separator && isspace(separator[0]))
-                        separator++;
-                    char* end = h + strlen(h);
-                    while(isspace((end - 1)[0]))
-                    {
-                        end--;
-                        *end = '\0';
-                    }
-                    headers[i] = HTTPmsg__Types::HeaderLine(header_name, separator);
-                    HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name, "+Header line: <%s: %s>", header_name, separator);
-
-                    if(!strcasecmp(header_name, "Content-Length"))
-                        { sscanf(separator, "%d", &decoding_params.content_length); length_received=true;}
-                    else if(!strcasecmp(header_name, "Connection") && !strcasecmp(separator, "close"))
-                        decoding_params.non_persistent_connection = TRUE;
-                    else if(!strcasecmp(header_name, "Connection") && !strcasecmp(separator, "keep-alive"))
-                        decoding_params.non_persistent_connection = FALSE;
-                    else if(!strcasecmp(header_name, "Transfer-Encoding") && !strcasecmp(separator, "chunked"))
-                        decoding_params.chunked_body = TRUE;
+        // The first line contains a response like HTTP/1.1 200 OK
+        state.isResponse = true;
+
+        if(sscanf(cc_first, "HTTP/%d.%d %d %[^\r]", &state.version__major, &state.version__minor,
+                  &state.statusCode, stext) < 3)
+            valid = false;
+        else if (state.version__minor == 0)
+            state.decoding_params.non_persistent_connection = TRUE;
+    }
+    else
+    {
+        state.isResponse = false;
+        // The first line contains a request
+        // like "POST / HTTP/1.0"
+        if(sscanf(pos + 1, "%s HTTP/%d.%d",
+                  stext, &state.version__major, &state.version__minor ) != 3)
+            valid = false;
+    }
+    state.stext = stext;
+    Free(stext);
+    return valid;
+}
 
-                }
-                continue;
-            }
-        case BUFFER_FAIL:
-            HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name, "BUFFER_FAIL in HTTP_decode_header!");
-            HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name, "whole bufer now: <%s>", (const char*)buffer->get_data());
-            log_to_hexa(buffer);
-            decoding_params.error = TRUE;
-        case FALSE:
-            decoding_params.isMessage = FALSE;
-        case BUFFER_CRLF:
-            break;
-        }
-        break;
+static const struct {
+    const char* name;
+    size_t length;
+    HTTP_Header_Id id;
+} well_known_headers[] = {
+    { "Content-Length", 14, HTTP_HEADER_CONTENT_LENGTH },
+    { "Transfer-Encoding", 17, HTTP_HEADER_TRANSFER_ENCODING },
+    { "Connection", 10, HTTP_HEADER_CONNECTION },
+    { "X-M2M-RSC", 9, HTTP_HEADER_X_M2M_RSC },
+    { "X-M2M-RI", 8, HTTP_HEADER_X_M2M_RI },
+    { "X-M2M-Origin", 12, HTTP_HEADER_X_M2M_ORIGIN }
+};
+
+HTTP_Header_Id HTTP_header_id(const char* name, size_t length)
+{
+    // the names have different lengths, so at most one of them has to be compared
+    for(size_t i = 0; i < sizeof(well_known_headers) / sizeof(well_known_headers[0]); i++)
+    {
+        if(well_known_headers[i].length == length)
+            return strncasecmp(name, well_known_headers[i].name, length) == 0 ? well_known_headers[i].id : HTTP_HEADER_OTHER;
     }
-    if(decoding_params.isMessage && !resp && !length_received && !decoding_params.chunked_body) decoding_params.content_length=0;
-    Free(header_name);
+    return HTTP_HEADER_OTHER;
 }
 
-void HTTP_decode_body(TTCN_Buffer* buffer, OCTETSTRING& body, Decoding_Params& decoding_params, const bool connection_closed,
+// Adds a header line to the decoded headers. Lines without a colon are skipped, but they still take an index.
+void HTTP_decode_header_line(const unsigned char* line, size_t length, HTTP_Decoding_State& state,
     const bool socket_debugging, const char *test_port_type, const char *test_port_name)
 {
-    if(buffer->get_read_len() > 0)
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "Decoding body, buffer length: %d", buffer->get_read_len());
-
-    if (decoding_params.chunked_body)
+    int index = state.header_index++;
+    // a '\0' can only get into a folded line, the line ends there like a C string
+    const unsigned char* nul = (const unsigned char*)memchr(line, '\0', length);
+    if(nul != NULL)
+        length = nul - line;
+    const unsigned char* separator = (const unsigned char*)memchr(line, ':', length);
+    if(separator == NULL)
+        return;
+
+    const unsigned char* value = separator + 1;
+    const unsigned char* end = line + length;
+    while(value < end && isspace(*value))
+        value++;
+    while(end > value && isspace(end[-1]))
+        end--;
+
+    HTTPmsg__Types::HeaderLine& header_line = state.header[index];
+    header_line.header__name() = CHARSTRING(separator - line, (const char*)line);
+    header_line.header__value() = CHARSTRING(end - value, (const char*)value);
+    const char* header_value = header_line.header__value();
+    HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name, "+Header line: <%s: %s>",
+        (const char*)header_line.header__name(), header_value);
+
+    switch(HTTP_header_id((const char*)line, separator - line))
     {
-        HTTP_decode_chunked_body(buffer, body, decoding_params, socket_debugging, test_port_type, test_port_name);
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "--------- After chunked body decoding:");
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "--------- non_persistent_connection: %s",  decoding_params.non_persistent_connection ? "yes" : "no");
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "--------- chunked_body: %s",  decoding_params.chunked_body ? "yes" : "no");
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "--------- content_length: %d",  decoding_params.content_length);
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "--------- error: %s",  decoding_params.error ? "yes" : "no");
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "--------- isMessage: %s",  decoding_params.isMessage ? "yes" : "no");
-
+    case HTTP_HEADER_CONTENT_LENGTH:
+        sscanf(header_value, "%d", &state.decoding_params.content_length);
+        state.length_received = true;
+        break;
+    case HTTP_HEADER_CONNECTION:
+        if(!strcasecmp(header_value, "close"))
+            state.decoding_params.non_persistent_connection = TRUE;
+        else if(!strcasecmp(header_value, "keep-alive"))
+            state.decoding_params.non_persistent_connection = FALSE;
+        break;
+    case HTTP_HEADER_TRANSFER_ENCODING:
+        if(!strcasecmp(header_value, "chunked"))
+            state.decoding_params.chunked_body = TRUE;
+        break;
+    default:
+        break;
     }
-    else if(decoding_params.content_length >= 0)
+}
+
+// Data of the cursor for moving chunks together. get_end() gives the buffer its own copy of the data
+// first, if it shares it with the OCTETSTRING it has been filled from. Data without a buffer is copied.
+unsigned char* HTTP_writable_data(HTTP_Read_Cursor& cursor)
+{
+    if(cursor.buffer == NULL)
     {
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "lengthof body: %d, content_length given: %d", buffer->get_read_len(), decoding_params.content_length);
-        if(buffer->get_read_len() >= (unsigned)decoding_params.content_length)
-        {
-            body = OCTETSTRING(decoding_params.content_length, buffer->get_read_data());
-            buffer->set_pos(buffer->get_pos() + decoding_params.content_length);
-        }
-        else
-        {
-            decoding_params.isMessage = FALSE;
-            HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "The decoder's body length %d is less than the Content_length in the message header %d; The HTTP port is waiting for additional data.", buffer->get_read_len(), decoding_params.content_length);
-            buffer->set_pos(buffer->get_pos() + buffer->get_read_len());
-        }
+        cursor.copy.put_s(cursor.len, cursor.data);
+        cursor.buffer = &cursor.copy;
     }
-    else if(connection_closed)
+    else
     {
-       /* if(buffer->get_read_len() >= 0)*/ // Always true
-        {
-            body = OCTETSTRING(buffer->get_read_len(), buffer->get_read_data());
-            buffer->set_pos(buffer->get_pos() + buffer->get_read_len());
-        }
-    } else {
-            decoding_params.isMessage = FALSE;
-            HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "The HTTP port is waiting for additional data.");
-            buffer->set_pos(buffer->get_pos() + buffer->get_read_len());
+        unsigned char* end_ptr;
+        size_t end_len = 0;
+        cursor.buffer->get_end(end_ptr, end_len);
     }
+    cursor.data = cursor.buffer->get_read_data();
+    return const_cast<unsigned char*>(cursor.data);
 }
 
-void HTTP_decode_chunked_body(TTCN_Buffer* buffer, OCTETSTRING& body, Decoding_Params& decoding_params,
-    const bool socket_debugging, const char *test_port_type, const char *test_port_name)
+// Position after the '\n' that may directly follow a chunk
+size_t HTTP_skip_chunk_lf(const unsigned char* data, size_t len, size_t pos)
 {
-    OCTETSTRING chunk;
-    CHARSTRING line;
-    unsigned int chunk_size = 1;
+    if(pos < len && data[pos] == '\n')
+        return pos + 1;
+    return pos;
+}
 
-    while(chunk_size > 0)
-    {
-        switch(get_line(buffer, line, false))
-        {
-            case TRUE:
-                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "line: <%s>", (const char*)line);
-                if(sscanf((const char *)line, "%x", &chunk_size) != 1)
-                {
-                    HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "No chunksize found");
-                    body = body + OCTETSTRING(line.lengthof(), (const unsigned char*)(const char*)line);
-                    chunk_size = 0;
-                    decoding_params.error = TRUE;
-                }
-                else
-                {
-                    if(chunk_size == 0)
-                    {
-                        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name, "chunk_size 0 -> closing chunk");
-                        if(get_line(buffer, line, false) == BUFFER_CRLF)
-                            HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "Trailing \\r\\n ok!");
-                        else
-                            TTCN_Logger::log(TTCN_WARNING,"Trailing \\r\\n after the closing chunk is not present, instead it is <%s>!", (const char*)line);
-                    }
-/*                    else if(chunk_size < 0) // the chunk_size is unsigned, never true
-                    {
-                        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "chunk_size less than 0");
-                        decoding_params.error = TRUE;
-                        chunk_size = 0;
-                    }*/
-                    else // chunk_size > 0
-                    {
-                        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "processing next chunk, size: %d", chunk_size);
-                        if(buffer->get_read_len() < chunk_size)
-                        {
-                            HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "chunk size is greater than the buffer length, more data is needed");
-                            decoding_params.isMessage = FALSE;
-                            chunk_size = 0;
-                        }
-                    }
-                }
-                break;
-            case FALSE:
-                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "buffer does not contain a whole line, more data is needed");
-                decoding_params.isMessage = FALSE;
-                chunk_size = 0;
-                break;
-            case BUFFER_CRLF:
-                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "beginning CRLF removed");
-                continue;
-            case BUFFER_FAIL:
-                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "BUFFER_FAIL");
-                decoding_params.error = FALSE;
-                chunk_size = 0;
-                break;
-            default:
-                decoding_params.isMessage = FALSE;
-                chunk_size = 0;
-                HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "more data is needed");
-        }
+// The body is given as a view into the receive buffer, it is copied once, directly into the message
+void HTTP_build_message(const HTTP_Decoding_State& state, const unsigned char* body, size_t body_length, HTTPmsg__Types::HTTPMessage& msg)
+{
+    bool foundBinaryCharacter = false;
 
-        body = body + OCTETSTRING(chunk_size, buffer->get_read_data());
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "pull %d bytes from %d", chunk_size, buffer->get_read_len());
-        buffer->set_pos(buffer->get_pos() + chunk_size);
-        // hack
-        if(buffer->get_read_len() && buffer->get_read_data()[0] == '\n')  // don't read from the buffer if there is nothing in it.
-        {
-            HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,"hack: adjusted buffer position after the '\\n'");
-            buffer->set_pos(buffer->get_pos() + 1);
-        }
-        HTTPmsg__Types::log_debug(socket_debugging, test_port_type, test_port_name,  "remaining data: <%s>, len: %d", (const char *)CHARSTRING(buffer->get_read_len(), (const char*)buffer->get_read_data()), buffer->get_read_len());
+    // a word at a time first, a non-ASCII byte has its top bit set
+    const unsigned long high_bits = ~0UL / 0xFF * 0x80;
+    size_t i = 0;
+    for(; i + sizeof(unsigned long) <= body_length; i += sizeof(unsigned long))
+    {
+        unsigned long word;
+        memcpy(&word, body + i, sizeof(word));
+        if(word & high_bits)
+            break;
+    }
+    for(; i < body_length && !foundBinaryCharacter; i++)
+    {
+        if(!isascii(body[i]))
+            foundBinaryCharacter = true;
+    }
+    if(foundBinaryCharacter)
+        TTCN_Logger::log(TTCN_DEBUG, "Binary data found");
+    if(state.isResponse)
+    {
+      if(foundBinaryCharacter)
+      {
+        HTTPmsg__Types::HTTPResponse__binary__body& response_binary = msg.response__binary();
+        response_binary.client__id() = OMIT_VALUE;
+        response_binary.version__major() = state.version__major;
+        response_binary.version__minor() = state.version__minor;
+        response_binary.statuscode() = state.statusCode;
+        response_binary.statustext() = state.stext;
+        response_binary.header() = state.header;
+        response_binary.body() = OCTETSTRING(body_length, body);
+      }
+      else
+      {
+        HTTPmsg__Types::HTTPResponse& response = msg.response();
+        response.client__id() = OMIT_VALUE;
+        response.version__major() = state.version__major;
+        response.version__minor() = state.version__minor;
+        response.statuscode() = state.statusCode;
+        response.statustext() = state.stext;
+        response.header() = state.header;
+        response.body() = CHARSTRING(body_length, (const char*)body);
+      }
+    }
+    else
+    {
+      if(foundBinaryCharacter)
+      {
+        HTTPmsg__Types::HTTPRequest__binary__body& request_binary = msg.request__binary();
+        request_binary.client__id() = OMIT_VALUE;
+        request_binary.method() = state.method_name;
+        request_binary.uri() = state.stext;
+        request_binary.version__major() = state.version__major;
+        request_binary.version__minor() = state.version__minor;
+        request_binary.header() = state.header;
+        request_binary.body() = OCTETSTRING(body_length, body);
+      }
+      else
+      {
+        HTTPmsg__Types::HTTPRequest& request = msg.request();
+        request.client__id() = OMIT_VALUE;
+        request.method() = state.method_name;
+        request.uri() = state.stext;
+        request.version__major() = state.version__major;
+        request.version__minor() = state.version__minor;
+        request.header() = state.header;
+        request.body() = CHARSTRING(body_length, (const char*)body);
+      }
     }
 }
 
-int get_line(TTCN_Buffer* buffer, CHARSTRING& to, const bool concatenate_header_lines)
+// First '\0', '\r' or '\n' at or after pos, or len if there is none
+static size_t HTTP_find_line_break(const unsigned char* data, size_t len, size_t pos)
 {
-    unsigned int i = 0;
-    const unsigned char *cc_to = buffer->get_read_data();
+    const unsigned char* begin = data + pos;
+    size_t n = len - pos;
+    const void* found;
+
+    // memchr is vectorized, and each search only has to cover the range before the previous hit
+    if((found = memchr(begin, '\n', n)) != NULL)
+        n = (const unsigned char*)found - begin;
+    if((found = memchr(begin, '\r', n)) != NULL)
+        n = (const unsigned char*)found - begin;
+    if((found = memchr(begin, '\0', n)) != NULL)
+        n = (const unsigned char*)found - begin;
+    return pos + n;
+}
 
-    if(!buffer->get_read_len())
-        return FALSE;
+int HTTP_find_line(const unsigned char* data, size_t len, size_t pos, const bool concatenate_header_lines,
+    const bool at_end, size_t& line_end, size_t& next)
+{
+    size_t i = pos;
 
     while(1)
     {
-        for( ; i < buffer->get_read_len() && cc_to[i] != '\0' && cc_to[i] != '\r' && cc_to[i] != '\n'; i++);
+        i = HTTP_find_line_break(data, len, i);
 
-        if(i >= buffer->get_read_len())
-        {
-            to = CHARSTRING("");
+        if(i >= len)
             return FALSE;
-        }
-        else
+
+        if(data[i] == '\n')
         {
-            if(cc_to[i] == '\n') {//
-              if(report_lf){
-                switch(HTTPmsg__Types::crlf__mode){
+            if(report_lf)
+            {
+                switch(HTTPmsg__Types::crlf__mode)
+                {
                   case HTTPmsg__Types::strict__crlf__mode::ERROR_:
                     return BUFFER_FAIL;
                     break;
@@ -1067,30 +1658,43 @@ int get_line(TTCN_Buffer* buffer, CHARSTRING& to, const bool concatenate_header_
                   default:
                     break;
                 }
-              }
-              if(i > 0 && (i + 1) < buffer->get_read_len() && concatenate_header_lines && (cc_to[i+1] == ' ' || cc_to[i+1] == '\t'))
+            }
+            if(i > pos && concatenate_header_lines)
+            {
+                if(i + 1 >= len && !at_end)
+                    return FALSE;
+                if(i + 1 < len && (data[i + 1] == ' ' || data[i + 1] == '\t'))
+                {
                     i += 1;
-                  else
-                  {
-                      to = CHARSTRING(i, (const char*)cc_to);
-                      buffer->set_pos(buffer->get_pos() + i + 1);
-                      return i == 0 ? BUFFER_CRLF : TRUE;
-                  }
-
-            } else
+                    continue;
+                }
+            }
+            line_end = i;
+            next = i + 1;
+        }
+        else
+        {
+            if(i + 1 >= len)
             {
-                if((i + 1) < buffer->get_read_len() && cc_to[i + 1] != '\n')
-                  return BUFFER_FAIL;
-                else if(i > 0 && (i + 2) < buffer->get_read_len() && concatenate_header_lines && (cc_to[i+2] == ' ' || cc_to[i+2] == '\t'))
-                  i += 2;
-                else
+                if(!at_end)
+                    return FALSE;
+            }
+            else if(data[i + 1] != '\n')
+                return BUFFER_FAIL;
+            if(i > pos && concatenate_header_lines)
+            {
+                if(i + 2 >= len && !at_end)
+                    return FALSE;
+                if(i + 2 < len && (data[i + 2] == ' ' || data[i + 2] == '\t'))
                 {
-                    to = CHARSTRING(i, (const char*)cc_to);
-                    buffer->set_pos(buffer->get_pos() + i + 2);
-                    return i == 0 ? BUFFER_CRLF : TRUE;
+                    i += 2;
+                    continue;
                 }
             }
+            line_end = i;
+            next = i + 2 < len ? i + 2 : len;
         }
+        return line_end == pos ? BUFFER_CRLF : TRUE;
     }
 }
 
@@ -1104,12 +1708,24 @@ void log_to_hexa(TTCN_Buffer* buffer)
     }
 }
 
+void log_to_hexa(const unsigned char* data, size_t len)
+{
+    for(size_t i = 0; i < len; i++)
+    {
+        TTCN_Logger::log_event(" %02X", data[i]);
+    }
+}
+
 
 const char* HTTPmsg__PT::local_port_name()              { return "";}
 const char* HTTPmsg__PT::remote_address_name()          { return "";}
 const char* HTTPmsg__PT::local_address_name()           { return "";}
 const char* HTTPmsg__PT::remote_port_name()             { return "";}
 const char* HTTPmsg__PT::use_notification_ASPs_name()   { return "use_notification_ASPs";}
+const char* HTTPmsg__PT::keep_alive_pool_name()         { return "keep_alive_pool";}
+const char* HTTPmsg__PT::keep_alive_idle_timeout_name() { return "keep_alive_idle_timeout";}
+const char* HTTPmsg__PT::max_requests_per_connection_name() { return "max_requests_per_connection";}
+const char* HTTPmsg__PT::max_pipelined_requests_name()  { return "max_pipelined_requests";}
 const char* HTTPmsg__PT::halt_on_connection_reset_name(){ return "";}
 const char* HTTPmsg__PT::server_mode_name()             { return "";}
 const char* HTTPmsg__PT::socket_debugging_name()        { return "http_debugging";}
@@ -1191,9 +1807,11 @@ void log_warning(const char *test_port_type, const char *test_port_name, const c
 *********************************************************/
 OCTETSTRING enc__HTTPMessage( const HTTPmsg__Types::HTTPMessage& msg ) {
   TTCN_Buffer buf;
-  buf.clear();
   HTTPmsg__PortType::f_HTTP_encodeCommon( msg, buf);
-  return OCTETSTRING(buf.get_len(), buf.get_data());
+  // the buffer is reserved at the exact size, get_string() can take over its memory
+  OCTETSTRING stream;
+  buf.get_string(stream);
+  return stream;
 }
 /*********************************************************
 * Function: dec__HTTPMessage
@@ -1224,26 +1842,24 @@ OCTETSTRING enc__HTTPMessage( const HTTPmsg__Types::HTTPMessage& msg ) {
 INTEGER dec__HTTPMessage(OCTETSTRING const& stream, HTTPMessage& msg, const BOOLEAN& socket_debugging =  dec__HTTPMessage_socket__debugging_defval )
 {
   TTCN_Logger::log(TTCN_DEBUG, "starting HTTPmsg__Types::dec__HTTPMessage");
-  TTCN_Buffer *buf_p = new TTCN_Buffer() ;
-  buf_p->put_os(stream);
-
-  int buf_len = buf_p->get_read_len();
+  // decoded from the memory of the stream, it is only copied for a body of several chunks
+  int buf_len = stream.lengthof();
   if( buf_len > 0)
   {
-      if(f_HTTP_decodeCommon(buf_p, msg, true, socket_debugging, NULL, NULL))
+      HTTP_Read_Cursor cursor((const unsigned char*)stream, buf_len);
+      if(HTTP_decode_message(cursor, msg, true, socket_debugging, NULL, NULL))
       {
-        log_debug(socket_debugging,"","","dec__HTTPMessage, after decoding:\nbuf_len: %d\nget_len: %d\nget_read_len:%d",
+        log_debug(socket_debugging,"","","dec__HTTPMessage, after decoding:\nbuf_len: %d\ndecoded: %d\nremaining:%d",
             buf_len,
-            buf_p->get_len(),
-            buf_p->get_read_len());
-        buf_len = buf_p->get_read_len(); //remaining data length
+            (int)cursor.pos,
+            buf_len - (int)cursor.pos);
+        buf_len -= cursor.pos; //remaining data length
       }
       else
         buf_len = -1;
 
 
   } else buf_len = -1;
-  delete buf_p;
   return buf_len;
 }
 
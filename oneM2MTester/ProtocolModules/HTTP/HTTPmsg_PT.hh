@@ -25,8 +25,14 @@
 #include "HTTPmsg_PortType.hh"
 #include "Abstract_Socket.hh"
 
+#include <vector>
+#include <deque>
+#include <string>
+
 #define BUFFER_FAIL 2
 #define BUFFER_CRLF 3
+// shortest body that outgoing_send() sends from the message instead of copying it after the head
+#define HTTP_SCATTER_MIN_BODY 4096
 //==============================
 namespace HTTPmsg__PortType {
 //==============================
@@ -38,6 +44,81 @@ typedef struct {
     bool isMessage;
 } Decoding_Params;
 
+// parts of an HTTP message handled by successive steps of f_HTTP_decodeCommon
+typedef enum {
+    HTTP_PHASE_START_LINE,
+    HTTP_PHASE_HEADERS,
+    HTTP_PHASE_BODY,
+    HTTP_PHASE_CHUNK_SIZE,
+    HTTP_PHASE_CHUNK_DATA,
+    HTTP_PHASE_CHUNK_TRAILER
+} HTTP_Decoding_Phase;
+
+// The already parsed part of an incomplete message, so that f_HTTP_decodeCommon can continue
+// where the previous call stopped instead of parsing the whole message again when data arrives.
+struct HTTP_Decoding_State {
+    HTTP_Decoding_State() : head_request(false) { reset(); }
+    void reset();
+
+    // set by the caller before each call: the next response answers a HEAD request, so it has no body
+    bool head_request;
+
+    HTTP_Decoding_Phase phase;
+    size_t pos;           // offset of the first unparsed byte from the start of the message
+    bool isResponse;
+    CHARSTRING method_name;
+    CHARSTRING stext;     // uri of a request, status text of a response
+    int version__major;
+    int version__minor;
+    int statusCode;
+    HTTPmsg__Types::HeaderLines header;
+    int header_index;
+    bool length_received;
+    size_t chunk_size;
+    Decoding_Params decoding_params;
+    // The chunks of a chunked body received so far are moved together in the buffer, right behind the
+    // first one, so the payload is copied only once more, into the message. Offsets from the message start.
+    size_t body_start;
+    size_t body_length;
+};
+
+// Received data that HTTP_decode_message() reads in place. After decoding, pos is the end of the decoded
+// message, or of the part of an incomplete message that does not have to be kept for the next call.
+// The chunks of a chunked body are moved together in buffer, if the data is held in one, or else in copy.
+struct HTTP_Read_Cursor {
+    HTTP_Read_Cursor(const unsigned char* p_data, size_t p_len) : data(p_data), len(p_len), pos(0), buffer(NULL) {}
+
+    const unsigned char* data;
+    size_t len;
+    size_t pos;
+    TTCN_Buffer* buffer;
+    TTCN_Buffer copy;
+};
+
+// Keep-alive and pipelining state of a connection. Requests may be sent without waiting for the responses,
+// which arrive in the same order, so the oldest pending request is the one the next response answers.
+struct HTTP_Connection_State {
+    HTTP_Connection_State() : open(false), requests_sent(0), closing(false), last_used(0.0) {}
+
+    bool open;
+    std::string pool_key;      // "scheme://host:port" if the connection belongs to the keep-alive pool of the port
+    std::deque<bool> pending;  // requests waiting for their response in sending order, true for HEAD
+    int requests_sent;
+    bool closing;              // no new requests on it, a pooled connection is closed after its last response
+    double last_used;          // time of the last request or response
+};
+
+// header names recognized by the decoder
+typedef enum {
+    HTTP_HEADER_OTHER,
+    HTTP_HEADER_CONTENT_LENGTH,
+    HTTP_HEADER_TRANSFER_ENCODING,
+    HTTP_HEADER_CONNECTION,
+    HTTP_HEADER_X_M2M_RSC,
+    HTTP_HEADER_X_M2M_RI,
+    HTTP_HEADER_X_M2M_ORIGIN
+} HTTP_Header_Id;
+
 #ifdef AS_USE_SSL
 class HTTPmsg__PT : public SSL_Socket, public HTTPmsg__PT_BASE {
 #else
@@ -70,6 +151,10 @@ protected:
     const char* local_address_name();
     const char* remote_port_name();
     const char* use_notification_ASPs_name();
+    const char* keep_alive_pool_name();
+    const char* keep_alive_idle_timeout_name();
+    const char* max_requests_per_connection_name();
+    const char* max_pipelined_requests_name();
     const char* halt_on_connection_reset_name();
     const char* server_mode_name();
     const char* socket_debugging_name();
@@ -100,6 +185,8 @@ protected:
     virtual bool remove_user_data(int client_id);
     virtual int  send_message_on_fd(int client_id, const unsigned char * message_buffer, int length_of_message);
     virtual int  send_message_on_nonblocking_fd(int client_id, const unsigned char * message_buffer, int length_of_message);
+    virtual int  send_message_on_fd_v(int client_id, const struct iovec* fragments, int fragment_count);
+    virtual int  send_message_on_nonblocking_fd_v(int client_id, const struct iovec* fragments, int fragment_count);
     virtual int  receive_message_on_fd(int client_id);
     virtual void client_connection_opened(int client_id);
     virtual void listen_port_opened(int port_number);    
@@ -118,6 +205,14 @@ protected:
     //void HTTP_decode_header(TTCN_Buffer*, HTTPmsg__Types::HeaderLines&,  Decoding_Params&); //moved outside the class
     //void HTTP_decode_body(TTCN_Buffer*, OCTETSTRING&, Decoding_Params&, const bool); //moved outside the class
     //void HTTP_decode_chunked_body(TTCN_Buffer*, OCTETSTRING&, Decoding_Params&);  //moved outside the class
+    HTTP_Decoding_State* get_decoding_state(int client_id);
+
+// keep-alive pool and pipelining
+    HTTP_Connection_State& get_connection_state(int client_id);
+    int get_pool_connection(const CHARSTRING& uri, const HTTPmsg__Types::HeaderLines& header);
+    void request_sent(int client_id, bool head_request);
+    void response_received(int client_id, const HTTPmsg__Types::HTTPMessage& msg);
+    void close_idle_pool_connections();
     
 private:
     void Handle_Fd_Event(int fd, boolean is_readable, boolean is_writable, boolean is_error);
@@ -131,24 +226,58 @@ private:
     bool server_use_ssl;
     
     bool use_notification_ASPs;
+
+    // decoding state of the connections, indexed by client_id
+    std::vector<HTTP_Decoding_State*> decoding_states;
+
+    // Requests without client_id are sent on a connection of the pool to the host of their Host header
+    // if keep_alive_pool is set, over SSL if their URI is an absolute https URI. Idle pooled connections are closed after keep_alive_idle_timeout seconds,
+    // or after max_requests_per_connection requests (0: no limit). At most max_pipelined_requests requests
+    // wait for a response on a pooled connection, a new one is opened if all of them are busy.
+    bool keep_alive_pool;
+    double keep_alive_idle_timeout;
+    int max_requests_per_connection;
+    int max_pipelined_requests;
+    bool adding_pool_connection;
+    bool pool_timer_set;
+
+    // indexed by client_id
+    std::vector<HTTP_Connection_State> connection_states;
 };
 //===================================
 //== Functions outside the class: ===
 //===================================
 void f_setClientId( HTTPmsg__Types::HTTPMessage& msg, const int client_id);
 void f_HTTP_encodeCommon(const HTTPmsg__Types::HTTPMessage& msg, TTCN_Buffer& buf);
+// Encodes only the start line and the header lines into head. body points into msg, so msg has to be kept
+// until the body is sent, e.g. as the second part of a scatter-gather write. A body shorter than
+// inline_body_limit is appended to head instead and body_length is set to 0.
+void f_HTTP_encodeHead(const HTTPmsg__Types::HTTPMessage& msg, TTCN_Buffer& head, const unsigned char*& body, size_t& body_length,
+    const size_t inline_body_limit = 0);
 bool f_HTTP_decodeCommon(TTCN_Buffer* buffer,HTTPmsg__Types::HTTPMessage& msg, const bool connection_closed,
-    const bool socket_debugging, const char *test_port_type, const char *test_port_name);
-int get_line(TTCN_Buffer* buffer, CHARSTRING& to, const bool concatenate_header_lines);
+    const bool socket_debugging, const char *test_port_type, const char *test_port_name, HTTP_Decoding_State* state = NULL);
+// Returns TRUE with the decoded message, or with an erronous message if all the data has been dropped,
+// FALSE if the message is incomplete
+bool HTTP_decode_message(HTTP_Read_Cursor& cursor, HTTPmsg__Types::HTTPMessage& msg, const bool connection_closed,
+    const bool socket_debugging, const char *test_port_type, const char *test_port_name, HTTP_Decoding_State* state = NULL);
+// Finds the line starting at pos. Returns TRUE or BUFFER_CRLF (empty line) with the end of the line and the
+// start of the next one, BUFFER_FAIL for a malformed line end and FALSE if the line is not complete yet.
+// Unless at_end is set, FALSE is also returned while the byte deciding about the line end is missing.
+int HTTP_find_line(const unsigned char* data, size_t len, size_t pos, const bool concatenate_header_lines,
+    const bool at_end, size_t& line_end, size_t& next);
+HTTP_Header_Id HTTP_header_id(const char* name, size_t length);
 void log_to_hexa(TTCN_Buffer*);
+void log_to_hexa(const unsigned char* data, size_t len);
 
-void HTTP_decode_header(TTCN_Buffer*, HTTPmsg__Types::HeaderLines&,  Decoding_Params&,const bool socket_debugging, const bool resp,const char *test_port_type, const char *test_port_name);
+bool HTTP_decode_start_line(const CHARSTRING& first, HTTP_Decoding_State& state);
 
-void HTTP_decode_body(TTCN_Buffer*, OCTETSTRING&, Decoding_Params&, const bool,
+void HTTP_decode_header_line(const unsigned char* line, size_t length, HTTP_Decoding_State& state,
     const bool socket_debugging, const char *test_port_type, const char *test_port_name);
 
-void HTTP_decode_chunked_body(TTCN_Buffer*, OCTETSTRING&, Decoding_Params&,
-    const bool socket_debugging, const char *test_port_type, const char *test_port_name);
+unsigned char* HTTP_writable_data(HTTP_Read_Cursor& cursor);
+size_t HTTP_skip_chunk_lf(const unsigned char* data, size_t len, size_t pos);
+
+void HTTP_build_message(const HTTP_Decoding_State& state, const unsigned char* body, size_t body_length, HTTPmsg__Types::HTTPMessage& msg);
 }//namespace
 
 //==============================
@@ -0,0 +1,295 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               HTTPmsg_codecCheck.cc
+//  Description:        Regression check and benchmark of the HTTP test port codec
+//  Rev:                R2I
+//
+//  Stand-alone program, not part of the test suite build (oneM2MTester.tpd).
+//  For every stream given on the command line it prints one line:
+//    <file name> dec=<dec_HTTPMessage> len=<f_HTTPMessage_len> msg=<hash> port=<hash>
+//  msg is an FNV-1a hash of the message decoded by dec_HTTPMessage and of its encoding by
+//  enc_HTTPMessage. port is a hash of the messages f_HTTP_decodeCommon gives for the stream the way
+//  the test port decodes a connection: the stream arrives at once, or in pieces of 1, 17 or 289
+//  bytes with the decoding state kept between them, then the connection is closed.
+//  http_corpus/expected.txt holds the lines of the recorded oneM2M exchanges (http_corpus/recorded)
+//  and of the 6000 streams of http_corpus/gen_http_corpus.py. A codec change that alters the result
+//  for any of them shows up in the diff. The TITAN runtime is replaced by the stand-ins in titan_stub.
+//
+//  With -b rounds, the time of dec_HTTPMessage + f_HTTPMessage_len + enc_HTTPMessage per stream and
+//  the heap allocations of each function are printed instead.
+//
+//  Build and run (Linux), from this directory:
+//    g++ -O2 -fpermissive -DLINUX -Ititan_stub -I.. -I../../../Lib/AbstractSocket -o HTTPmsg_codecCheck \
+//      HTTPmsg_codecCheck.cc titan_stub/TTCN3_stub.cc ../HTTPmsg_PT.cc ../HTTPmsg_MessageLen_Function.cc \
+//      ../../../Lib/AbstractSocket/Abstract_Socket.cc
+//    python3 http_corpus/gen_http_corpus.py /tmp/http_corpus
+//    LC_ALL=C sh -c "./HTTPmsg_codecCheck http_corpus/recorded/*.txt /tmp/http_corpus/*.txt" > /tmp/codecCheck.txt
+//    diff http_corpus/expected.txt /tmp/codecCheck.txt
+//    ./HTTPmsg_codecCheck -b 20000 http_corpus/recorded/*.txt
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include "HTTPmsg_PT.hh"
+#include "HTTPmsg_MessageLen.hh"
+
+using namespace HTTPmsg__Types;
+
+#if __cplusplus >= 201103L
+#define NOEXCEPT noexcept
+#else
+#define NOEXCEPT throw()
+#endif
+
+static long allocations = 0;
+
+void* operator new(size_t size)
+{
+    allocations++;
+    void* ptr = malloc(size ? size : 1);
+    if(ptr == NULL)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) NOEXCEPT
+{
+    free(ptr);
+}
+
+static double now()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static unsigned long long fnv1a(const std::string& data)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for(size_t i = 0; i < data.size(); i++)
+    {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static void add_int(std::string& text, const char* name, long long value)
+{
+    char buffer[64];
+    sprintf(buffer, " %s=%lld", name, value);
+    text += buffer;
+}
+
+static void add_header(std::string& text, const HeaderLines& header)
+{
+    for(int i = 0; i < header.size_of(); i++)
+        text += "\n" + header[i].header__name().value + ":" + header[i].header__value().value;
+}
+
+static void add_client_id(std::string& text, const OPTIONAL<INTEGER>& client_id)
+{
+    if(client_id.ispresent())
+        add_int(text, "client_id", (int)client_id());
+}
+
+// every field of the message, in one string
+static std::string message_text(const HTTPMessage& msg)
+{
+    std::string text;
+    switch(msg.get_selection())
+    {
+    case HTTPMessage::ALT_request:
+        text = "request " + msg.request().method().value + " " + msg.request().uri().value;
+        add_client_id(text, msg.request().client__id());
+        add_int(text, "major", (int)msg.request().version__major());
+        add_int(text, "minor", (int)msg.request().version__minor());
+        add_header(text, msg.request().header());
+        text += "\nbody:" + msg.request().body().value;
+        break;
+    case HTTPMessage::ALT_request__binary:
+        text = "request_binary " + msg.request__binary().method().value + " " + msg.request__binary().uri().value;
+        add_client_id(text, msg.request__binary().client__id());
+        add_int(text, "major", (int)msg.request__binary().version__major());
+        add_int(text, "minor", (int)msg.request__binary().version__minor());
+        add_header(text, msg.request__binary().header());
+        text += "\nbody:" + msg.request__binary().body().value;
+        break;
+    case HTTPMessage::ALT_response:
+        text = "response " + msg.response().statustext().value;
+        add_client_id(text, msg.response().client__id());
+        add_int(text, "status", (int)msg.response().statuscode());
+        add_int(text, "major", (int)msg.response().version__major());
+        add_int(text, "minor", (int)msg.response().version__minor());
+        add_header(text, msg.response().header());
+        text += "\nbody:" + msg.response().body().value;
+        break;
+    case HTTPMessage::ALT_response__binary:
+        text = "response_binary " + msg.response__binary().statustext().value;
+        add_client_id(text, msg.response__binary().client__id());
+        add_int(text, "status", (int)msg.response__binary().statuscode());
+        add_int(text, "major", (int)msg.response__binary().version__major());
+        add_int(text, "minor", (int)msg.response__binary().version__minor());
+        add_header(text, msg.response__binary().header());
+        text += "\nbody:" + msg.response__binary().body().value;
+        break;
+    case HTTPMessage::ALT_erronous__msg:
+        text = "erronous_msg " + msg.erronous__msg().msg().value;
+        add_client_id(text, msg.erronous__msg().client__id());
+        break;
+    default:
+        text = "unbound";
+    }
+    return text + "\n--\n";
+}
+
+// decodes the stream like the test port decodes a connection, piece_size 0 gives it at once
+static std::string port_text(const std::string& stream, size_t piece_size)
+{
+    TTCN_Buffer buffer;
+    HTTPmsg__PortType::HTTP_Decoding_State state;
+    std::string text;
+
+    if(piece_size == 0)
+        piece_size = stream.size();
+    for(size_t pos = 0; pos < stream.size(); pos += piece_size)
+    {
+        size_t length = stream.size() - pos < piece_size ? stream.size() - pos : piece_size;
+        buffer.put_s(length, (const unsigned char*)stream.data() + pos);
+        while(buffer.get_read_len() > 0)
+        {
+            HTTPMessage msg;
+            if(!HTTPmsg__PortType::f_HTTP_decodeCommon(&buffer, msg, false, false, NULL, NULL, &state))
+                break;
+            text += message_text(msg);
+        }
+    }
+    text += "closed\n";
+    while(buffer.get_read_len() > 0)
+    {
+        HTTPMessage msg;
+        if(!HTTPmsg__PortType::f_HTTP_decodeCommon(&buffer, msg, true, false, NULL, NULL, &state))
+            break;
+        text += message_text(msg);
+    }
+    return text;
+}
+
+static bool read_stream(const char* file_name, OCTETSTRING& stream)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    if(!file.is_open())
+    {
+        fprintf(stderr, "cannot open %s\n", file_name);
+        return false;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    stream.value = content.str();
+    return true;
+}
+
+static const char* base_name(const char* file_name)
+{
+    const char* slash = strrchr(file_name, '/');
+    return slash != NULL ? slash + 1 : file_name;
+}
+
+static void check(const char* file_name, const OCTETSTRING& stream)
+{
+    HTTPMessage msg;
+    int dec_result = (int)dec__HTTPMessage(stream, msg, false);
+    int len_result = (int)HTTPmsg__MessageLen::f__HTTPMessage__len(stream);
+
+    std::string msg_text;
+    if(dec_result >= 0)
+    {
+        msg_text = message_text(msg);
+        if(msg.get_selection() != HTTPMessage::ALT_erronous__msg)
+            msg_text += enc__HTTPMessage(msg).value;
+    }
+
+    static const size_t piece_sizes[] = { 0, 1, 17, 289 };
+    std::string port;
+    for(size_t i = 0; i < sizeof(piece_sizes) / sizeof(piece_sizes[0]); i++)
+        port += port_text(stream.value, piece_sizes[i]);
+
+    printf("%s dec=%d len=%d msg=%016llx port=%016llx\n", base_name(file_name), dec_result, len_result,
+        fnv1a(msg_text), fnv1a(port));
+}
+
+static void bench(const char* file_name, const OCTETSTRING& stream, int rounds)
+{
+    long sum = 0;
+    double start = now();
+    for(int round = 0; round < rounds; round++)
+    {
+        HTTPMessage msg;
+        sum += (int)dec__HTTPMessage(stream, msg, false);
+        sum += (int)HTTPmsg__MessageLen::f__HTTPMessage__len(stream);
+        if(msg.get_selection() != HTTPMessage::UNBOUND_VALUE && msg.get_selection() != HTTPMessage::ALT_erronous__msg)
+            sum += enc__HTTPMessage(msg).lengthof();
+    }
+    double elapsed = now() - start;
+
+    HTTPMessage msg;
+    long dec_allocations = allocations;
+    dec__HTTPMessage(stream, msg, false);
+    dec_allocations = allocations - dec_allocations;
+    long len_allocations = allocations;
+    HTTPmsg__MessageLen::f__HTTPMessage__len(stream);
+    len_allocations = allocations - len_allocations;
+    long enc_allocations = allocations;
+    if(msg.get_selection() != HTTPMessage::UNBOUND_VALUE && msg.get_selection() != HTTPMessage::ALT_erronous__msg)
+        enc__HTTPMessage(msg);
+    enc_allocations = allocations - enc_allocations;
+
+    printf("%-36s %6d B  %7.2f us per dec+len+enc  allocations dec %ld len %ld enc %ld  (check %ld)\n",
+        base_name(file_name), stream.lengthof(), elapsed / rounds * 1e6, dec_allocations, len_allocations, enc_allocations, sum);
+}
+
+int main(int argc, char** argv)
+{
+    int rounds = 0;
+    int first = 1;
+    if(argc > 2 && strcmp(argv[1], "-b") == 0)
+    {
+        rounds = atoi(argv[2]);
+        first = 3;
+    }
+    if(first >= argc || (first == 3 && rounds <= 0))
+    {
+        fprintf(stderr, "usage: %s [-b rounds] stream...\n", argv[0]);
+        return 1;
+    }
+
+    for(int i = first; i < argc; i++)
+    {
+        OCTETSTRING stream;
+        if(!read_stream(argv[i], stream))
+            return 1;
+        if(rounds > 0)
+            bench(argv[i], stream, rounds);
+        else
+            check(argv[i], stream);
+    }
+    return 0;
+}
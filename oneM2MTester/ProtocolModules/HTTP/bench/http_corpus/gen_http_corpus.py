@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2017  Korea Electronics Technology Institute.
+# All rights reserved. This program and the accompanying materials
+# are made available under the terms of
+# - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),
+# - BSD-3 Clause Licence(http://www.iotocean.org/license/).
+#
+#  File:               gen_http_corpus.py
+#  Description:        Generates the random HTTP streams used to check the HTTP test port codec
+#                      (HTTPmsg_codecCheck.cc)
+#  Rev:                R2I
+#
+#  Usage: gen_http_corpus.py output_dir [count (6000)]
+#  The generator is seeded once, so the corpus is the same on every run with the same count.
+#  A stream holds one message, two pipelined messages or a truncated message. The messages mix
+#  requests and responses, Content-Length, chunked and unframed bodies, with broken start lines,
+#  bare CR or LF line ends, folded and malformed header lines, odd Content-Length values, chunk
+#  sizes with extensions or garbage, and trailers.
+
+import os
+import random
+import sys
+
+
+def eol():
+    return random.choice(['\r\n'] * 12 + ['\n', '\r', '\rx'])
+
+
+def body(n):
+    return ''.join(random.choice('abc{}":\r\n ') for _ in range(n))
+
+
+def headers(cl=None, te=None):
+    h = []
+    for _ in range(random.randint(0, 3)):
+        h.append(random.choice(['Host: x', 'X-M2M-RI: 1234', 'Accept:application/json', 'NoColonHere',
+                                'Content-Type : a/b', 'Connection: close']))
+    if cl is not None:
+        v = random.choice([str(cl)] * 8 + [' %d ' % cl, '+%d' % cl, '%d junk' % cl, 'abc', '-3', '0%d' % cl,
+                                           '99999999999'])
+        name = random.choice(['Content-Length'] * 6 + ['content-length', 'CONTENT-LENGTH', 'Content-Length ',
+                                                       'Content-Lengthx'])
+        if random.random() < 0.1:
+            h.append(name + ':' + eol() + ' ' + v)
+        else:
+            h.append(name + ': ' + v)
+    if te:
+        v = random.choice(['chunked'] * 6 + ['Chunked', 'chunked ', 'gzip, chunked', 'identity'])
+        name = random.choice(['Transfer-Encoding'] * 6 + ['transfer-encoding'])
+        if random.random() < 0.1:
+            h.append(name + ':\r\n\t' + v)
+        else:
+            h.append(name + ': ' + v)
+    random.shuffle(h)
+    return ''.join(x + eol() for x in h)
+
+
+def chunks():
+    s = ''
+    for _ in range(random.randint(0, 4)):
+        n = random.randint(1, 40)
+        size = random.choice(['%x' % n] * 6 + ['%X' % n, '0x%x' % n, ' %x' % n, '%x;ext=1' % n, 'zz', '%x ' % n])
+        s += size + eol() + body(n) + random.choice(['\r\n'] * 8 + ['\n', ''])
+    s += random.choice(['0', '00', '0;x', '0x0']) + eol()
+    s += random.choice(['\r\n'] * 6 + ['Trailer: 1\r\n\r\n', '\n', 'X'])
+    return s
+
+
+def message():
+    if random.random() < 0.5:
+        first = random.choice(['GET /a HTTP/1.1', 'POST /cse?x=1 HTTP/1.1', 'GET  /a  HTTP/1.0', 'GET /a HTTP/1', 'GET',
+                               'PUT /x http/1.1', 'DELETE / HTTP/ 1. 1', ' GET / HTTP/1.1', 'GET /a HTTP/1.1 extra'])
+    else:
+        first = random.choice(['HTTP/1.1 200 OK', 'HTTP/1.1 201 Created', 'HTTP/1.0 200 OK', 'HTTP/1.1 204 No Content',
+                               'HTTP/1.1 304 NM', 'HTTP/1.1 100 Continue', 'http/1.1 200 OK', 'HTTP/1.1200 OK',
+                               'HTTP/1.1 abc', 'HTTP/1.1 404', 'HTTPx 200'])
+    kind = random.choice(['cl', 'cl', 'chunk', 'none'])
+    n = random.randint(0, 60)
+    if kind == 'cl':
+        return first + eol() + headers(cl=n) + eol() + body(n)
+    if kind == 'chunk':
+        return first + eol() + headers(te=True) + eol() + chunks()
+    return first + eol() + headers() + eol() + (body(n) if random.random() < 0.3 else '')
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit('usage: gen_http_corpus.py output_dir [count]')
+    output_dir = sys.argv[1]
+    count = int(sys.argv[2]) if len(sys.argv) > 2 else 6000
+    if not os.path.isdir(output_dir):
+        os.makedirs(output_dir)
+
+    random.seed(11)
+    for i in range(count):
+        s = message()
+        r = random.random()
+        if r < 0.3:
+            s += message()
+        elif r < 0.4:
+            s = s[:random.randint(0, len(s))]
+        with open(os.path.join(output_dir, 'm%05d.txt' % i), 'w', newline='') as f:
+            f.write(s)
+
+
+if __name__ == '__main__':
+    main()
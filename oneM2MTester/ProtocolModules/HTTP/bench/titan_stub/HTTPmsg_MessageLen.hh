@@ -0,0 +1,32 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               HTTPmsg_MessageLen.hh
+//  Description:        Minimal stand-in for the header TITAN generates from HTTPmsg_MessageLen.ttcn,
+//                      for the programs in ProtocolModules/HTTP/bench
+//  Rev:                R2I
+
+#ifndef HTTPMSG_MESSAGELEN_STUB_HH
+#define HTTPMSG_MESSAGELEN_STUB_HH
+
+#include "Socket_API_Definitions.hh"
+
+namespace HTTPmsg__MessageLen {
+
+INTEGER f__HTTPMessage__len(OCTETSTRING const& stream);
+INTEGER f__HTTPMessage__getMsgLen(OCTETSTRING const& stream, Socket__API__Definitions::ro__integer& args);
+
+}
+
+#endif
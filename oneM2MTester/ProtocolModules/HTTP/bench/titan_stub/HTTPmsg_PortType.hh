@@ -0,0 +1,42 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               HTTPmsg_PortType.hh
+//  Description:        Minimal stand-in for the header TITAN generates from HTTPmsg_PortType.ttcn,
+//                      for the programs in ProtocolModules/HTTP/bench
+//  Rev:                R2I
+//
+//  The messages the port would pass to the test are dropped.
+
+#ifndef HTTPMSG_PORTTYPE_STUB_HH
+#define HTTPMSG_PORTTYPE_STUB_HH
+
+#include "HTTPmsg_Types.hh"
+
+namespace HTTPmsg__PortType {
+
+class HTTPmsg__PT_BASE : public PORT {
+public:
+    HTTPmsg__PT_BASE(const char* name) : PORT(name) {}
+    void incoming_message(const HTTPmsg__Types::HTTPMessage&) {}
+    void incoming_message(const HTTPmsg__Types::Close&) {}
+    void incoming_message(const HTTPmsg__Types::Half__close&) {}
+    void incoming_message(const HTTPmsg__Types::Connect__result&) {}
+    void incoming_message(const HTTPmsg__Types::Client__connected&) {}
+    void incoming_message(const HTTPmsg__Types::Listen__result&) {}
+};
+
+}
+
+#endif
@@ -0,0 +1,130 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               HTTPmsg_Types.hh
+//  Description:        Minimal stand-in for the header TITAN generates from HTTPmsg_Types.ttcn,
+//                      for the programs in ProtocolModules/HTTP/bench
+//  Rev:                R2I
+
+#ifndef HTTPMSG_TYPES_STUB_HH
+#define HTTPMSG_TYPES_STUB_HH
+
+#include <TTCN3.hh>
+
+#define HTTP_STUB_FIELD(type, name) \
+    type m_##name; \
+    type& name() { return m_##name; } \
+    const type& name() const { return m_##name; }
+
+namespace HTTPmsg__Types {
+
+struct strict__crlf__mode { enum enum_type { ERROR_, WARNING, WARNING__ONCE, ACCEPT }; };
+extern strict__crlf__mode::enum_type crlf__mode;
+
+struct HeaderLine {
+    HTTP_STUB_FIELD(CHARSTRING, header__name)
+    HTTP_STUB_FIELD(CHARSTRING, header__value)
+};
+typedef RECORD_OF<HeaderLine> HeaderLines;
+
+struct HTTPResponse {
+    HTTP_STUB_FIELD(OPTIONAL<INTEGER>, client__id)
+    HTTP_STUB_FIELD(INTEGER, version__major)
+    HTTP_STUB_FIELD(INTEGER, version__minor)
+    HTTP_STUB_FIELD(INTEGER, statuscode)
+    HTTP_STUB_FIELD(CHARSTRING, statustext)
+    HTTP_STUB_FIELD(HeaderLines, header)
+    HTTP_STUB_FIELD(CHARSTRING, body)
+};
+
+struct HTTPRequest {
+    HTTP_STUB_FIELD(OPTIONAL<INTEGER>, client__id)
+    HTTP_STUB_FIELD(CHARSTRING, method)
+    HTTP_STUB_FIELD(CHARSTRING, uri)
+    HTTP_STUB_FIELD(INTEGER, version__major)
+    HTTP_STUB_FIELD(INTEGER, version__minor)
+    HTTP_STUB_FIELD(HeaderLines, header)
+    HTTP_STUB_FIELD(CHARSTRING, body)
+};
+
+struct HTTPResponse__binary__body {
+    HTTP_STUB_FIELD(OPTIONAL<INTEGER>, client__id)
+    HTTP_STUB_FIELD(INTEGER, version__major)
+    HTTP_STUB_FIELD(INTEGER, version__minor)
+    HTTP_STUB_FIELD(INTEGER, statuscode)
+    HTTP_STUB_FIELD(CHARSTRING, statustext)
+    HTTP_STUB_FIELD(HeaderLines, header)
+    HTTP_STUB_FIELD(OCTETSTRING, body)
+};
+
+struct HTTPRequest__binary__body {
+    HTTP_STUB_FIELD(OPTIONAL<INTEGER>, client__id)
+    HTTP_STUB_FIELD(CHARSTRING, method)
+    HTTP_STUB_FIELD(CHARSTRING, uri)
+    HTTP_STUB_FIELD(INTEGER, version__major)
+    HTTP_STUB_FIELD(INTEGER, version__minor)
+    HTTP_STUB_FIELD(HeaderLines, header)
+    HTTP_STUB_FIELD(OCTETSTRING, body)
+};
+
+struct HTTP__erronous__msg {
+    HTTP_STUB_FIELD(OPTIONAL<INTEGER>, client__id)
+    HTTP_STUB_FIELD(CHARSTRING, msg)
+};
+
+#define HTTP_STUB_ALTERNATIVE(type, name) \
+    type m_##name; \
+    type& name() { selection = ALT_##name; return m_##name; } \
+    const type& name() const { if(selection != ALT_##name) TTCN_error("Using non-selected field " #name "."); return m_##name; }
+
+struct HTTPMessage {
+    enum union_selection_type { UNBOUND_VALUE, ALT_request, ALT_response, ALT_erronous__msg, ALT_request__binary, ALT_response__binary };
+    union_selection_type selection;
+    HTTPMessage() : selection(UNBOUND_VALUE) {}
+    union_selection_type get_selection() const { return selection; }
+    HTTP_STUB_ALTERNATIVE(HTTPRequest, request)
+    HTTP_STUB_ALTERNATIVE(HTTPResponse, response)
+    HTTP_STUB_ALTERNATIVE(HTTP__erronous__msg, erronous__msg)
+    HTTP_STUB_ALTERNATIVE(HTTPRequest__binary__body, request__binary)
+    HTTP_STUB_ALTERNATIVE(HTTPResponse__binary__body, response__binary)
+};
+
+struct Close { HTTP_STUB_FIELD(OPTIONAL<INTEGER>, client__id) };
+struct Half__close { HTTP_STUB_FIELD(OPTIONAL<INTEGER>, client__id) };
+struct Connect {
+    HTTP_STUB_FIELD(CHARSTRING, hostname)
+    HTTP_STUB_FIELD(INTEGER, portnumber)
+    HTTP_STUB_FIELD(BOOLEAN, use__ssl)
+};
+struct Connect__result { HTTP_STUB_FIELD(INTEGER, client__id) };
+struct Client__connected {
+    HTTP_STUB_FIELD(CHARSTRING, hostname)
+    HTTP_STUB_FIELD(INTEGER, portnumber)
+    HTTP_STUB_FIELD(INTEGER, client__id)
+};
+struct Listen {
+    HTTP_STUB_FIELD(OPTIONAL<CHARSTRING>, local__hostname)
+    HTTP_STUB_FIELD(INTEGER, portnumber)
+    HTTP_STUB_FIELD(BOOLEAN, use__ssl)
+};
+struct Listen__result { HTTP_STUB_FIELD(INTEGER, portnumber) };
+struct Shutdown {};
+
+extern const BOOLEAN dec__HTTPMessage_socket__debugging_defval;
+OCTETSTRING enc__HTTPMessage(const HTTPMessage& msg);
+INTEGER dec__HTTPMessage(OCTETSTRING const& stream, HTTPMessage& msg, const BOOLEAN& socket_debugging);
+
+}
+
+#endif
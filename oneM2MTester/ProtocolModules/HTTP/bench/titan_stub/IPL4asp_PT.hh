@@ -0,0 +1,36 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               IPL4asp_PT.hh
+//  Description:        Minimal stand-in for the IPL4 test port header, for the programs in ProtocolModules/HTTP/bench
+//  Rev:                R2I
+//
+//  Only the registration of native message length calculators is provided, it is a no-op here.
+
+#ifndef IPL4ASP_PT_STUB_HH
+#define IPL4ASP_PT_STUB_HH
+
+#include "Socket_API_Definitions.hh"
+
+namespace IPL4asp__PortType {
+
+typedef int (*NativeGetMsgLen)(const unsigned char* data, size_t len, Socket__API__Definitions::ro__integer& args);
+
+struct NativeGetMsgLenRegistrar {
+    NativeGetMsgLenRegistrar(Socket__API__Definitions::f__getMsgLen::function_pointer, NativeGetMsgLen) {}
+};
+
+}
+
+#endif
@@ -0,0 +1,41 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               Socket_API_Definitions.hh
+//  Description:        Minimal stand-in for the header TITAN generates from Socket_API_Definitions.ttcn,
+//                      for the programs in ProtocolModules/HTTP/bench
+//  Rev:                R2I
+
+#ifndef SOCKET_API_DEFINITIONS_STUB_HH
+#define SOCKET_API_DEFINITIONS_STUB_HH
+
+#include <TTCN3.hh>
+
+namespace Socket__API__Definitions {
+
+struct ro__integer {
+    std::vector<INTEGER> elements;
+    int size_of() const { return (int)elements.size(); }
+    void set_size(int size) { elements.resize(size); }
+    INTEGER& operator[](int i) { return elements[i]; }
+    const INTEGER& operator[](int i) const { return elements[i]; }
+};
+
+struct f__getMsgLen {
+    typedef INTEGER (*function_pointer)(const OCTETSTRING&, ro__integer&);
+};
+
+}
+
+#endif
@@ -0,0 +1,182 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               TTCN3.hh
+//  Description:        Minimal stand-in for the TITAN runtime header, for the programs in ProtocolModules/HTTP/bench
+//  Rev:                R2I
+//
+//  Only what HTTPmsg_PT.cc, HTTPmsg_MessageLen_Function.cc and Abstract_Socket.cc use is provided, so that
+//  the HTTP codec can be built and checked without a TITAN installation. The event handler of PORT does
+//  nothing, the programs only call the codec. Log messages go to stderr if STUBLOG is set.
+
+#ifndef TTCN3_STUB_HH
+#define TTCN3_STUB_HH
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <strings.h>
+
+typedef bool boolean;
+#define TRUE true
+#define FALSE false
+
+enum null_type { NULL_VALUE };
+enum omit_type { OMIT_VALUE };
+
+enum { TTCN_DEBUG, TTCN_WARNING, TTCN_ERROR, TTCN_USER, TTCN_PORTEVENT };
+
+struct TTCN_Logger {
+    static void log(int severity, const char* fmt, ...);
+    static bool log_this_event(int severity) { return severity != TTCN_DEBUG || getenv("STUBLOG") != NULL; }
+    static void begin_event(int severity);
+    static void log_event(const char* fmt, ...);
+    static void log_event_str(const char* str);
+    static void log_event_va_list(const char* fmt, va_list args);
+    static void log_char(char c);
+    static void end_event();
+};
+
+void TTCN_error(const char* fmt, ...) __attribute__((noreturn));
+void TTCN_warning(const char* fmt, ...);
+
+void* Malloc(size_t size);
+void* Realloc(void* ptr, size_t size);
+void Free(void* ptr);
+char* mprintf(const char* fmt, ...);
+char* mprintf_va_list(const char* fmt, va_list args);
+char* mputprintf(char* str, const char* fmt, ...);
+char* mputstr(char* str, const char* suffix);
+char* mcopystr(const char* str);
+
+struct BOOLEAN {
+    bool value;
+    BOOLEAN(bool v = false) : value(v) {}
+    operator bool() const { return value; }
+};
+
+struct INTEGER {
+    long long value;
+    INTEGER(int v = 0) : value(v) {}
+    INTEGER(long long v) : value(v) {}
+    operator int() const { return (int)value; }
+    bool is_native() const { return true; }
+    long long get_long_long_val() const { return value; }
+};
+
+struct CHARSTRING {
+    std::string value;
+    CHARSTRING() {}
+    CHARSTRING(const char* v) : value(v != NULL ? v : "") {}
+    CHARSTRING(int length, const char* v) : value(v, length) {}
+    CHARSTRING(char c) : value(1, c) {}
+    int lengthof() const { return (int)value.size(); }
+    operator const char*() const { return value.c_str(); }
+    CHARSTRING operator+(const CHARSTRING& other) const { CHARSTRING r; r.value = value + other.value; return r; }
+    CHARSTRING operator+(const char* other) const { CHARSTRING r; r.value = value + other; return r; }
+    CHARSTRING& operator+=(const CHARSTRING& other) { value += other.value; return *this; }
+    bool operator==(const char* other) const { return value == other; }
+    bool operator!=(const char* other) const { return value != other; }
+    bool operator==(const CHARSTRING& other) const { return value == other.value; }
+};
+
+inline CHARSTRING operator+(const char* a, const CHARSTRING& b) { CHARSTRING r; r.value = std::string(a) + b.value; return r; }
+
+struct OCTETSTRING {
+    std::string value;
+    OCTETSTRING() {}
+    OCTETSTRING(int length, const unsigned char* v) : value((const char*)v, length) {}
+    int lengthof() const { return (int)value.size(); }
+    operator const unsigned char*() const { return (const unsigned char*)value.data(); }
+    OCTETSTRING operator+(const OCTETSTRING& other) const { OCTETSTRING r; r.value = value + other.value; return r; }
+};
+
+inline CHARSTRING oct2char(const OCTETSTRING& o) { return CHARSTRING(o.lengthof(), o.value.data()); }
+inline OCTETSTRING char2oct(const CHARSTRING& c) { return OCTETSTRING(c.lengthof(), (const unsigned char*)c.value.data()); }
+CHARSTRING int2str(const INTEGER& i);
+
+template<typename T> struct OPTIONAL {
+    bool present;
+    T value;
+    OPTIONAL() : present(false) {}
+    OPTIONAL(const T& v) : present(true), value(v) {}
+    bool ispresent() const { return present; }
+    T& operator()() { present = true; return value; }
+    const T& operator()() const { if(!present) TTCN_error("Using the value of an omitted field."); return value; }
+    OPTIONAL& operator=(const T& v) { present = true; value = v; return *this; }
+    OPTIONAL& operator=(omit_type) { present = false; return *this; }
+};
+
+template<typename T> struct RECORD_OF {
+    std::vector<T> elements;
+    RECORD_OF() {}
+    RECORD_OF(null_type) {}
+    RECORD_OF& operator=(null_type) { elements.clear(); return *this; }
+    int size_of() const { return (int)elements.size(); }
+    int lengthof() const { return (int)elements.size(); }
+    T& operator[](int i) { if(i >= (int)elements.size()) elements.resize(i + 1); return elements[i]; }
+    const T& operator[](int i) const { return elements[i]; }
+};
+
+class TTCN_Buffer {
+    std::vector<unsigned char> data;
+    size_t len, pos;
+    void ensure(size_t size) { if(data.size() < size) data.resize(size < 2 * data.size() ? 2 * data.size() : size); }
+public:
+    TTCN_Buffer() : len(0), pos(0) {}
+    void clear() { len = 0; pos = 0; }
+    void put_s(size_t n, const unsigned char* p) { ensure(len + n); if(n) memcpy(&data[0] + len, p, n); len += n; }
+    void put_os(const OCTETSTRING& o) { put_s(o.value.size(), (const unsigned char*)o.value.data()); }
+    void put_cs(const CHARSTRING& c) { put_s(c.value.size(), (const unsigned char*)c.value.data()); }
+    void put_c(unsigned char c) { put_s(1, &c); }
+    size_t get_len() const { return len; }
+    const unsigned char* get_data() const { return data.empty() ? (const unsigned char*)"" : &data[0]; }
+    size_t get_read_len() const { return len - pos; }
+    const unsigned char* get_read_data() const { return get_data() + pos; }
+    void rewind() { pos = 0; }
+    size_t get_pos() const { return pos; }
+    void set_pos(size_t p) { pos = p < len ? p : len; }
+    void cut() { if(pos) memmove(&data[0], &data[0] + pos, len - pos); len -= pos; pos = 0; }
+    void get_end(unsigned char*& p, size_t& l) { ensure(len + (l ? l : 1)); p = &data[0] + len; l = data.size() - len; }
+    void increase_length(size_t n) { len += n; }
+    void get_string(OCTETSTRING& o) const { o.value.assign((const char*)get_data(), len); }
+};
+
+struct TTCN_Snapshot {
+    static void block_for_sending(int, void* = 0) {}
+    static void take_new(bool) {}
+    static double time_now();
+};
+
+class PORT {
+public:
+    PORT(const char* name) : port_name(name != NULL ? name : "port") {}
+    virtual ~PORT() {}
+    const char* get_name() const { return port_name; }
+    virtual void Handle_Fd_Event(int, boolean, boolean, boolean) {}
+    virtual void Handle_Timeout(double) {}
+    void Handler_Add_Fd_Read(int) {}
+    void Handler_Add_Fd_Write(int) {}
+    void Handler_Remove_Fd_Read(int) {}
+    void Handler_Remove_Fd_Write(int) {}
+    void Handler_Remove_Fd(int) {}
+    void Handler_Set_Timer(double, boolean = TRUE, boolean = TRUE, boolean = TRUE) {}
+    void Uninstall_Handler() {}
+    const char* port_name;
+};
+
+#endif
@@ -0,0 +1,162 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               TTCN3_stub.cc
+//  Description:        Functions of the TITAN stand-ins, for the programs in ProtocolModules/HTTP/bench
+//  Rev:                R2I
+//
+//  TTCN_error() aborts, warnings are counted in stub_warnings and printed if STUBLOG is set.
+
+#include <sys/time.h>
+#include <string>
+#include "HTTPmsg_Types.hh"
+
+int stub_warnings = 0;
+
+static int event_severity;
+static std::string event_text;
+
+static bool stub_log() { return getenv("STUBLOG") != NULL; }
+
+void TTCN_Logger::log(int severity, const char* fmt, ...)
+{
+    if(severity == TTCN_WARNING)
+        stub_warnings++;
+    if(!stub_log())
+        return;
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+void TTCN_Logger::begin_event(int severity)
+{
+    event_severity = severity;
+    event_text.clear();
+}
+
+void TTCN_Logger::log_event(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    log_event_va_list(fmt, args);
+    va_end(args);
+}
+
+void TTCN_Logger::log_event_str(const char* str) { event_text += str; }
+
+void TTCN_Logger::log_event_va_list(const char* fmt, va_list args)
+{
+    char* str = mprintf_va_list(fmt, args);
+    event_text += str;
+    free(str);
+}
+
+void TTCN_Logger::log_char(char c) { event_text += c; }
+
+void TTCN_Logger::end_event()
+{
+    if(event_severity == TTCN_WARNING)
+        stub_warnings++;
+    if(stub_log() || event_severity == TTCN_ERROR)
+        fprintf(stderr, "%s\n", event_text.c_str());
+}
+
+void TTCN_error(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "Dynamic test case error: ");
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+    abort();
+}
+
+void TTCN_warning(const char* fmt, ...)
+{
+    stub_warnings++;
+    if(!stub_log())
+        return;
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+void* Malloc(size_t size) { return malloc(size ? size : 1); }
+void* Realloc(void* ptr, size_t size) { return realloc(ptr, size ? size : 1); }
+void Free(void* ptr) { free(ptr); }
+
+char* mprintf_va_list(const char* fmt, va_list args)
+{
+    char* str;
+    if(vasprintf(&str, fmt, args) < 0)
+        abort();
+    return str;
+}
+
+char* mprintf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    char* str = mprintf_va_list(fmt, args);
+    va_end(args);
+    return str;
+}
+
+char* mcopystr(const char* str) { return strdup(str != NULL ? str : ""); }
+
+char* mputstr(char* str, const char* suffix)
+{
+    if(str == NULL)
+        return mcopystr(suffix);
+    size_t length = strlen(str);
+    str = (char*)realloc(str, length + strlen(suffix) + 1);
+    strcpy(str + length, suffix);
+    return str;
+}
+
+char* mputprintf(char* str, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    char* suffix = mprintf_va_list(fmt, args);
+    va_end(args);
+    str = mputstr(str, suffix);
+    free(suffix);
+    return str;
+}
+
+CHARSTRING int2str(const INTEGER& i)
+{
+    char buffer[32];
+    sprintf(buffer, "%lld", i.value);
+    return CHARSTRING(buffer);
+}
+
+double TTCN_Snapshot::time_now()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+namespace HTTPmsg__Types {
+    strict__crlf__mode::enum_type crlf__mode = strict__crlf__mode::WARNING__ONCE; // default of HTTPmsg_Types.ttcn
+    const BOOLEAN dec__HTTPMessage_socket__debugging_defval = false;
+}
@@ -10,20 +10,25 @@
 ******************************************************************************/
 
 #include "Mqtt_v3_1_1_IPL4SizeFunction.hh"
+#include "IPL4asp_PT.hh"
 
 
 namespace Mqtt__v3__1__1__IPL4SizeFunction {
 
-INTEGER f__calc__MQTT__length(const OCTETSTRING& data){
+// Length of the MQTT message at the start of data, -1 if its fixed header is not complete yet or wrong
+static int calc_MQTT_length(const unsigned char* data, size_t len){
     
-    int multiplier, value, i, j;
-    i = 0; // encoded byte
+    int multiplier, value, j;
+    size_t i = 0; // encoded byte
     j = 2; // additional real size
     multiplier = 1;
     value = 0;
     do {
         i++;
-        value += (oct2int(data[i]) & 127) * multiplier + j;
+        if (i >= len){
+            return -1; // the remaining length has not been received yet
+        }
+        value += (data[i] & 127) * multiplier + j;
         multiplier *= 128;
         if (multiplier > 128*128*128){
             if(TTCN_Logger::log_this_event(LOG_ALL)){
@@ -34,9 +39,21 @@ INTEGER f__calc__MQTT__length(const OCTETSTRING& data){
             return -1; //error case, bigger than the MQTT limit
         }
 	j = 1;
-    }while((oct2int(data[i]) & 128) != 0);
+    }while((data[i] & 128) != 0);
 
   return value;
 }
 
+// Native message length calculator of the IPL4 test port
+static int MQTT_getMsgLen(const unsigned char* data, size_t len, Socket__API__Definitions::ro__integer& /*args*/){
+  return calc_MQTT_length(data, len);
+}
+
+INTEGER f__calc__MQTT__length(const OCTETSTRING& data){
+  return calc_MQTT_length((const unsigned char*)data, data.lengthof());
+}
+
+// f_IPL4_setGetMsgLen installs MQTT_getMsgLen instead of f_GetMsgLengthMQTT
+static IPL4asp__PortType::NativeGetMsgLenRegistrar native_getMsgLen_registrar(f__GetMsgLengthMQTT, MQTT_getMsgLen);
+
 }
@@ -25,17 +25,27 @@
 #include <vector>
 
 namespace OneM2M__DualFaceMapping {
+	// names and namespaces of the XML primitive content
+	extern const char* XML_NAMESPACE;
+	extern const char* NAMESPACE_TAG;
+	extern const char* RESOURCE_NAME;
+	extern const char* PRIMITIVE_CONTENT;
+	extern const char* XSI;
+	extern const char* XSI_TAG;
+
 	bool initial_mapping();
-	std::string getShortName(std::string long_name);
-	std::string getLongName(std::string short_name);
+	const char* getShortName(const char* long_name);
+	const char* getShortName(const std::string& long_name);
+	const char* getLongName(const char* short_name);
+	const char* getLongName(const std::string& short_name);
 	std::vector<std::string> split(const std::string &s, char delim);
-	bool long_to_short_name_mapping(const char* file_path, const std::string mapping_tag);
 	void DeepClone(tinyxml2::XMLNode *newNode, const tinyxml2::XMLNode *nodeSrc, tinyxml2::XMLDocument *DocDest, const tinyxml2::XMLNode *parent);
 
 	void DeepParser(tinyxml2::XMLElement* pRootElem, tinyxml2::XMLDocument* xmlDoclone, tinyxml2::XMLElement* pRootElemClone, tinyxml2::XMLElement* pDestParent);
 	void DeepParserDec(tinyxml2::XMLElement* pRootElem, tinyxml2::XMLDocument* xmlDoclone, tinyxml2::XMLElement* pRootElemClone, tinyxml2::XMLElement* pDestParent);
-	Json::Value JSONDeepParser(Json::Value jsonSrc, Json::Value jsonObjClone, Json::Value jsonParent);
-	Json::Value JSONDeepParserDec(Json::Value jsonSrc, Json::Value jsonObjClone, Json::Value jsonTarget);
+	// the recursive Json parsers add their result to the object passed as second argument
+	void JSONDeepParser(const Json::Value& jsonSrc, Json::Value& jsonObjClone);
+	void JSONDeepParserDec(const Json::Value& jsonSrc, Json::Value& jsonObjClone);
 
 	/**********************************************************
 	 * Parser functions will be here for all oneM2M resources *
@@ -45,15 +55,15 @@ namespace OneM2M__DualFaceMapping {
 
 	// 1. AccessControlPolicy
 	CHARSTRING acp_JSON_Enc_Parser(const CHARSTRING& p__source);
-	Json::Value acp_JSON_Enc_Parser_Deep (Json::Value objectSource, Json::Value objectRoot, Json::Value elemName);
+	void acp_JSON_Enc_Parser_Deep (const Json::Value& objectSource, Json::Value& objectRoot, const Json::Value& elemName);
 
 	// 2. Subscription
 	CHARSTRING sub_JSON_Enc_Parser(const CHARSTRING& p__source);
-	Json::Value sub_JSON_Enc_Parser_Deep(Json::Value objectSource, Json::Value objectRoot, Json::Value elemName);
+	void sub_JSON_Enc_Parser_Deep(const Json::Value& objectSource, Json::Value& objectRoot, const Json::Value& elemName);
 
 	/******* Decoding functions *******/
 
 	// 1. Notification
 	CHARSTRING noti_JSON_Dec_Parser(const CHARSTRING& source_str, const CHARSTRING& serial_type);
-	Json::Value noti_JSON_Dec_Parser_Deep(Json::Value objectSource, Json::Value objectRoot, Json::Value elemName);
+	void noti_JSON_Dec_Parser_Deep(const Json::Value& objectSource, Json::Value& objectRoot, const Json::Value& elemName);
 }
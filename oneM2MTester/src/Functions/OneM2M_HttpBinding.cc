@@ -0,0 +1,405 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_HttpBinding.cc
+//  Description:        Mapping between oneM2M primitives and HTTP messages for the dual face ports
+//  Rev:                R2I
+
+#include <stdio.h>
+#include "HTTPmsg_PT.hh"
+#include "OneM2M_DualFaceMapping.hh"
+
+using HTTPmsg__PortType::HTTP_header_id;
+
+namespace OneM2M__DualFaceMapping {
+
+	static void put_int(TTCN_Buffer& buf, int value) {
+		char digits[16];
+		buf.put_s(snprintf(digits, sizeof(digits), "%d", value), (const unsigned char*)digits);
+	}
+
+	static void put_header(TTCN_Buffer& buf, const CHARSTRING& name) {
+		buf.put_cs(name);
+		buf.put_s(2, (const unsigned char*)": ");
+	}
+
+	static void end_line(TTCN_Buffer& buf) {
+		buf.put_s(2, (const unsigned char*)"\r\n");
+	}
+
+	/**
+	 * @desc Writes the target path of the request, the same as f_adressingFormatChecker and f_adressingFormatter
+	 *       give: CSE-relative addresses get a leading '/', SP-relative ones "/~" and absolute ones have their
+	 *       leading '/' replaced by "/_"
+	 */
+	static void put_target(TTCN_Buffer& buf, const OneM2M__Types::RequestPrimitive& request) {
+		if(!request.to_().is_bound()) {
+			buf.put_cs("{UNINITIALIZED}");
+			return;
+		}
+
+		TTCN_Buffer to;
+		request.to_().encode_utf8(to, false);
+		const unsigned char* to_data = to.get_data();
+		size_t to_length = to.get_len();
+
+		if(to_length >= 2 && to_data[0] == '/' && to_data[1] == '/') {
+			buf.put_s(2, (const unsigned char*)"/_");
+			buf.put_s(to_length - 1, to_data + 1);
+
+			if(request.primitiveContent().ispresent() &&
+					request.primitiveContent()().get_selection() == OneM2M__Types::PrimitiveContent::ALT_aE &&
+					OneM2M__Pixits::PX__ADDRESSING__METHOD == OneM2M__Types::AddressingMethod::e__nonHierarchical) {
+				buf.put_c('/');
+				OneM2M__Pixits::PX__CSE__RESOURCE__ID.encode_utf8(buf, false);
+			}
+		} else if(to_length > 0 && to_data[0] == '/') {
+			buf.put_s(2, (const unsigned char*)"/~");
+			buf.put_s(to_length, to_data);
+		} else {
+			buf.put_c('/');
+			buf.put_s(to_length, to_data);
+		}
+	}
+
+	// labels as f_extract_from_string(ttcn2string(labels)) wrote them: comma separated, without quotes, braces, backslashes and spaces
+	static void put_labels(TTCN_Buffer& buf, const OneM2M__Types::Labels& labels) {
+		TTCN_Buffer label;
+
+		for(int i = 0; i < labels.size_of(); i++) {
+			if(i > 0) {
+				buf.put_c(',');
+			}
+			label.clear();
+			labels[i].encode_utf8(label, false);
+
+			const unsigned char* data = label.get_data();
+			for(size_t j = 0; j < label.get_len(); j++) {
+				if(data[j] != '"' && data[j] != '{' && data[j] != '}' && data[j] != '\\' && data[j] != ' ') {
+					buf.put_c(data[j]);
+				}
+			}
+		}
+	}
+
+	/**
+	 * @desc Writes the query string of the request. The separators are the ones the TTCN-3 mapping used,
+	 *       so "?fu=" follows "?rcn=" and the discovery parameters always start with '&'.
+	 */
+	static void put_query(TTCN_Buffer& buf, const OneM2M__Types::RequestPrimitive& request, int operation) {
+		if(request.resultContent().ispresent()) {
+			buf.put_cs("?rcn=");
+			put_int(buf, request.resultContent()().as_int());
+		}
+
+		if(!request.filterCriteria().ispresent()) {
+			return;
+		}
+
+		const OneM2M__Types::FilterCriteria& filter = request.filterCriteria()();
+
+		if(filter.filterUsage().ispresent() && operation == 2) {
+			int filter_usage = filter.filterUsage()().as_int();
+			if(filter_usage == 1 || filter_usage == 2) {
+				buf.put_cs("?fu=");
+				put_int(buf, filter_usage);
+			}
+		}
+
+		if(request.discoveryResultType().ispresent()) {
+			int discovery_result_type = request.discoveryResultType()().as_int();
+			if(discovery_result_type == 1 || discovery_result_type == 2) {
+				buf.put_cs("&drt=");
+				put_int(buf, discovery_result_type);
+			}
+		}
+
+		if(filter.labels().ispresent()) {
+			buf.put_cs("&lbl=");
+			put_labels(buf, filter.labels()());
+		}
+
+		if(filter.expireBefore().ispresent()) {
+			buf.put_cs("&exb=");
+			filter.expireBefore()().encode_utf8(buf, false);
+		}
+
+		if(filter.expireAfter().ispresent()) {
+			buf.put_cs("&exa=");
+			filter.expireAfter()().encode_utf8(buf, false);
+		}
+	}
+
+	/**
+	 * @desc Renders a request primitive as an HTTP request in one buffer: request line with the target path and
+	 *       query, Host, Accept, X-M2M-Origin and X-M2M-RI, and for CREATE and UPDATE the Content-Type (with
+	 *       ty= for CREATE), Content-Length and the body. The header lines are the ones of the t_HTTP_*_request
+	 *       templates.
+	 * @p__reqPrimitive: request to send
+	 * @p__serialization__type: lowercase serialization of the payload
+	 * @p__payload: serialized primitive content, only sent for CREATE and UPDATE
+	 * return encoded HTTP request
+	 */
+	OCTETSTRING f__enc__M2MPrimitive__to__HTTP(const OneM2M__Types::RequestPrimitive& p__reqPrimitive,
+			const CHARSTRING& p__serialization__type, const CHARSTRING& p__payload) {
+		int operation = p__reqPrimitive.operation().as_int();
+		bool has_body = (operation == 1 || operation == 3);
+		TTCN_Buffer buf;
+
+		switch(operation) {
+		case 1:
+			buf.put_cs(OneM2M__Constants::POST__HTTP);
+			break;
+		case 2:
+			buf.put_cs(OneM2M__Constants::GET__HTTP);
+			break;
+		case 3:
+			buf.put_cs(OneM2M__Constants::PUT__HTTP);
+			break;
+		case 4:
+			buf.put_cs(OneM2M__Constants::DELETE__HTTP);
+			break;
+		default:
+			TTCN_error("f_enc_M2MPrimitive_to_HTTP: Not supported operation type %d", operation);
+		}
+
+		buf.put_c(' ');
+		put_target(buf, p__reqPrimitive);
+		put_query(buf, p__reqPrimitive, operation);
+		buf.put_cs(" HTTP/1.1");
+		end_line(buf);
+
+		const OneM2M__Constants::ConnectionParams& connection = OneM2M__Constants::tsp__connectionParams;
+		put_header(buf, OneM2M__Constants::HTTP__HOST);
+		buf.put_cs(connection.remHost());
+		buf.put_c(':');
+		put_int(buf, (int)connection.remPort());
+		end_line(buf);
+
+		put_header(buf, OneM2M__Constants::HTTP__ACCEPT);
+		buf.put_cs(OneM2M__Constants::ACCEPT__BASE);
+		buf.put_cs(p__serialization__type);
+		end_line(buf);
+
+		put_header(buf, OneM2M__Constants::HTTP__M2M__ORIGIN);
+		if(p__reqPrimitive.from_().ispresent()) {
+			if(p__reqPrimitive.from_()() == "UnknowOriginator") {
+				buf.put_c('C');
+			}
+			p__reqPrimitive.from_()().encode_utf8(buf, false);
+		}
+		end_line(buf);
+
+		put_header(buf, OneM2M__Constants::HTTP__M2M__REQUEST__ID);
+		if(p__reqPrimitive.requestIdentifier().is_bound()) {
+			p__reqPrimitive.requestIdentifier().encode_utf8(buf, false);
+		}
+		end_line(buf);
+
+		if(has_body) {
+			put_header(buf, OneM2M__Constants::HTTP__CONTENT__TYPE);
+			buf.put_cs(OneM2M__Constants::CONTENT__TYPE__BASE);
+			buf.put_cs(p__serialization__type);
+			if(operation == 1) {
+				buf.put_cs(";ty=");
+				put_int(buf, p__reqPrimitive.resourceType()().as_int());
+			}
+			end_line(buf);
+
+			put_header(buf, OneM2M__Constants::HTTP__CONTENT__LENGTH);
+			put_int(buf, p__payload.lengthof());
+			end_line(buf);
+		}
+		end_line(buf);
+
+		if(has_body) {
+			buf.put_cs(p__payload);
+		}
+
+		// get_string() hands the memory of the buffer over instead of copying the request
+		OCTETSTRING stream;
+		buf.get_string(stream);
+		return stream;
+	}
+
+	/**
+	 * @desc Decodes primitive content converted by f__primitiveContent__Dec with the TITAN codec of the serialization
+	 * return the result of the TITAN decoder, 0 if the serialization has none
+	 */
+	static int decode_primitive_content(const CHARSTRING& encoded, const CHARSTRING& serial_type, OneM2M__Types::PrimitiveContent& content) {
+		if(serial_type == OneM2M__Constants::JSON__SERIAL) {
+			return (int)OneM2M__Primitive__EncDec::f__dec__JSON__resourcePrimitive(char2oct(encoded), content);
+		}
+		if(serial_type == OneM2M__Constants::XML__SERIAL) {
+			return (int)OneM2M__Primitive__EncDec::f__dec__XER__resourcePrimitive(char2oct(encoded), content);
+		}
+		return 0;
+	}
+
+	// fields of the response primitive that are not carried by the HTTP response
+	static void set_response_fields(OneM2M__Types::ResponsePrimitive& response) {
+		response.to_() = OneM2M__Pixits::PX__AE1__ID__STEM;
+		response.from_() = OneM2M__Pixits::PX__CSE__NAME;
+		response.originatingTimestamp() = OMIT_VALUE;
+		response.resultExpirationTimestamp() = OMIT_VALUE;
+		response.eventCategory() = OMIT_VALUE;
+	}
+
+	/**
+	 * @desc Maps a received HTTP response to a response primitive. The body is only decoded for a successful
+	 *       response status code.
+	 * return 0 on success, 1 if the primitive content could not be decoded
+	 */
+	static int map_http_response(const HTTPmsg__Types::HTTPResponse& http_response, const CHARSTRING& serial_type,
+			OneM2M__Types::ResponsePrimitive& response) {
+		const HTTPmsg__Types::HeaderLines& headers = http_response.header();
+		bool enable_rsp_decode = true;
+
+		for(int i = 0; i < headers.size_of(); i++) {
+			const CHARSTRING& name = headers[i].header__name();
+			const CHARSTRING& value = headers[i].header__value();
+
+			switch(HTTP_header_id((const char*)name, name.lengthof())) {
+			case HTTPmsg__PortType::HTTP_HEADER_X_M2M_RSC:
+				if(!(value == OneM2M__Constants::RSC__OK || value == OneM2M__Constants::RSC__CREATED ||
+						value == OneM2M__Constants::RSC__UPDATED || value == OneM2M__Constants::RSC__DELETED)) {
+					enable_rsp_decode = false;
+				}
+				response.responseStatusCode().int2enum((int)str2int(value));
+				break;
+			case HTTPmsg__PortType::HTTP_HEADER_X_M2M_RI:
+				response.requestIdentifier() = value;
+				break;
+			default:
+				break;
+			}
+		}
+
+		set_response_fields(response);
+
+		const CHARSTRING& body = http_response.body();
+		if(body.lengthof() == 0 || serial_type.lengthof() == 0 || !enable_rsp_decode) {
+			if(body.lengthof() > 0 && !enable_rsp_decode) {
+				TTCN_Logger::log(TTCN_DEBUG, "[ERROR]ERROR HTTP MESSAGE!!");
+			}
+			response.primitiveContent() = OMIT_VALUE;
+			return 0;
+		}
+
+		CHARSTRING encoded(f__primitiveContent__Dec(body, serial_type, ""));
+		if(encoded.lengthof() == 0) {
+			TTCN_Logger::log(TTCN_DEBUG, "[Decoding Parsing ERROR]f_primitiveContent_Dec(): PrimitiveContent object parsing failed!!");
+			response.primitiveContent() = OMIT_VALUE;
+			return 0;
+		}
+		return decode_primitive_content(encoded, serial_type, response.primitiveContent()()) == 0 ? 0 : 1;
+	}
+
+	/**
+	 * @desc Maps a received HTTP request (a notification) to a request primitive and remembers its connection
+	 *       for the responses sent on mcaPortIn
+	 * return 0 on success, 1 if the primitive content could not be decoded
+	 */
+	static int map_http_request(const HTTPmsg__Types::HTTPRequest& http_request, const INTEGER& connection_id,
+			const CHARSTRING& serial_type, OneM2M__Types::RequestPrimitive& request) {
+		const HTTPmsg__Types::HeaderLines& headers = http_request.header();
+
+		for(int i = 0; i < headers.size_of(); i++) {
+			const CHARSTRING& name = headers[i].header__name();
+			if(HTTP_header_id((const char*)name, name.lengthof()) == HTTPmsg__PortType::HTTP_HEADER_X_M2M_RI) {
+				request.requestIdentifier() = headers[i].header__value();
+			}
+		}
+
+		/* Only the fields needed to tell notifications from AE testing are set,
+		   the others are given fixed values */
+		request.operation() = OneM2M__Types::Operation::int5;
+		request.from_() = OMIT_VALUE;
+		request.to_() = "Mobius";
+		request.role() = OMIT_VALUE;
+		request.resourceType() = OMIT_VALUE;
+		request.originatingTimestamp() = OMIT_VALUE;
+		request.requestExpirationTimestamp() = OMIT_VALUE;
+		request.resultExpirationTimestamp() = OMIT_VALUE;
+		request.operationExecutionTime() = OMIT_VALUE;
+		request.responseType() = OMIT_VALUE;
+		request.resultPersistence() = OMIT_VALUE;
+		request.resultContent() = OMIT_VALUE;
+		request.eventCategory() = OMIT_VALUE;
+		request.deliveryAggregation() = OMIT_VALUE;
+		request.groupRequestIdentifier() = OMIT_VALUE;
+		request.filterCriteria() = OMIT_VALUE;
+		request.discoveryResultType() = OMIT_VALUE;
+
+		f__setConId__mcaPortIn(connection_id);
+
+		const CHARSTRING& body = http_request.body();
+		if(body.lengthof() == 0 || serial_type.lengthof() == 0) {
+			return 0;
+		}
+
+		CHARSTRING encoded(f__primitiveContent__Dec(body, serial_type, "noti_received"));
+		if(encoded.lengthof() == 0) {
+			TTCN_Logger::log(TTCN_DEBUG, "[Decoding Parsing ERROR]f_primitiveContent_Dec(): PrimitiveContent object parsing failed!!");
+			return 0;
+		}
+
+		if(serial_type == OneM2M__Constants::XML__SERIAL) {
+			// XML notifications are only checked, their content is not handed over
+			OneM2M__Types::PrimitiveContent unused;
+			return decode_primitive_content(encoded, serial_type, unused) == 0 ? 0 : 1;
+		}
+		return decode_primitive_content(encoded, serial_type, request.primitiveContent()()) == 0 ? 0 : 1;
+	}
+
+	/**
+	 * @desc Decodes a message received on an HTTP bound port into a request or response primitive, mapping
+	 *       the X-M2M header lines and the body in one pass
+	 * @p__stream: received octets
+	 * @p__connId: connection the message was received on
+	 * @p__serialization__type: lowercase serialization of the body, "" to leave the body undecoded
+	 * @p__msgIn: decoded primitive
+	 * return 0 on success, -1 if the HTTP message could not be decoded (p__msgIn holds a response primitive
+	 *        without status code and content), 1 if the primitive content could not be decoded
+	 */
+	INTEGER f__dec__HTTP__to__M2MPrimitive(const OCTETSTRING& p__stream, const INTEGER& p__connId,
+			const CHARSTRING& p__serialization__type, OneM2M__Types::MsgIn& p__msgIn) {
+		HTTPmsg__Types::HTTPMessage http_msg;
+		int result = 0;
+
+		p__msgIn.clean_up();
+
+		if(HTTPmsg__Types::dec__HTTPMessage(p__stream, http_msg, HTTPmsg__Types::tsp__socket__debugging) != 0) {
+			TTCN_Logger::log(TTCN_DEBUG, "[ERROR]dec_HTTPMessage(): fail to decode HTTP message!!");
+			OneM2M__Types::ResponsePrimitive& response = p__msgIn.primitive().responsePrimitive();
+			set_response_fields(response);
+			response.primitiveContent() = OMIT_VALUE;
+			result = -1;
+		} else {
+			switch(http_msg.get_selection()) {
+			case HTTPmsg__Types::HTTPMessage::ALT_response:
+				result = map_http_response(http_msg.response(), p__serialization__type, p__msgIn.primitive().responsePrimitive());
+				break;
+			case HTTPmsg__Types::HTTPMessage::ALT_request:
+				result = map_http_request(http_msg.request(), p__connId, p__serialization__type, p__msgIn.primitive().requestPrimitive());
+				break;
+			default:
+				TTCN_error("f_dec_HTTP_to_M2MPrimitive: received HTTP message has a binary body or could not be parsed");
+			}
+		}
+
+		p__msgIn.nullFields() = OMIT_VALUE;
+		return result;
+	}
+}
@@ -0,0 +1,2124 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_JsonStream.cc
+//  Description:        Streaming JSON tokenizer, writer and long/short name transcoders of the
+//                      oneM2M dual face mapping, used instead of the Json::Value based parsers
+//  Rev:                R2I
+
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "OneM2M_JsonStream.hh"
+#include "OneM2M_MappingArena.hh"
+#include "OneM2M_NameMapping.hh"
+#include "External_function.hh"
+
+namespace OneM2M__DualFaceMapping {
+
+	enum {
+		EXPECT_VALUE, EXPECT_FIRST_MEMBER, EXPECT_MEMBER_SEPARATOR, EXPECT_FIRST_ELEMENT, EXPECT_ELEMENT_SEPARATOR,
+		EXPECT_END, EXPECT_NOTHING
+	};
+
+	static const size_t MAX_NESTING = 1000; // same limit as Json::Reader
+	static const size_t STYLED_RIGHT_MARGIN = 74; // Json::StyledWriter::rightMargin_
+	static const size_t STYLED_INDENT_SIZE = 3; // Json::StyledWriter::indentSize_
+
+	static inline bool isDigit(char c) {
+		return c >= '0' && c <= '9';
+	}
+
+	static inline bool nameIs(const char* name, size_t length, const char* literal) {
+		return strlen(literal) == length && memcmp(name, literal, length) == 0;
+	}
+
+	/**
+	 * @desc key order of Json::Value objects, which the DOM parsers iterate in
+	 */
+	static int compareKeys(const JSONTokenizer::Token& a, const JSONTokenizer::Token& b) {
+		int comp = memcmp(a.text, b.text, a.length < b.length ? a.length : b.length);
+
+		if(comp != 0) {
+			return comp;
+		}
+		return a.length < b.length ? -1 : (a.length > b.length ? 1 : 0);
+	}
+
+	JSONTokenizer::JSONTokenizer(const char* input) : pos(input), stack_depth(0), expect(EXPECT_VALUE) {
+	}
+
+	void JSONTokenizer::skipWhitespace() {
+		while(*pos == ' ' || *pos == '\t' || *pos == '\n' || *pos == '\r') {
+			pos++;
+		}
+	}
+
+	JSONTokenizer::Token JSONTokenizer::fail() {
+		Token token;
+
+		token.type = TOKEN_ERROR;
+		token.text = pos;
+		token.length = 0;
+		token.escaped = false;
+		token.integral = false;
+		expect = EXPECT_NOTHING;
+		return token;
+	}
+
+	JSONTokenizer::Token JSONTokenizer::next() {
+		Token token;
+
+		token.text = NULL;
+		token.length = 0;
+		token.escaped = false;
+		token.integral = false;
+
+		skipWhitespace();
+
+		switch(expect) {
+		case EXPECT_VALUE:
+			if(readValue(token)) {
+				return token;
+			}
+			break;
+		case EXPECT_FIRST_MEMBER:
+		case EXPECT_MEMBER_SEPARATOR:
+			if(*pos == '}') {
+				pos++;
+				pop();
+				token.type = TOKEN_OBJECT_END;
+				return token;
+			}
+			if(expect == EXPECT_MEMBER_SEPARATOR) {
+				if(*pos != ',') {
+					break;
+				}
+				pos++;
+				skipWhitespace();
+			}
+			if(readKey(token)) {
+				return token;
+			}
+			break;
+		case EXPECT_FIRST_ELEMENT:
+		case EXPECT_ELEMENT_SEPARATOR:
+			if(*pos == ']') {
+				pos++;
+				pop();
+				token.type = TOKEN_ARRAY_END;
+				return token;
+			}
+			if(expect == EXPECT_ELEMENT_SEPARATOR) {
+				if(*pos != ',') {
+					break;
+				}
+				pos++;
+				skipWhitespace();
+			}
+			if(readValue(token)) {
+				return token;
+			}
+			break;
+		case EXPECT_END:
+			if(*pos == '\0') {
+				token.type = TOKEN_END;
+				return token;
+			}
+			break;
+		}
+		return fail();
+	}
+
+	bool JSONTokenizer::readKey(Token& token) {
+		if(*pos != '"' || !readString(token)) {
+			return false;
+		}
+		token.type = TOKEN_KEY;
+
+		skipWhitespace();
+		if(*pos != ':') {
+			return false;
+		}
+		pos++;
+		expect = EXPECT_VALUE;
+		return true;
+	}
+
+	bool JSONTokenizer::readValue(Token& token) {
+		switch(*pos) {
+		case '{':
+			pos++;
+			push('o');
+			expect = EXPECT_FIRST_MEMBER;
+			token.type = TOKEN_OBJECT_BEGIN;
+			return true;
+		case '[':
+			pos++;
+			push('a');
+			expect = EXPECT_FIRST_ELEMENT;
+			token.type = TOKEN_ARRAY_BEGIN;
+			return true;
+		case '"':
+			if(!readString(token)) {
+				return false;
+			}
+			token.type = TOKEN_STRING;
+			break;
+		case 't':
+			return readLiteral("true", 4, TOKEN_TRUE, token);
+		case 'f':
+			return readLiteral("false", 5, TOKEN_FALSE, token);
+		case 'n':
+			return readLiteral("null", 4, TOKEN_NULL, token);
+		default:
+			if(!readNumber(token)) {
+				return false;
+			}
+			break;
+		}
+		afterValue();
+		return true;
+	}
+
+	bool JSONTokenizer::readString(Token& token) {
+		const char* p = pos + 1;
+
+		token.text = p;
+		while(*p != '"') {
+			if(*p == '\0') {
+				return false;
+			}
+			if(*p == '\\') {
+				token.escaped = true;
+				if(*++p == '\0') {
+					return false;
+				}
+			}
+			p++;
+		}
+		token.length = p - token.text;
+		pos = p + 1;
+		return true;
+	}
+
+	bool JSONTokenizer::readNumber(Token& token) {
+		const char* p = pos;
+
+		if(*p == '-') {
+			p++;
+		}
+		if(!isDigit(*p)) {
+			return false;
+		}
+		if(*p == '0') {
+			p++;
+		} else {
+			while(isDigit(*p)) p++;
+		}
+
+		token.integral = true;
+		if(*p == '.') {
+			p++;
+			if(!isDigit(*p)) {
+				return false;
+			}
+			while(isDigit(*p)) p++;
+			token.integral = false;
+		}
+		if(*p == 'e' || *p == 'E') {
+			p++;
+			if(*p == '+' || *p == '-') {
+				p++;
+			}
+			if(!isDigit(*p)) {
+				return false;
+			}
+			while(isDigit(*p)) p++;
+			token.integral = false;
+		}
+
+		token.type = TOKEN_NUMBER;
+		token.text = pos;
+		token.length = p - pos;
+		pos = p;
+		return true;
+	}
+
+	bool JSONTokenizer::readLiteral(const char* literal, size_t length, TokenType type, Token& token) {
+		if(strncmp(pos, literal, length) != 0) {
+			return false;
+		}
+		pos += length;
+		token.type = type;
+		afterValue();
+		return true;
+	}
+
+	void JSONTokenizer::push(char container) {
+		if(stack_depth == stack.size()) {
+			stack += container;
+		} else {
+			stack[stack_depth] = container;
+		}
+		stack_depth++;
+	}
+
+	void JSONTokenizer::pop() {
+		stack_depth--;
+		afterValue();
+	}
+
+	void JSONTokenizer::afterValue() {
+		if(stack_depth == 0) {
+			expect = EXPECT_END;
+		} else {
+			expect = stack[stack_depth - 1] == 'o' ? EXPECT_MEMBER_SEPARATOR : EXPECT_ELEMENT_SEPARATOR;
+		}
+	}
+
+	bool JSONTokenizer::skipValue(const Token& first) {
+		if(first.type != TOKEN_OBJECT_BEGIN && first.type != TOKEN_ARRAY_BEGIN) {
+			return first.type != TOKEN_ERROR && first.type != TOKEN_END;
+		}
+
+		size_t target_depth = stack_depth - 1;
+
+		for(;;) {
+			Token token = next();
+
+			if(token.type == TOKEN_ERROR) {
+				return false;
+			}
+			if((token.type == TOKEN_OBJECT_END || token.type == TOKEN_ARRAY_END) && stack_depth == target_depth) {
+				return true;
+			}
+		}
+	}
+
+	bool JSONTokenizer::atContainerEnd() {
+		skipWhitespace();
+		return (expect == EXPECT_FIRST_MEMBER && *pos == '}') || (expect == EXPECT_FIRST_ELEMENT && *pos == ']');
+	}
+
+	JSONTokenizer::State JSONTokenizer::save() const {
+		State state;
+
+		state.pos = pos;
+		state.depth = stack_depth;
+		state.expect = expect;
+		state.top = stack_depth > 0 ? stack[stack_depth - 1] : '\0';
+		return state;
+	}
+
+	void JSONTokenizer::restore(const State& state) {
+		// only containers below the saved depth can have been closed since save(), they are put back here
+		pos = state.pos;
+		stack_depth = state.depth;
+		expect = state.expect;
+		if(stack_depth > 0) {
+			stack[stack_depth - 1] = state.top;
+		}
+	}
+
+	static void appendUTF8(std::string& out, unsigned int cp) {
+		if(cp <= 0x7f) {
+			out += static_cast<char>(cp);
+		} else if(cp <= 0x7FF) {
+			out += static_cast<char>(0xC0 | (0x1f & (cp >> 6)));
+			out += static_cast<char>(0x80 | (0x3f & cp));
+		} else if(cp <= 0xFFFF) {
+			out += static_cast<char>(0xE0 | (0xf & (cp >> 12)));
+			out += static_cast<char>(0x80 | (0x3f & (cp >> 6)));
+			out += static_cast<char>(0x80 | (0x3f & cp));
+		} else if(cp <= 0x10FFFF) {
+			out += static_cast<char>(0xF0 | (0x7 & (cp >> 18)));
+			out += static_cast<char>(0x80 | (0x3f & (cp >> 12)));
+			out += static_cast<char>(0x80 | (0x3f & (cp >> 6)));
+			out += static_cast<char>(0x80 | (0x3f & cp));
+		}
+	}
+
+	static bool readHex4(const char*& p, const char* end, unsigned int& value) {
+		if(end - p < 4) {
+			return false;
+		}
+		value = 0;
+		for(int i = 0; i < 4; i++) {
+			char c = *p++;
+			value *= 16;
+			if(c >= '0' && c <= '9') {
+				value += c - '0';
+			} else if(c >= 'a' && c <= 'f') {
+				value += c - 'a' + 10;
+			} else if(c >= 'A' && c <= 'F') {
+				value += c - 'A' + 10;
+			} else {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool JSON_decode_string(const char* text, size_t length, std::string& decoded) {
+		const char* p = text;
+		const char* end = text + length;
+
+		decoded.clear();
+		while(p != end) {
+			const char* run = p;
+
+			while(p != end && *p != '\\') p++;
+			decoded.append(run, p - run);
+			if(p == end) {
+				break;
+			}
+
+			if(++p == end) {
+				return false;
+			}
+			switch(*p++) {
+			case '"': decoded += '"'; break;
+			case '/': decoded += '/'; break;
+			case '\\': decoded += '\\'; break;
+			case 'b': decoded += '\b'; break;
+			case 'f': decoded += '\f'; break;
+			case 'n': decoded += '\n'; break;
+			case 'r': decoded += '\r'; break;
+			case 't': decoded += '\t'; break;
+			case 'u': {
+				unsigned int unicode;
+
+				if(!readHex4(p, end, unicode)) {
+					return false;
+				}
+				if(unicode >= 0xD800 && unicode <= 0xDBFF) { // surrogate pair
+					unsigned int low;
+
+					if(end - p < 6 || p[0] != '\\' || p[1] != 'u') {
+						return false;
+					}
+					p += 2;
+					if(!readHex4(p, end, low)) {
+						return false;
+					}
+					unicode = 0x10000 + ((unicode & 0x3FF) << 10) + (low & 0x3FF);
+				}
+				appendUTF8(decoded, unicode);
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+		return true;
+	}
+
+	JSONStreamWriter::JSONStreamWriter(std::string& output, bool compact_layout) : out(output), compact(compact_layout), duplicate_keys(false) {
+	}
+
+	void JSONStreamWriter::breakLine(size_t level) {
+		out += '\n';
+		out.append(level * STYLED_INDENT_SIZE, ' ');
+	}
+
+	/**
+	 * @desc writes the opening bracket of a container when its first member or element arrives,
+	 *       a container that stays empty is written as {} or [] by endObject()/endArray()
+	 */
+	void JSONStreamWriter::open(Frame& frame) {
+		if(frame.opened) {
+			return;
+		}
+
+		size_t index = &frame - &frames[0];
+
+		if(compact) {
+			frame.opened = true;
+			frame.start = out.size();
+			out += frame.is_array ? '[' : '{';
+			return;
+		}
+
+		// a non-empty container never fits on the line of its parent array
+		if(index > 0 && frames[index - 1].is_array && !frames[index - 1].multi_line) {
+			toMultiLine(index - 1);
+		}
+
+		frame.opened = true;
+		frame.start = out.size();
+		if(frame.is_array) {
+			frame.multi_line = false;
+			out += "[ ";
+		} else {
+			frame.multi_line = true;
+			out += '{';
+		}
+	}
+
+	/**
+	 * @desc re-lays a single line array "[ a, b" into one element per line
+	 */
+	void JSONStreamWriter::toMultiLine(size_t frame_index) {
+		Frame& frame = frames[frame_index];
+		size_t text_start = frame.start + 2;
+		size_t count = element_offsets.size() - frame.elements;
+
+		scratch.assign(out, text_start, std::string::npos);
+		out.resize(frame.start);
+		out += '[';
+
+		for(size_t i = 0; i < count; i++) {
+			size_t begin = element_offsets[frame.elements + i] - text_start;
+			size_t end = i + 1 < count ? element_offsets[frame.elements + i + 1] - text_start - 2 : scratch.size();
+
+			if(i > 0) {
+				out += ',';
+			}
+			breakLine(frame_index + 1);
+			out.append(scratch, begin, end - begin);
+		}
+		frame.multi_line = true;
+	}
+
+	void JSONStreamWriter::beginValue() {
+		if(frames.empty() || !frames.back().is_array) {
+			return; // root value, or the member name has been written by key()
+		}
+
+		size_t index = frames.size() - 1;
+		Frame& frame = frames[index];
+
+		open(frame);
+		if(compact) {
+			if(frame.count > 0) {
+				out += ',';
+			}
+			frame.count++;
+			return;
+		}
+		if(!frame.multi_line && (frame.count + 1 >= (STYLED_RIGHT_MARGIN + 2) / 3 ||
+		                         out.size() - frame.start + 2 >= STYLED_RIGHT_MARGIN)) {
+			toMultiLine(index);
+		}
+
+		if(frame.multi_line) {
+			if(frame.count > 0) {
+				out += ',';
+			}
+			breakLine(index + 1);
+		} else {
+			if(frame.count > 0) {
+				out += ", ";
+			}
+			element_offsets.push_back(out.size());
+		}
+		frame.count++;
+	}
+
+	/**
+	 * @desc Json::Value orders object members like std::map<CZString>: memcmp(), shorter name first
+	 */
+	bool JSONStreamWriter::memberLess(const Member& a, const Member& b) {
+		int comp = memcmp(a.name, b.name, a.length < b.length ? a.length : b.length);
+
+		if(comp != 0) {
+			return comp < 0;
+		}
+		return a.length < b.length;
+	}
+
+	/**
+	 * @desc moves the members of the object that is being ended into key order, every member
+	 *       except the first one is written with a leading ',' which is dropped and re-added here
+	 */
+	void JSONStreamWriter::sortMembers(const Frame& frame) {
+		Member* first = &members[frame.members];
+		size_t count = members.size() - frame.members;
+		bool sorted = true;
+
+		for(size_t i = 1; i < count; i++) {
+			if(!memberLess(first[i - 1], first[i])) {
+				sorted = false;
+				if(!memberLess(first[i], first[i - 1])) {
+					duplicate_keys = true;
+				}
+			}
+		}
+		if(sorted) {
+			return;
+		}
+
+		size_t text_start = first[0].start;
+
+		for(size_t i = 0; i < count; i++) {
+			first[i].end = i + 1 < count ? first[i + 1].start : out.size();
+		}
+		std::stable_sort(first, first + count, memberLess);
+
+		scratch.assign(out, text_start, std::string::npos);
+		out.resize(text_start);
+		for(size_t i = 0; i < count; i++) {
+			size_t begin = first[i].start - text_start;
+
+			if(first[i].start != text_start) {
+				begin++; // separator
+			}
+			if(i > 0) {
+				out += ',';
+				if(!memberLess(first[i - 1], first[i])) {
+					duplicate_keys = true;
+				}
+			}
+			out.append(scratch, begin, first[i].end - text_start - begin);
+		}
+	}
+
+	void JSONStreamWriter::beginObject() {
+		beginValue();
+
+		Frame frame = { false, false, true, 0, out.size(), element_offsets.size(), members.size() };
+		frames.push_back(frame);
+	}
+
+	void JSONStreamWriter::endObject() {
+		const Frame& frame = frames.back();
+
+		if(!frame.opened) {
+			out += "{}";
+		} else {
+			if(frame.count > 1) {
+				sortMembers(frame);
+			}
+			if(!compact) {
+				breakLine(frames.size() - 1);
+			}
+			out += '}';
+		}
+		members.resize(frame.members);
+		frames.pop_back();
+	}
+
+	void JSONStreamWriter::beginArray() {
+		beginValue();
+
+		Frame frame = { true, false, false, 0, out.size(), element_offsets.size(), members.size() };
+		frames.push_back(frame);
+	}
+
+	void JSONStreamWriter::endArray() {
+		size_t index = frames.size() - 1;
+		Frame& frame = frames[index];
+
+		if(!frame.opened) {
+			out += "[]";
+		} else if(compact) {
+			out += ']';
+		} else {
+			if(!frame.multi_line && out.size() - frame.start + 2 >= STYLED_RIGHT_MARGIN) {
+				toMultiLine(index);
+			}
+			if(frame.multi_line) {
+				breakLine(index);
+				out += ']';
+			} else {
+				out += " ]";
+			}
+		}
+		element_offsets.resize(frame.elements);
+		frames.pop_back();
+	}
+
+	void JSONStreamWriter::key(const char* name, size_t length) {
+		size_t index = frames.size() - 1;
+		Frame& frame = frames[index];
+
+		open(frame);
+
+		Member member = { name, length, out.size(), 0 };
+		members.push_back(member);
+
+		if(frame.count > 0) {
+			out += ',';
+		}
+		if(compact) {
+			appendQuoted(name, length);
+			out += ':';
+		} else {
+			breakLine(index + 1);
+			appendQuoted(name, length);
+			out += " : ";
+		}
+		frame.count++;
+	}
+
+	void JSONStreamWriter::stringValue(const char* value, size_t length) {
+		beginValue();
+		appendQuoted(value, length);
+	}
+
+	void JSONStreamWriter::rawValue(const char* value, size_t length) {
+		beginValue();
+		out.append(value, length);
+	}
+
+	void JSONStreamWriter::finish() {
+		if(!compact) {
+			out += '\n';
+		}
+	}
+
+	/**
+	 * @desc quotes and escapes a string like Json::valueToQuotedStringN(), which also ends the string at a NUL
+	 */
+	void JSONStreamWriter::appendQuoted(const char* value, size_t length) {
+		static const char HEX[] = "0123456789ABCDEF";
+		const char* p = value;
+		const char* end = value + length;
+
+		out += '"';
+		while(p != end && *p != '\0') {
+			const char* run = p;
+
+			while(p != end && (unsigned char)*p >= 0x20 && *p != '"' && *p != '\\') p++;
+			out.append(run, p - run);
+			if(p == end || *p == '\0') {
+				break;
+			}
+
+			char c = *p++;
+			switch(c) {
+			case '"': out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\b': out += "\\b"; break;
+			case '\f': out += "\\f"; break;
+			case '\n': out += "\\n"; break;
+			case '\r': out += "\\r"; break;
+			case '\t': out += "\\t"; break;
+			default:
+				out += "\\u00";
+				out += HEX[(c >> 4) & 0xf];
+				out += HEX[c & 0xf];
+				break;
+			}
+		}
+		out += '"';
+	}
+
+	static void writeCompactValue(JSONStreamWriter& writer, const Json::Value& value) {
+		const char* begin;
+		const char* end;
+		std::string number;
+
+		switch(value.type()) {
+		case Json::nullValue:
+			writer.rawValue("null", 4);
+			break;
+		case Json::intValue:
+			number = Json::valueToString(value.asLargestInt());
+			writer.rawValue(number.data(), number.length());
+			break;
+		case Json::uintValue:
+			number = Json::valueToString(value.asLargestUInt());
+			writer.rawValue(number.data(), number.length());
+			break;
+		case Json::realValue:
+			number = Json::valueToString(value.asDouble());
+			writer.rawValue(number.data(), number.length());
+			break;
+		case Json::stringValue:
+			if(value.getString(&begin, &end)) {
+				writer.stringValue(begin, end - begin);
+			}
+			break;
+		case Json::booleanValue:
+			if(value.asBool()) {
+				writer.rawValue("true", 4);
+			} else {
+				writer.rawValue("false", 5);
+			}
+			break;
+		case Json::arrayValue:
+			writer.beginArray();
+			for(Json::ArrayIndex index = 0; index < value.size(); index++) {
+				writeCompactValue(writer, value[index]);
+			}
+			writer.endArray();
+			break;
+		case Json::objectValue:
+			writer.beginObject();
+			for(Json::Value::const_iterator iter = value.begin(); iter != value.end(); ++iter) {
+				begin = iter.memberName(&end);
+				writer.key(begin, end - begin);
+				writeCompactValue(writer, *iter);
+			}
+			writer.endObject();
+			break;
+		}
+	}
+
+	void JSON_write_compact(const Json::Value& value, std::string& output) {
+		JSONStreamWriter writer(output, true);
+
+		writeCompactValue(writer, value);
+		writer.finish();
+	}
+
+	bool JSON_compact_serialization() {
+		return OneM2M__Constants::tsp__compactJsonSerialization;
+	}
+
+	CHARSTRING JSON_wire_string(const Json::Value& value) {
+		std::string& output = MappingArena::instance().outputBuffer();
+
+		if(JSON_compact_serialization()) {
+			JSON_write_compact(value, output);
+		} else {
+			Json::StyledWriter writer;
+
+			output = writer.write(value);
+		}
+		return CHARSTRING(output.length(), output.data());
+	}
+
+	/**
+	 * @desc a number as Json::Reader::decodeNumber() stores it: integers that fit into 64 bits as Int
+	 *       (or UInt above the int range), everything else as a double
+	 */
+	struct JSONNumber {
+		enum Kind { INT, UINT, REAL } kind;
+		long long int_value;
+		unsigned long long uint_value;
+		double real_value;
+
+		double asDouble() const {
+			return kind == INT ? (double)int_value : (kind == UINT ? (double)uint_value : real_value);
+		}
+	};
+
+	static bool parseNumber(const JSONTokenizer::Token& token, JSONNumber& number) {
+		if(token.integral) {
+			const char* p = token.text;
+			const char* end = token.text + token.length;
+			bool negative = *p == '-';
+			unsigned long long max_value = negative ? 9223372036854775808ULL : 18446744073709551615ULL;
+			unsigned long long threshold = max_value / 10;
+			unsigned long long value = 0;
+			bool overflow = false;
+
+			if(negative) {
+				p++;
+			}
+			while(p != end) {
+				unsigned int digit = *p++ - '0';
+
+				if(value >= threshold && (value > threshold || p != end || digit > max_value % 10)) {
+					overflow = true;
+					break;
+				}
+				value = value * 10 + digit;
+			}
+
+			if(!overflow) {
+				if(negative) {
+					number.kind = JSONNumber::INT;
+					number.int_value = value == max_value ? (-9223372036854775807LL - 1) : -(long long)value;
+				} else if(value <= 2147483647ULL) {
+					number.kind = JSONNumber::INT;
+					number.int_value = (long long)value;
+				} else {
+					number.kind = JSONNumber::UINT;
+					number.uint_value = value;
+				}
+				return true;
+			}
+		}
+
+		number.kind = JSONNumber::REAL;
+		number.real_value = strtod(token.text, NULL);
+		return isfinite(number.real_value) != 0; // Json::Reader rejects numbers out of the double range
+	}
+
+	/**
+	 * @desc writes a number like Json::StyledWriter, or its asDouble() value
+	 */
+	static void writeNumber(JSONStreamWriter& writer, const JSONNumber& number, bool as_double) {
+		char buffer[32];
+		int length;
+
+		if(as_double || number.kind == JSONNumber::REAL) {
+			length = snprintf(buffer, sizeof(buffer), "%.17g", number.asDouble());
+		} else if(number.kind == JSONNumber::INT) {
+			length = snprintf(buffer, sizeof(buffer), "%lld", number.int_value);
+		} else {
+			length = snprintf(buffer, sizeof(buffer), "%llu", number.uint_value);
+		}
+		writer.rawValue(buffer, length);
+	}
+
+	static bool writeNumber(JSONStreamWriter& writer, const JSONTokenizer::Token& token, bool as_double) {
+		JSONNumber number;
+
+		if(!parseNumber(token, number)) {
+			return false;
+		}
+		writeNumber(writer, number, as_double);
+		return true;
+	}
+
+	static bool writeString(JSONStreamWriter& writer, std::string& scratch, const JSONTokenizer::Token& token) {
+		if(!token.escaped) {
+			writer.stringValue(token.text, token.length);
+			return true;
+		}
+		if(!JSON_decode_string(token.text, token.length, scratch)) {
+			return false;
+		}
+		writer.stringValue(scratch.data(), scratch.size());
+		return true;
+	}
+
+	/**
+	 * @desc copies a value without mapping any names, as Json::Value would store and write it
+	 */
+	static bool copyValue(JSONTokenizer& tokenizer, JSONStreamWriter& writer, std::string& scratch, const JSONTokenizer::Token& first) {
+		switch(first.type) {
+		case JSONTokenizer::TOKEN_OBJECT_BEGIN:
+			if(tokenizer.depth() > MAX_NESTING) {
+				return false;
+			}
+			writer.beginObject();
+			for(JSONTokenizer::Token key = tokenizer.next(); key.type != JSONTokenizer::TOKEN_OBJECT_END; key = tokenizer.next()) {
+				if(key.type != JSONTokenizer::TOKEN_KEY || key.escaped) {
+					return false;
+				}
+				writer.key(key.text, key.length);
+				if(!copyValue(tokenizer, writer, scratch, tokenizer.next())) {
+					return false;
+				}
+			}
+			writer.endObject();
+			return true;
+		case JSONTokenizer::TOKEN_ARRAY_BEGIN:
+			if(tokenizer.depth() > MAX_NESTING) {
+				return false;
+			}
+			writer.beginArray();
+			for(JSONTokenizer::Token element = tokenizer.next(); element.type != JSONTokenizer::TOKEN_ARRAY_END; element = tokenizer.next()) {
+				if(!copyValue(tokenizer, writer, scratch, element)) {
+					return false;
+				}
+			}
+			writer.endArray();
+			return true;
+		case JSONTokenizer::TOKEN_STRING:
+			return writeString(writer, scratch, first);
+		case JSONTokenizer::TOKEN_NUMBER:
+			return writeNumber(writer, first, false);
+		case JSONTokenizer::TOKEN_TRUE:
+			writer.rawValue("true", 4);
+			return true;
+		case JSONTokenizer::TOKEN_FALSE:
+			writer.rawValue("false", 5);
+			return true;
+		case JSONTokenizer::TOKEN_NULL:
+			writer.rawValue("null", 4);
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// enumerated attributes that JSONDeepParser converts to integers, by short name
+	static const char* const ENUMERATED_ATTRIBUTES[] = { "op", "ty", "acop", "rcn", "csy", "cst", "mt", "nct", NULL };
+
+	// attributes that are sent as null if given as an omitted forced field, see f__serialization__Enc
+	static const struct {
+		const char* field_name;
+		const char* short_name;
+	} FORCED_NULL_ATTRIBUTES[] = {
+		{ "expirationTime", "et" },
+		{ "selfPrivileges", "pvs" },
+		{ "notificationURI", "nu" },
+		{ "creator", "cr" }
+	};
+
+	JSONStreamEncoder::JSONStreamEncoder(const char* source, std::string& output, bool compact_layout) :
+		tokenizer(source), writer(output, compact_layout) {
+	}
+
+	const char* JSONStreamEncoder::shortName(const char* name, size_t length, size_t& short_length) {
+		const char* short_name = NameMappingRegistry::instance().getShortName(name, length);
+
+		if(short_name == NULL) {
+			short_length = length;
+			return name;
+		}
+		short_length = strlen(short_name);
+		return short_name;
+	}
+
+	bool JSONStreamEncoder::isForcedNull(const char* name, size_t name_length) const {
+		for(size_t i = 0; i < forced_null_names.size(); i++) {
+			if(nameIs(name, name_length, forced_null_names[i])) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool JSONStreamEncoder::encode(const OneM2M__Types::AttributeAux__list& p__forcedFields) {
+		forced_null_names.clear();
+		if(p__forcedFields != NULL_VALUE) {
+			for(int i = 0; i < p__forcedFields.lengthof(); i++) {
+				if(!(p__forcedFields[i].value__() == OMIT_VALUE)) {
+					continue;
+				}
+				for(size_t j = 0; j < sizeof(FORCED_NULL_ATTRIBUTES) / sizeof(FORCED_NULL_ATTRIBUTES[0]); j++) {
+					if(p__forcedFields[i].name() == FORCED_NULL_ATTRIBUTES[j].field_name) {
+						forced_null_names.push_back(FORCED_NULL_ATTRIBUTES[j].short_name);
+					}
+				}
+			}
+		}
+
+		// only the usual {"<resource>": {...}} primitive content is streamed
+		if(tokenizer.next().type != JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+			return false;
+		}
+
+		Token key = tokenizer.next();
+
+		if(key.type != JSONTokenizer::TOKEN_KEY || key.escaped ||
+		   tokenizer.next().type != JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+			return false;
+		}
+
+		// the DOM path looks the resource name up twice, in f__serialization__Enc and in JSONDeepParser
+		size_t name_length;
+		const char* name = shortName(key.text, key.length, name_length);
+		name = shortName(name, name_length, name_length);
+
+		writer.beginObject();
+		writer.key(name, name_length);
+		writer.beginObject();
+		if(!encodeNestedMembers(true)) {
+			return false;
+		}
+		writer.endObject();
+
+		if(tokenizer.next().type != JSONTokenizer::TOKEN_OBJECT_END || tokenizer.next().type != JSONTokenizer::TOKEN_END) {
+			return false;
+		}
+		writer.endObject();
+		writer.finish();
+
+		// two names mapped to the same short name, which one JSONDeepParser keeps depends on their order
+		return !writer.hasDuplicateKeys();
+	}
+
+	/**
+	 * @desc members of an object as handled by the first pass of JSONDeepParser: nested objects are mapped,
+	 *       arrays are copied as they are (apart from accessControlContexts) and empty arrays are dropped
+	 */
+	bool JSONStreamEncoder::encodeMembers() {
+		if(tokenizer.depth() > MAX_NESTING) {
+			return false;
+		}
+
+		for(;;) {
+			Token key = tokenizer.next();
+
+			if(key.type == JSONTokenizer::TOKEN_OBJECT_END) {
+				return true;
+			}
+			if(key.type != JSONTokenizer::TOKEN_KEY || key.escaped) {
+				return false;
+			}
+
+			size_t name_length;
+			const char* name = shortName(key.text, key.length, name_length);
+			Token value = tokenizer.next();
+
+			if(value.type == JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+				writer.key(name, name_length);
+				writer.beginObject();
+				if(!encodeNestedMembers(false)) {
+					return false;
+				}
+				writer.endObject();
+			} else if(value.type == JSONTokenizer::TOKEN_ARRAY_BEGIN) {
+				if(tokenizer.atContainerEnd()) {
+					tokenizer.next();
+					continue;
+				}
+
+				writer.key(name, name_length);
+				if(nameIs(name, name_length, "acco")) { // accessControlContexts, only objects are kept
+					writer.beginArray();
+					for(Token element = tokenizer.next(); element.type != JSONTokenizer::TOKEN_ARRAY_END; element = tokenizer.next()) {
+						if(element.type == JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+							writer.beginObject();
+							if(!encodeMembers()) {
+								return false;
+							}
+							writer.endObject();
+						} else if(!tokenizer.skipValue(element)) {
+							return false;
+						}
+					}
+					writer.endArray();
+				} else if(!copyValue(tokenizer, writer, scratch, value)) {
+					return false;
+				}
+			} else if(!encodeScalarMember(name, name_length, value)) {
+				return false;
+			}
+		}
+	}
+
+	/**
+	 * @desc members of an object nested in another object, JSONDeepParser additionally maps the arrays
+	 *       and flattens the objects holding arrays (see encodeObjectMember) at this level
+	 */
+	bool JSONStreamEncoder::encodeNestedMembers(bool resource_level) {
+		if(tokenizer.depth() > MAX_NESTING) {
+			return false;
+		}
+
+		for(;;) {
+			Token key = tokenizer.next();
+
+			if(key.type == JSONTokenizer::TOKEN_OBJECT_END) {
+				return true;
+			}
+			if(key.type != JSONTokenizer::TOKEN_KEY || key.escaped) {
+				return false;
+			}
+
+			size_t name_length;
+			const char* name = shortName(key.text, key.length, name_length);
+			bool forced_null = resource_level && isForcedNull(name, name_length);
+			Token value = tokenizer.next();
+
+			if(value.type == JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+				if(!encodeObjectMember(name, name_length, key, resource_level, forced_null)) {
+					return false;
+				}
+			} else if(value.type == JSONTokenizer::TOKEN_ARRAY_BEGIN) {
+				if(tokenizer.atContainerEnd()) { // dropped, so not nulled either
+					tokenizer.next();
+					continue;
+				}
+
+				writer.key(name, name_length);
+				if(forced_null) {
+					writer.rawValue("null", 4);
+					if(!tokenizer.skipValue(value)) {
+						return false;
+					}
+				} else if(!encodeConvertedArray()) {
+					return false;
+				}
+			} else if(forced_null && value.type != JSONTokenizer::TOKEN_ERROR) {
+				writer.key(name, name_length);
+				writer.rawValue("null", 4);
+			} else if(!encodeScalarMember(name, name_length, value)) {
+				return false;
+			}
+		}
+	}
+
+	/**
+	 * @desc An object member of a nested object. JSONDeepParser replaces such an object by its arrays:
+	 *       the array members sorted last wins, scalar arrays replace the object, "embed_values" strings
+	 *       replace it by the last string, and arrays of objects give an object of only those arrays.
+	 *       The members are pre-scanned to find out which case applies, anything ambiguous returns false.
+	 */
+	bool JSONStreamEncoder::encodeObjectMember(const char* name, size_t name_length, const Token& key, bool resource_level, bool forced_null) {
+		enum { ELEMENT_NONE, ELEMENT_STRING, ELEMENT_SCALAR, ELEMENT_OBJECT };
+
+		struct ArrayInfo {
+			Token key;
+			JSONTokenizer::State before;
+			bool has_string, has_scalar, has_object;
+			int last_kind;
+			Token last_string;
+		};
+
+		bool privileges = resource_level && (nameIs(key.text, key.length, "privileges") || nameIs(key.text, key.length, "selfPrivileges"));
+		bool notification_criteria = resource_level && nameIs(key.text, key.length, "eventNotificationCriteria");
+
+		JSONTokenizer::State inside = tokenizer.save();
+		ArrayInfo best;
+		bool have_best = false;
+		Token embed_key;
+		bool have_embed = false;
+		bool mixed_object_array = false;
+
+		best.last_kind = ELEMENT_NONE;
+		for(;;) {
+			Token member = tokenizer.next();
+
+			if(member.type == JSONTokenizer::TOKEN_OBJECT_END) {
+				break;
+			}
+			if(member.type != JSONTokenizer::TOKEN_KEY || member.escaped) {
+				return false;
+			}
+
+			// cases handled by sub_JSON_Enc_Parser and acp_JSON_Enc_Parser on the DOM path
+			if(notification_criteria && nameIs(member.text, member.length, "operationMonitor_list")) {
+				return false;
+			}
+			bool rule_list = privileges && nameIs(member.text, member.length, "accessControlRule_list");
+
+			if(nameIs(member.text, member.length, "embed_values")) {
+				embed_key = member;
+				have_embed = true;
+			}
+
+			JSONTokenizer::State before = tokenizer.save();
+			Token value = tokenizer.next();
+
+			if(rule_list && (value.type == JSONTokenizer::TOKEN_NULL ||
+			                 ((value.type == JSONTokenizer::TOKEN_ARRAY_BEGIN || value.type == JSONTokenizer::TOKEN_OBJECT_BEGIN) && tokenizer.atContainerEnd()))) {
+				return false;
+			}
+
+			if(value.type != JSONTokenizer::TOKEN_ARRAY_BEGIN) {
+				if(!tokenizer.skipValue(value)) {
+					return false;
+				}
+				continue;
+			}
+
+			ArrayInfo info;
+
+			info.key = member;
+			info.before = before;
+			info.has_string = info.has_scalar = info.has_object = false;
+			info.last_kind = ELEMENT_NONE;
+
+			for(Token element = tokenizer.next(); element.type != JSONTokenizer::TOKEN_ARRAY_END; element = tokenizer.next()) {
+				switch(element.type) {
+				case JSONTokenizer::TOKEN_STRING:
+					info.has_string = true;
+					info.last_kind = ELEMENT_STRING;
+					info.last_string = element;
+					break;
+				case JSONTokenizer::TOKEN_NUMBER:
+				case JSONTokenizer::TOKEN_TRUE:
+				case JSONTokenizer::TOKEN_FALSE:
+					info.has_scalar = true;
+					info.last_kind = ELEMENT_SCALAR;
+					break;
+				case JSONTokenizer::TOKEN_OBJECT_BEGIN:
+					info.has_object = true;
+					info.last_kind = ELEMENT_OBJECT;
+					// no break
+				case JSONTokenizer::TOKEN_ARRAY_BEGIN: // nested arrays and nulls are ignored by JSONDeepParser
+				case JSONTokenizer::TOKEN_NULL:
+					if(!tokenizer.skipValue(element)) {
+						return false;
+					}
+					break;
+				default:
+					return false;
+				}
+			}
+
+			if(info.has_object && (info.has_string || info.has_scalar)) {
+				mixed_object_array = true;
+			}
+			if(info.last_kind != ELEMENT_NONE && (!have_best || compareKeys(member, best.key) > 0)) {
+				best = info;
+				have_best = true;
+			}
+		}
+
+		JSONTokenizer::State end = tokenizer.save();
+
+		writer.key(name, name_length);
+		if(forced_null) {
+			writer.rawValue("null", 4);
+			return true;
+		}
+
+		if(!have_best) { // no array with elements, the object is kept
+			tokenizer.restore(inside);
+			writer.beginObject();
+			if(!encodeNestedMembers(false)) {
+				return false;
+			}
+			writer.endObject();
+			return true;
+		}
+
+		bool embed_values = have_embed && compareKeys(embed_key, best.key) <= 0;
+
+		if(best.last_kind == ELEMENT_OBJECT) {
+			if(mixed_object_array) {
+				return false;
+			}
+
+			tokenizer.restore(inside);
+			writer.beginObject();
+			for(Token member = tokenizer.next(); member.type != JSONTokenizer::TOKEN_OBJECT_END; member = tokenizer.next()) {
+				Token value = tokenizer.next();
+
+				if(value.type != JSONTokenizer::TOKEN_ARRAY_BEGIN) {
+					tokenizer.skipValue(value);
+					continue;
+				}
+
+				bool started = false;
+
+				for(Token element = tokenizer.next(); element.type != JSONTokenizer::TOKEN_ARRAY_END; element = tokenizer.next()) {
+					if(element.type != JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+						tokenizer.skipValue(element);
+						continue;
+					}
+					if(!started) {
+						size_t array_name_length;
+						const char* array_name = shortName(member.text, member.length, array_name_length);
+
+						writer.key(array_name, array_name_length);
+						writer.beginArray();
+						started = true;
+					}
+					writer.beginObject();
+					if(!encodeMembers()) {
+						return false;
+					}
+					writer.endObject();
+				}
+				if(started) {
+					writer.endArray();
+				}
+			}
+			writer.endObject();
+			return true;
+		}
+
+		if(best.last_kind == ELEMENT_STRING && embed_values) {
+			if(best.has_scalar || best.has_object) {
+				return false;
+			}
+			return writeString(writer, scratch, best.last_string);
+		}
+
+		if(best.has_object || (embed_values && best.has_string)) {
+			return false;
+		}
+
+		tokenizer.restore(best.before);
+		tokenizer.next();
+		if(!encodeConvertedArray()) {
+			return false;
+		}
+		tokenizer.restore(end);
+		return true;
+	}
+
+	bool JSONStreamEncoder::encodeScalarMember(const char* name, size_t name_length, const Token& value) {
+		switch(value.type) {
+		case JSONTokenizer::TOKEN_STRING:
+			for(const char* const* attribute = ENUMERATED_ATTRIBUTES; *attribute != NULL; attribute++) {
+				if(!nameIs(name, name_length, *attribute)) {
+					continue;
+				}
+
+				const char* enum_name = value.text;
+				size_t enum_length = value.length;
+
+				if(value.escaped) {
+					if(!JSON_decode_string(value.text, value.length, scratch)) {
+						return false;
+					}
+					enum_name = scratch.data();
+					enum_length = scratch.size();
+				}
+
+				const char* enum_value = NameMappingRegistry::instance().getShortName(enum_name, enum_length);
+				char buffer[16];
+				int length = sprintf(buffer, "%d", enum_value != NULL ? atoi(enum_value) : 0);
+
+				writer.key(name, name_length);
+				writer.rawValue(buffer, length);
+				return true;
+			}
+			writer.key(name, name_length);
+			return writeString(writer, scratch, value);
+		case JSONTokenizer::TOKEN_NUMBER:
+		case JSONTokenizer::TOKEN_TRUE:
+		case JSONTokenizer::TOKEN_FALSE:
+		case JSONTokenizer::TOKEN_NULL:
+			if(nameIs(name, name_length, "acco")) { // not an array, dropped by JSONDeepParser
+				return true;
+			}
+			writer.key(name, name_length);
+			return copyValue(tokenizer, writer, scratch, value);
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * @desc array elements as mapped by JSONDeepParser: numbers become doubles, nulls and nested arrays are
+	 *       dropped and objects are mapped
+	 */
+	bool JSONStreamEncoder::encodeConvertedArray() {
+		writer.beginArray();
+		for(;;) {
+			Token element = tokenizer.next();
+
+			switch(element.type) {
+			case JSONTokenizer::TOKEN_ARRAY_END:
+				writer.endArray();
+				return true;
+			case JSONTokenizer::TOKEN_STRING:
+				if(!writeString(writer, scratch, element)) {
+					return false;
+				}
+				break;
+			case JSONTokenizer::TOKEN_NUMBER:
+				if(!writeNumber(writer, element, true)) {
+					return false;
+				}
+				break;
+			case JSONTokenizer::TOKEN_TRUE:
+			case JSONTokenizer::TOKEN_FALSE:
+				if(element.type == JSONTokenizer::TOKEN_TRUE) {
+					writer.rawValue("true", 4);
+				} else {
+					writer.rawValue("false", 5);
+				}
+				break;
+			case JSONTokenizer::TOKEN_OBJECT_BEGIN:
+				writer.beginObject();
+				if(!encodeMembers()) {
+					return false;
+				}
+				writer.endObject();
+				break;
+			case JSONTokenizer::TOKEN_ARRAY_BEGIN:
+			case JSONTokenizer::TOKEN_NULL:
+				if(!tokenizer.skipValue(element)) {
+					return false;
+				}
+				break;
+			default:
+				return false;
+			}
+		}
+	}
+
+	// enumerated attributes that JSONDeepParserDec converts from integers, by short and long name
+	static const char* const DEC_ENUMERATED_ATTRIBUTES[] = {
+		"op", "operation", "ty", "resourceType", "acop", "accessControlOperations", "rcn", "resultContent",
+		"csy", "consistencyStrategy", "mt", "memberType", "nct", "notificationContentType", "cst", "cseType", NULL
+	};
+
+	static const char* const ACCESS_CONTROL_CONTEXTS_LIST = "accessControlContexts_list";
+
+	JSONStreamDecoder::JSONStreamDecoder(const char* source, std::string& output) : tokenizer(source), writer(output) {
+	}
+
+	const char* JSONStreamDecoder::longName(const char* name, size_t length, size_t& long_length) {
+		const char* long_name = NameMappingRegistry::instance().getLongName(name, length);
+
+		if(long_name == NULL) {
+			long_length = length;
+			return name;
+		}
+		long_length = strlen(long_name);
+		return long_name;
+	}
+
+	/**
+	 * @desc writes the long name of a short name like getLongName() does, "" if it is not mapped
+	 */
+	void JSONStreamDecoder::writeLongName(const char* name) {
+		const char* long_name = NameMappingRegistry::instance().getLongName(name, strlen(name));
+
+		if(long_name == NULL) {
+			writer.stringValue("", 0);
+		} else {
+			writer.stringValue(long_name, strlen(long_name));
+		}
+	}
+
+	bool JSONStreamDecoder::keyLess(const KeyName& a, const KeyName& b) {
+		int order = memcmp(a.name, b.name, std::min(a.length, b.length));
+
+		return order != 0 ? order < 0 : a.length < b.length;
+	}
+
+	/**
+	 * @desc inserts a member name at its sorted position; repeated names are kept, so an object
+	 *       with a repeated member never matches one without
+	 */
+	void JSONStreamDecoder::addKey(KeySet& keys, const char* name, size_t length) {
+		KeyName key = { name, length };
+
+		keys.names.insert(std::upper_bound(keys.names.begin(), keys.names.end(), key, keyLess), key);
+	}
+
+	bool JSONStreamDecoder::share(SharedClone& clone, const KeySet& keys) {
+		if(!clone.used) {
+			clone.used = true;
+			clone.keys = keys;
+			return true;
+		}
+		if(clone.keys.names.size() != keys.names.size()) {
+			return false;
+		}
+		for(size_t i = 0; i < keys.names.size(); i++) {
+			const KeyName& a = clone.keys.names[i];
+			const KeyName& b = keys.names[i];
+
+			if(a.length != b.length || memcmp(a.name, b.name, a.length) != 0) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @desc long names of the members of an object whose first token has been read, without writing it
+	 */
+	bool JSONStreamDecoder::scanObjectKeys(KeySet& keys) {
+		keys.names.clear();
+		for(;;) {
+			Token key = tokenizer.next();
+
+			if(key.type == JSONTokenizer::TOKEN_OBJECT_END) {
+				return true;
+			}
+			if(key.type != JSONTokenizer::TOKEN_KEY || key.escaped || !tokenizer.skipValue(tokenizer.next())) {
+				return false;
+			}
+
+			size_t name_length;
+			const char* name = longName(key.text, key.length, name_length);
+
+			addKey(keys, name, name_length);
+		}
+	}
+
+	bool JSONStreamDecoder::decode() {
+		if(tokenizer.next().type != JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+			return false;
+		}
+
+		Token key = tokenizer.next();
+
+		if(key.type != JSONTokenizer::TOKEN_KEY || key.escaped) {
+			return false;
+		}
+
+		size_t root_length;
+		const char* root_name = longName(key.text, key.length, root_length);
+		Token value = tokenizer.next();
+
+		writer.beginObject();
+		if(value.type == JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+			if(nameIs(root_name, root_length, "aggregatedResponse")) {
+				if(!decodeAggregatedResponse()) {
+					return false;
+				}
+			} else {
+				// post-processed by f__primitiveContent__Dec and JSONDeepParserDec
+				if(nameIs(root_name, root_length, "accessControlPolicy") || nameIs(root_name, root_length, "subscription") ||
+				   nameIs(root_name, root_length, "group_")) {
+					return false;
+				}
+
+				// the DOM path looks the resource name up twice, in f__primitiveContent__Dec and in JSONDeepParserDec
+				size_t name_length;
+				const char* name = longName(root_name, root_length, name_length);
+				Frame frame;
+				KeySet keys;
+
+				// the call decoding the root member and the one decoding its object
+				frames.push_back(frame);
+				frames.push_back(frame);
+				writer.key(name, name_length);
+				writer.beginObject();
+				if(!decodeObject(true, 0, keys, false)) {
+					return false;
+				}
+				writer.endObject();
+				frames.clear();
+			}
+		} else if(value.type == JSONTokenizer::TOKEN_ARRAY_BEGIN && nameIs(root_name, root_length, "uRIList")) {
+			writer.key(root_name, root_length);
+			if(!copyValue(tokenizer, writer, scratch, value)) {
+				return false;
+			}
+		} else if(!tokenizer.skipValue(value)) { // other root members are not part of the decoded content
+			return false;
+		}
+
+		if(tokenizer.next().type != JSONTokenizer::TOKEN_OBJECT_END || tokenizer.next().type != JSONTokenizer::TOKEN_END) {
+			return false;
+		}
+		writer.endObject();
+		writer.finish();
+		return !writer.hasDuplicateKeys();
+	}
+
+	/**
+	 * @desc the responses of an m2m:agr, each decoded with a dummy request identifier like on the DOM path
+	 */
+	bool JSONStreamDecoder::decodeAggregatedResponse() {
+		bool have_responses = false;
+
+		for(;;) {
+			Token key = tokenizer.next();
+
+			if(key.type == JSONTokenizer::TOKEN_OBJECT_END) {
+				break;
+			}
+			if(key.type != JSONTokenizer::TOKEN_KEY || key.escaped) {
+				return false;
+			}
+
+			Token value = tokenizer.next();
+
+			if(!nameIs(key.text, key.length, "m2m:rsp")) {
+				if(!tokenizer.skipValue(value)) {
+					return false;
+				}
+				continue;
+			}
+			if(have_responses || value.type != JSONTokenizer::TOKEN_ARRAY_BEGIN) {
+				return false;
+			}
+			have_responses = true;
+
+			bool started = false;
+
+			for(Token element = tokenizer.next(); element.type != JSONTokenizer::TOKEN_ARRAY_END; element = tokenizer.next()) {
+				if(element.type != JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+					return false;
+				}
+				if(!started) {
+					writer.key("aggregatedResponse", 18);
+					writer.beginObject();
+					writer.key("responsePrimitive_list", 22);
+					writer.beginArray();
+					started = true;
+				}
+
+				Frame frame;
+				KeySet keys;
+
+				frames.push_back(frame);
+				writer.beginObject();
+				if(!decodeObject(false, 0, keys, true)) {
+					return false;
+				}
+				writer.endObject();
+				frames.pop_back();
+			}
+			if(started) {
+				writer.endArray();
+				writer.endObject();
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @desc Members of an object whose '{' has been read, as decoded by one JSONDeepParserDec call.
+	 *       nested is set for the members of an object that is itself a member of an object, the
+	 *       arrays and objects among them are then converted once more by the parent call (frame parent).
+	 */
+	bool JSONStreamDecoder::decodeObject(bool nested, size_t parent, KeySet& keys, bool response_primitive) {
+		if(tokenizer.depth() > MAX_NESTING) {
+			return false;
+		}
+
+		size_t frame = frames.size() - 1;
+
+		keys.names.clear();
+
+		if(response_primitive) { // f__primitiveContent__Dec replaces the rqi of every aggregated response
+			size_t name_length;
+			const char* name = longName("rqi", 3, name_length);
+
+			writer.key(name, name_length);
+			writer.stringValue("temp_requestIdentifier", 22);
+			addKey(keys, name, name_length);
+		}
+
+		for(;;) {
+			Token key = tokenizer.next();
+
+			if(key.type == JSONTokenizer::TOKEN_OBJECT_END) {
+				return true;
+			}
+			if(key.type != JSONTokenizer::TOKEN_KEY || key.escaped) {
+				return false;
+			}
+			// post-processed by JSONDeepParserDec if it is the first member
+			if(nameIs(key.text, key.length, "subscription") || nameIs(key.text, key.length, "group_")) {
+				return false;
+			}
+
+			Token value = tokenizer.next();
+
+			if(response_primitive && nameIs(key.text, key.length, "rqi")) {
+				if(!tokenizer.skipValue(value)) {
+					return false;
+				}
+				continue;
+			}
+
+			size_t name_length;
+			const char* name = longName(key.text, key.length, name_length);
+
+			addKey(keys, name, name_length);
+
+			bool decoded;
+
+			if(value.type == JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+				decoded = decodeObjectMember(frame, nested, parent, name, name_length);
+			} else if(value.type == JSONTokenizer::TOKEN_ARRAY_BEGIN) {
+				decoded = decodeArrayMember(frame, nested, parent, name, name_length);
+			} else {
+				decoded = decodeScalarMember(name, name_length, value);
+			}
+			if(!decoded) {
+				return false;
+			}
+		}
+	}
+
+	/**
+	 * @desc An object member. Its nested members are decoded by a JSONDeepParserDec call of its own, then
+	 *       the parent call replaces the object if it holds arrays with elements: by the last array if its
+	 *       last element is a string, bool or fraction, otherwise by an object of the arrays holding
+	 *       integers or objects (cut after their last integer or object element).
+	 */
+	bool JSONStreamDecoder::decodeObjectMember(size_t frame, bool nested, size_t parent, const char* name, size_t name_length) {
+		JSONTokenizer::State inside = tokenizer.save();
+		std::vector<ConvertedArray> arrays;
+		bool has_object_member = false;
+		KeySet keys;
+
+		if(nested) {
+			for(;;) {
+				Token member = tokenizer.next();
+
+				if(member.type == JSONTokenizer::TOKEN_OBJECT_END) {
+					break;
+				}
+				if(member.type != JSONTokenizer::TOKEN_KEY || member.escaped) {
+					return false;
+				}
+
+				ConvertedArray info = { member, tokenizer.save(), false, false, 0, 0 };
+				Token value = tokenizer.next();
+				bool assigned = false;
+
+				if(value.type != JSONTokenizer::TOKEN_ARRAY_BEGIN) {
+					has_object_member = has_object_member || value.type == JSONTokenizer::TOKEN_OBJECT_BEGIN;
+					if(!tokenizer.skipValue(value)) {
+						return false;
+					}
+					continue;
+				}
+
+				for(Token element = tokenizer.next(); element.type != JSONTokenizer::TOKEN_ARRAY_END; element = tokenizer.next(), info.count++) {
+					JSONNumber number;
+					KeySet element_keys;
+					bool subobject = false;
+
+					switch(element.type) {
+					case JSONTokenizer::TOKEN_STRING:
+					case JSONTokenizer::TOKEN_TRUE:
+					case JSONTokenizer::TOKEN_FALSE:
+						break;
+					case JSONTokenizer::TOKEN_NUMBER:
+						if(!parseNumber(element, number) || (number.kind == JSONNumber::UINT && number.uint_value > 9223372036854775807ULL)) {
+							return false;
+						}
+						if(number.kind == JSONNumber::REAL) {
+							double integral_part;
+
+							if(modf(number.real_value, &integral_part) == 0.0) { // isIntegral() doubles are not streamed
+								return false;
+							}
+						} else {
+							subobject = true;
+						}
+						break;
+					case JSONTokenizer::TOKEN_OBJECT_BEGIN:
+						// decoded with the tempObjClone of both calls, the one of the replaced object is discarded
+						if(!scanObjectKeys(element_keys) || !share(frames[parent].temp_obj_clone, element_keys) ||
+						   !share(frames[frame].temp_obj_clone, element_keys)) {
+							return false;
+						}
+						subobject = true;
+						break;
+					case JSONTokenizer::TOKEN_ARRAY_BEGIN:
+					case JSONTokenizer::TOKEN_NULL:
+						if(!tokenizer.skipValue(element)) {
+							return false;
+						}
+						continue;
+					default:
+						return false;
+					}
+
+					assigned = true;
+					info.subobject_last = subobject;
+					if(subobject) {
+						info.has_subobject = true;
+						info.last_subobject = info.count;
+					}
+				}
+				if(assigned) {
+					arrays.push_back(info);
+				}
+			}
+		}
+
+		if(arrays.empty()) { // the object is kept
+			if(nested) {
+				tokenizer.restore(inside);
+			}
+			writer.key(name, name_length);
+
+			Frame member_frame;
+
+			frames.push_back(member_frame);
+			writer.beginObject();
+			if(!decodeObject(true, frame, keys, false)) {
+				return false;
+			}
+			writer.endObject();
+			frames.pop_back();
+			return share(frames[frame].elem_obj_clone, keys);
+		}
+
+		// the discarded decoding of this object still goes into elemObjClone, and would use the
+		// clones of this call for object members
+		JSONTokenizer::State end = tokenizer.save();
+
+		tokenizer.restore(inside);
+		if(!scanObjectKeys(keys) || has_object_member || !share(frames[frame].elem_obj_clone, keys)) {
+			return false;
+		}
+
+		KeySet sub_keys;
+		size_t best = 0;
+
+		for(size_t i = 0; i < arrays.size(); i++) {
+			if(arrays[i].has_subobject) {
+				size_t array_length;
+				const char* array_name = longName(arrays[i].key.text, arrays[i].key.length, array_length);
+
+				addKey(sub_keys, array_name, array_length);
+			}
+			if(compareKeys(arrays[i].key, arrays[best].key) > 0) {
+				best = i;
+			}
+		}
+		if(!sub_keys.names.empty() && !share(frames[parent].sub_obj_clone, sub_keys)) {
+			return false;
+		}
+
+		writer.key(name, name_length);
+		if(arrays[best].subobject_last) {
+			writer.beginObject();
+			for(size_t i = 0; i < arrays.size(); i++) {
+				if(!arrays[i].has_subobject) {
+					continue;
+				}
+
+				size_t array_length;
+				const char* array_name = longName(arrays[i].key.text, arrays[i].key.length, array_length);
+
+				writer.key(array_name, array_length);
+				tokenizer.restore(arrays[i].before);
+				tokenizer.next();
+				if(!decodeConvertedElements(arrays[i].last_subobject)) {
+					return false;
+				}
+			}
+			writer.endObject();
+		} else {
+			tokenizer.restore(arrays[best].before);
+			tokenizer.next();
+			if(!decodeConvertedElements(arrays[best].count)) {
+				return false;
+			}
+		}
+		tokenizer.restore(end);
+		return true;
+	}
+
+	/**
+	 * @desc the elements of an array replacing its object, up to and including element limit:
+	 *       integers become the long name of their value, nulls and nested arrays are dropped
+	 */
+	bool JSONStreamDecoder::decodeConvertedElements(size_t limit) {
+		writer.beginArray();
+		for(size_t index = 0; ; index++) {
+			Token element = tokenizer.next();
+			JSONNumber number;
+			KeySet keys;
+
+			if(element.type == JSONTokenizer::TOKEN_ARRAY_END) {
+				break;
+			}
+			if(index > limit) {
+				if(!tokenizer.skipValue(element)) {
+					return false;
+				}
+				continue;
+			}
+
+			switch(element.type) {
+			case JSONTokenizer::TOKEN_STRING:
+				if(!writeString(writer, scratch, element)) {
+					return false;
+				}
+				break;
+			case JSONTokenizer::TOKEN_TRUE:
+				writer.rawValue("true", 4);
+				break;
+			case JSONTokenizer::TOKEN_FALSE:
+				writer.rawValue("false", 5);
+				break;
+			case JSONTokenizer::TOKEN_NUMBER:
+				if(!parseNumber(element, number)) {
+					return false;
+				}
+				if(number.kind == JSONNumber::REAL) {
+					writeNumber(writer, number, true);
+				} else {
+					char buffer[32];
+
+					if(number.kind == JSONNumber::INT) {
+						snprintf(buffer, sizeof(buffer), "%lld", number.int_value);
+					} else {
+						snprintf(buffer, sizeof(buffer), "%llu", number.uint_value);
+					}
+					writeLongName(buffer);
+				}
+				break;
+			case JSONTokenizer::TOKEN_OBJECT_BEGIN:
+				// the clones have been checked when the array was scanned
+				if(!decodeElementObject(keys)) {
+					return false;
+				}
+				break;
+			case JSONTokenizer::TOKEN_ARRAY_BEGIN:
+			case JSONTokenizer::TOKEN_NULL:
+				if(!tokenizer.skipValue(element)) {
+					return false;
+				}
+				break;
+			default:
+				return false;
+			}
+		}
+		writer.endArray();
+		return true;
+	}
+
+	/**
+	 * @desc An object array element. JSONDeepParserDec decodes these into its tempObjClone, which is a
+	 *       null Value until a member is set, so an empty object comes out as null.
+	 */
+	bool JSONStreamDecoder::decodeElementObject(KeySet& keys) {
+		if(tokenizer.atContainerEnd()) {
+			tokenizer.next();
+			writer.rawValue("null", 4);
+			keys.names.clear();
+			return true;
+		}
+
+		Frame frame;
+
+		frames.push_back(frame);
+		writer.beginObject();
+		if(!decodeObject(false, 0, keys, false)) {
+			return false;
+		}
+		writer.endObject();
+		frames.pop_back();
+		return true;
+	}
+
+	/**
+	 * @desc An array member. Nested arrays with elements are converted by the parent call: numbers become
+	 *       the long name of their integer value, nulls and nested arrays are dropped. Otherwise arrays are
+	 *       copied, apart from accessControlContexts_list which only keeps its objects.
+	 */
+	bool JSONStreamDecoder::decodeArrayMember(size_t frame, bool nested, size_t parent, const char* name, size_t name_length) {
+		bool access_control_contexts = nameIs(name, name_length, ACCESS_CONTROL_CONTEXTS_LIST);
+
+		writer.key(name, name_length);
+		if(tokenizer.atContainerEnd()) {
+			tokenizer.next();
+			writer.beginArray();
+			writer.endArray();
+			return true;
+		}
+
+		if(!nested && !access_control_contexts) {
+			Token first = { JSONTokenizer::TOKEN_ARRAY_BEGIN, NULL, 0, false, false };
+
+			return copyValue(tokenizer, writer, scratch, first);
+		}
+
+		writer.beginArray();
+		for(;;) {
+			Token element = tokenizer.next();
+			JSONNumber number;
+
+			if(element.type == JSONTokenizer::TOKEN_ARRAY_END) {
+				break;
+			}
+			if(element.type == JSONTokenizer::TOKEN_OBJECT_BEGIN) {
+				// accessControlContexts_list elements are decoded by this call too, and discarded if nested
+				KeySet keys;
+
+				if(!decodeElementObject(keys) || !share(frames[access_control_contexts ? frame : parent].temp_obj_clone, keys) ||
+				   !share(frames[nested ? parent : frame].temp_obj_clone, keys)) {
+					return false;
+				}
+				continue;
+			}
+			if(!nested) {
+				if(!tokenizer.skipValue(element)) {
+					return false;
+				}
+				continue;
+			}
+
+			switch(element.type) {
+			case JSONTokenizer::TOKEN_STRING:
+				if(!writeString(writer, scratch, element)) {
+					return false;
+				}
+				break;
+			case JSONTokenizer::TOKEN_TRUE:
+				writer.rawValue("true", 4);
+				break;
+			case JSONTokenizer::TOKEN_FALSE:
+				writer.rawValue("false", 5);
+				break;
+			case JSONTokenizer::TOKEN_NUMBER: {
+				if(!parseNumber(element, number)) {
+					return false;
+				}
+
+				double value = trunc(number.asDouble()); // float2int() into an int
+
+				if(value < -2147483648.0 || value > 2147483647.0) {
+					return false;
+				}
+
+				char buffer[16];
+
+				snprintf(buffer, sizeof(buffer), "%d", (int)value);
+				writeLongName(buffer);
+				break;
+			}
+			case JSONTokenizer::TOKEN_ARRAY_BEGIN:
+			case JSONTokenizer::TOKEN_NULL:
+				if(!tokenizer.skipValue(element)) {
+					return false;
+				}
+				break;
+			default:
+				return false;
+			}
+		}
+		writer.endArray();
+		return true;
+	}
+
+	bool JSONStreamDecoder::decodeScalarMember(const char* name, size_t name_length, const Token& value) {
+		JSONNumber number;
+
+		switch(value.type) {
+		case JSONTokenizer::TOKEN_STRING:
+			writer.key(name, name_length);
+			if(nameIs(name, name_length, "responseStatusCode")) {
+				if(value.escaped) {
+					return false;
+				}
+				scratch.assign(value.text, value.length);
+				writeLongName(scratch.c_str());
+				return true;
+			}
+			return writeString(writer, scratch, value);
+		case JSONTokenizer::TOKEN_NUMBER:
+			if(!parseNumber(value, number)) {
+				return false;
+			}
+			if(number.kind == JSONNumber::REAL) {
+				double integral_part;
+
+				// isInt()/isInt64() doubles, and fractions which JSONDeepParserDec handles as arrays
+				if(modf(number.real_value, &integral_part) == 0.0 || nameIs(name, name_length, ACCESS_CONTROL_CONTEXTS_LIST)) {
+					return false;
+				}
+			} else if(number.kind == JSONNumber::UINT) {
+				if(number.uint_value > 9223372036854775807ULL && nameIs(name, name_length, ACCESS_CONTROL_CONTEXTS_LIST)) {
+					return false;
+				}
+			} else if(number.int_value >= -2147483647LL - 1) { // isInt()
+				for(const char* const* attribute = DEC_ENUMERATED_ATTRIBUTES; *attribute != NULL; attribute++) {
+					if(nameIs(name, name_length, *attribute)) {
+						char buffer[32];
+
+						snprintf(buffer, sizeof(buffer), "%lld", number.int_value);
+						writer.key(name, name_length);
+						writeLongName(buffer);
+						return true;
+					}
+				}
+			}
+			writer.key(name, name_length);
+			writeNumber(writer, number, false);
+			return true;
+		case JSONTokenizer::TOKEN_TRUE:
+		case JSONTokenizer::TOKEN_FALSE:
+			writer.key(name, name_length);
+			return copyValue(tokenizer, writer, scratch, value);
+		case JSONTokenizer::TOKEN_NULL:
+			writer.key(name, name_length);
+			if(nameIs(name, name_length, ACCESS_CONTROL_CONTEXTS_LIST)) { // Value::size() of null is 0
+				writer.beginArray();
+				writer.endArray();
+			} else {
+				writer.rawValue("null", 4);
+			}
+			return true;
+		default:
+			return false;
+		}
+	}
+}
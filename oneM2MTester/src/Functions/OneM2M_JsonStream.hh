@@ -0,0 +1,275 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_JsonStream.hh
+//  Description:        Streaming JSON tokenizer, writer and long/short name transcoders of the
+//                      oneM2M dual face mapping, used instead of the Json::Value based parsers
+//  Rev:                R2I
+
+#ifndef ONEM2M_JSONSTREAM_HH
+#define ONEM2M_JSONSTREAM_HH
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+#include <TTCN3.hh>
+#include "json-forwards.h"
+#include "OneM2M_DualFaceMapping.hh"
+
+namespace OneM2M__DualFaceMapping {
+
+	/**
+	 * @desc Pull tokenizer over a NUL terminated JSON text. Keys, strings and numbers are returned as
+	 *       slices of the input, separators are checked but not returned. Any syntax error ends the token
+	 *       stream with TOKEN_ERROR.
+	 */
+	class JSONTokenizer {
+	public:
+		enum TokenType {
+			TOKEN_ERROR, TOKEN_END,
+			TOKEN_OBJECT_BEGIN, TOKEN_OBJECT_END, TOKEN_ARRAY_BEGIN, TOKEN_ARRAY_END,
+			TOKEN_KEY, TOKEN_STRING, TOKEN_NUMBER, TOKEN_TRUE, TOKEN_FALSE, TOKEN_NULL
+		};
+
+		struct Token {
+			TokenType type;
+			const char* text;  // without the quotes for keys and strings
+			size_t length;
+			bool escaped;      // key or string contains backslash escapes
+			bool integral;     // number without fraction and exponent
+		};
+
+		// position of the tokenizer, see save() and restore()
+		struct State {
+			const char* pos;
+			size_t depth;
+			int expect;
+			char top;
+		};
+
+		explicit JSONTokenizer(const char* input);
+
+		Token next();
+
+		// skips the rest of a value whose first token has already been read
+		bool skipValue(const Token& first);
+
+		// true if the container that has just been opened is empty
+		bool atContainerEnd();
+
+		size_t depth() const { return stack_depth; }
+
+		State save() const;
+		void restore(const State& state);
+
+	private:
+		bool readKey(Token& token);
+		bool readValue(Token& token);
+		bool readString(Token& token);
+		bool readNumber(Token& token);
+		bool readLiteral(const char* literal, size_t length, TokenType type, Token& token);
+		void push(char container);
+		void pop();
+		void afterValue();
+		void skipWhitespace();
+		Token fail();
+
+		const char* pos;
+		std::string stack; // 'o' or 'a' per open container, only the first stack_depth entries are valid
+		size_t stack_depth;
+		int expect;
+	};
+
+	/**
+	 * @desc Appends JSON to a string with exactly the layout of Json::StyledWriter (3 space indentation,
+	 *       short scalar arrays on one line), so streamed output looks like the output of the DOM parsers.
+	 *       The compact layout has no whitespace at all, like JSON_write_compact().
+	 *       Members may be given in any order, endObject() puts them into the key order of Json::Value.
+	 */
+	class JSONStreamWriter {
+	public:
+		explicit JSONStreamWriter(std::string& output, bool compact_layout = false);
+
+		void beginObject();
+		void endObject();
+		void beginArray();
+		void endArray();
+
+		// the name is not copied, it has to stay valid until the object is ended
+		void key(const char* name, size_t length);
+		void stringValue(const char* value, size_t length);
+		// value that is already formatted, e.g. a number, true, false or null
+		void rawValue(const char* value, size_t length);
+
+		// ends the document with a new line like Json::StyledWriter::write(), nothing in the compact layout
+		void finish();
+
+		// true if an object got the same member name twice, Json::Value would only keep one of them
+		bool hasDuplicateKeys() const { return duplicate_keys; }
+
+	private:
+		struct Frame {
+			bool is_array;
+			bool opened;     // the opening bracket has been written
+			bool multi_line;
+			size_t count;    // members or elements written so far
+			size_t start;    // output offset of the opening bracket
+			size_t elements; // index of the first element offset of this array in element_offsets
+			size_t members;  // index of the first member of this object in members
+		};
+
+		struct Member {
+			const char* name;
+			size_t length;
+			size_t start;    // output offset of the separator before the member
+			size_t end;
+		};
+
+		void beginValue();
+		void open(Frame& frame);
+		void breakLine(size_t level);
+		void toMultiLine(size_t frame_index);
+		void sortMembers(const Frame& frame);
+		void appendQuoted(const char* value, size_t length);
+
+		static bool memberLess(const Member& a, const Member& b);
+
+		std::string& out;
+		bool compact;
+		std::vector<Frame> frames;
+		std::vector<size_t> element_offsets; // output offsets of the elements of single line arrays
+		std::vector<Member> members;         // members of the open objects
+		std::string scratch;
+		bool duplicate_keys;
+	};
+
+	// decodes the escapes of a JSON string the way Json::Reader does, returns false on a bad escape
+	bool JSON_decode_string(const char* text, size_t length, std::string& decoded);
+
+	// writes a Json::Value tree in the compact layout, like Json::FastWriter without the final new line
+	void JSON_write_compact(const Json::Value& value, std::string& output);
+
+	// true if outgoing JSON is written in the compact layout, see the module parameter tsp_compactJsonSerialization
+	bool JSON_compact_serialization();
+
+	// outgoing JSON body of a Json::Value tree, in the configured layout
+	CHARSTRING JSON_wire_string(const Json::Value& value);
+
+	/**
+	 * @desc Single pass long-to-short transcoder for outgoing JSON primitive content, producing the same
+	 *       members and values as JSONDeepParser. Input that needs the special ACP or subscription parsers,
+	 *       or that falls outside what the DOM parser handles in a well defined way, is rejected so the
+	 *       caller can use the DOM based path instead.
+	 */
+	class JSONStreamEncoder {
+	public:
+		JSONStreamEncoder(const char* source, std::string& output, bool compact_layout = false);
+
+		// returns false if the DOM based encoder has to be used for this message
+		bool encode(const OneM2M__Types::AttributeAux__list& p__forcedFields);
+
+	private:
+		typedef JSONTokenizer::Token Token;
+
+		bool encodeMembers();
+		bool encodeNestedMembers(bool resource_level);
+		bool encodeObjectMember(const char* name, size_t name_length, const Token& key, bool resource_level, bool forced_null);
+		bool encodeScalarMember(const char* name, size_t name_length, const Token& value);
+		bool encodeConvertedArray();
+		bool isForcedNull(const char* name, size_t name_length) const;
+		const char* shortName(const char* name, size_t length, size_t& short_length);
+
+		JSONTokenizer tokenizer;
+		JSONStreamWriter writer;
+		std::string scratch;
+		std::vector<const char*> forced_null_names; // short names of the omitted forcedFields that are sent as null
+	};
+
+	/**
+	 * @desc Single pass short-to-long transcoder for received JSON primitive content, producing the same
+	 *       document as f__primitiveContent__Dec with JSONDeepParserDec. JSONDeepParserDec reuses its clone
+	 *       Values between sibling objects; documents where that would show in the result, ACP and
+	 *       subscription/group resources (which get extra post-processing) and anything else the streamer
+	 *       cannot reproduce exactly are rejected so the caller can use the DOM based path instead.
+	 */
+	class JSONStreamDecoder {
+	public:
+		JSONStreamDecoder(const char* source, std::string& output);
+
+		// returns false if the DOM based decoder has to be used for this message
+		bool decode();
+
+	private:
+		typedef JSONTokenizer::Token Token;
+
+		// a member name; it points into the source, the name dictionary or the name arena
+		struct KeyName {
+			const char* name;
+			size_t length;
+		};
+
+		// the long member names of an object, sorted so that the member order does not matter
+		struct KeySet {
+			std::vector<KeyName> names;
+		};
+
+		// A clone Value of one JSONDeepParserDec call that is reused for several objects. Keys of an
+		// earlier object stay in it, which is only invisible if all the objects have the same members.
+		struct SharedClone {
+			SharedClone() : used(false) {}
+
+			bool used;
+			KeySet keys;
+		};
+
+		// the reused clones of one JSONDeepParserDec call
+		struct Frame {
+			SharedClone elem_obj_clone;
+			SharedClone temp_obj_clone;
+			SharedClone sub_obj_clone;
+		};
+
+		// an array member of an object that the parent call replaces by its arrays
+		struct ConvertedArray {
+			Token key;
+			JSONTokenizer::State before; // position before the '['
+			bool subobject_last;         // the last string, bool, number or object is an integer or object
+			bool has_subobject;
+			size_t last_subobject;       // index of the last integer or object element
+			size_t count;
+		};
+
+		bool decodeAggregatedResponse();
+		bool decodeObject(bool nested, size_t parent, KeySet& keys, bool response_primitive);
+		bool decodeObjectMember(size_t frame, bool nested, size_t parent, const char* name, size_t name_length);
+		bool decodeArrayMember(size_t frame, bool nested, size_t parent, const char* name, size_t name_length);
+		bool decodeScalarMember(const char* name, size_t name_length, const Token& value);
+		bool decodeElementObject(KeySet& keys);
+		bool decodeConvertedElements(size_t limit);
+		bool scanObjectKeys(KeySet& keys);
+		bool share(SharedClone& clone, const KeySet& keys);
+		void writeLongName(const char* name);
+		const char* longName(const char* name, size_t length, size_t& long_length);
+
+		static void addKey(KeySet& keys, const char* name, size_t length);
+		static bool keyLess(const KeyName& a, const KeyName& b);
+
+		JSONTokenizer tokenizer;
+		JSONStreamWriter writer;
+		std::string scratch;
+		std::vector<Frame> frames;
+	};
+}
+
+#endif
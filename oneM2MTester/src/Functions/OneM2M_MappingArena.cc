@@ -0,0 +1,96 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_MappingArena.cc
+//  Description:        Per thread documents and buffers reused by the oneM2M dual face mapping functions
+//  Rev:                R2I
+
+#include "OneM2M_MappingArena.hh"
+#include "OneM2M_DualFaceMapping.hh"
+
+namespace OneM2M__DualFaceMapping {
+
+	pthread_key_t MappingArena::key;
+	pthread_once_t MappingArena::key_once = PTHREAD_ONCE_INIT;
+
+	void MappingArena::createKey() {
+		pthread_key_create(&key, destroy);
+	}
+
+	void MappingArena::destroy(void* arena) {
+		delete (MappingArena*)arena;
+	}
+
+	MappingArena& MappingArena::instance() {
+		pthread_once(&key_once, createKey);
+
+		MappingArena* arena = (MappingArena*)pthread_getspecific(key);
+
+		if(arena == NULL) {
+			arena = new MappingArena;
+			pthread_setspecific(key, arena);
+		}
+		return *arena;
+	}
+
+	MappingArena::MappingArena() :
+		source_document(new tinyxml2::XMLDocument), clone_document(new tinyxml2::XMLDocument), source_size(0), clone_size(0) {
+	}
+
+	MappingArena::~MappingArena() {
+		delete source_document;
+		delete clone_document;
+	}
+
+	size_t MappingArena::highWater() {
+		int high_water = (int)OneM2M__Constants::tsp__mappingArenaHighWater;
+
+		return high_water > 0 ? (size_t)high_water : 0;
+	}
+
+	/**
+	 * @desc the pools of a document only grow, a document that has been used for a large message is replaced
+	 */
+	tinyxml2::XMLDocument& MappingArena::reuse(tinyxml2::XMLDocument*& document, size_t& last_size, size_t message_size) {
+		if(last_size > highWater()) {
+			delete document;
+			document = new tinyxml2::XMLDocument;
+		} else {
+			document->Clear();
+		}
+		last_size = message_size;
+		return *document;
+	}
+
+	tinyxml2::XMLDocument& MappingArena::sourceDocument(size_t message_size) {
+		return reuse(source_document, source_size, message_size);
+	}
+
+	tinyxml2::XMLDocument& MappingArena::cloneDocument(size_t message_size) {
+		return reuse(clone_document, clone_size, message_size);
+	}
+
+	Json::Reader& MappingArena::jsonReader() {
+		// parse() resets the reader
+		return json_reader;
+	}
+
+	std::string& MappingArena::outputBuffer() {
+		if(output_buffer.capacity() > highWater()) {
+			std::string().swap(output_buffer);
+		}
+		output_buffer.clear();
+		return output_buffer;
+	}
+}
@@ -0,0 +1,74 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_MappingArena.hh
+//  Description:        Per thread documents and buffers reused by the oneM2M dual face mapping functions
+//  Rev:                R2I
+
+#ifndef ONEM2M_MAPPINGARENA_HH
+#define ONEM2M_MAPPINGARENA_HH
+
+#include <string>
+#include <stddef.h>
+#include <pthread.h>
+#include "tinyxml2.h"
+#include "json.h"
+
+namespace OneM2M__DualFaceMapping {
+
+	/**
+	 * @desc Objects of the encoding/decoding functions that are kept from one message to the next, so the
+	 *       memory pools of the XML documents, the stacks of the JSON reader and the output buffer are
+	 *       reused instead of being allocated again for every message. Everything is handed out empty.
+	 *       Memory grown by a message of more than tsp_mappingArenaHighWater bytes is released on the
+	 *       next hand-out. Each object may only be held by one function at a time.
+	 */
+	class MappingArena {
+	public:
+		// arena of the calling thread
+		static MappingArena& instance();
+
+		// documents for the received message and for the one built from it
+		tinyxml2::XMLDocument& sourceDocument(size_t message_size);
+		tinyxml2::XMLDocument& cloneDocument(size_t message_size);
+
+		Json::Reader& jsonReader();
+
+		// buffer the encoded or decoded text is written to before it is copied into a CHARSTRING
+		std::string& outputBuffer();
+
+	private:
+		MappingArena();
+		~MappingArena();
+		MappingArena(const MappingArena&);
+		MappingArena& operator=(const MappingArena&);
+
+		static void createKey();
+		static void destroy(void* arena);
+		static size_t highWater();
+		static tinyxml2::XMLDocument& reuse(tinyxml2::XMLDocument*& document, size_t& last_size, size_t message_size);
+
+		static pthread_key_t key;
+		static pthread_once_t key_once;
+
+		tinyxml2::XMLDocument* source_document;
+		tinyxml2::XMLDocument* clone_document;
+		size_t source_size; // size of the message the documents were last handed out for
+		size_t clone_size;
+		Json::Reader json_reader;
+		std::string output_buffer;
+	};
+}
+
+#endif
@@ -0,0 +1,2639 @@
+//  File:               OneM2M_NameDictionary.hh
+//  Description:        Compiled-in oneM2M long/short name mapping tables
+//
+//  GENERATED by Lib/ResourceMappingTable/gen_name_dictionary.py from
+//  long_to_short_mapping.txt and short_to_long_mapping.txt, DO NOT EDIT.
+
+#ifndef ONEM2M_NAMEDICTIONARY_HH
+#define ONEM2M_NAMEDICTIONARY_HH
+
+#include "OneM2M_NameMapping.hh"
+
+namespace OneM2M__DualFaceMapping {
+
+	static const char NAME_DICTIONARY_L2S_STRINGS[] =
+	"nodeID\0" "ni\0"
+	"targetNetwork\0" "ttn\0"
+	"CSE-ID\0" "csi\0"
+	"number\0" "num\0"
+	"accessControlContexts\0" "acco\0"
+	"aggregatedNotification\0" "m2m:agn\0"
+	"cmdhPolicyName\0" "cpn\0"
+	"collectedEntityID\0" "cdi\0"
+	"rebootAnnc\0" "rboA\0"
+	"deliveryMetaData\0" "dmd\0"
+	"int10024\0" "10024\0"
+	"deviceType\0" "dty\0"
+	"currentNrOfMembers\0" "cnm\0"
+	"dataContainerID\0" "dcid\0"
+	"filterCriteria\0" "fc\0"
+	"locationTargetID\0" "lot\0"
+	"esprimRandID\0" "esri\0"
+	"serviceSubscribedAppRule\0" "m2m:asar\0"
+	"schedule\0" "m2m:sch\0"
+	"additionalBackoffTime\0" "abt\0"
+	"resourceIDs\0" "ris\0"
+	"execDisable\0" "exd\0"
+	"contentSize\0" "cs\0"
+	"int36\0" "36\0"
+	"certificates\0" "escert\0"
+	"execInstance\0" "exin\0"
+	"int20\0" "20\0"
+	"IPEDiscoveryRequest\0" "idr\0"
+	"requestID\0" "rid\0"
+	"activeCmdhPolicyLink\0" "acmlk\0"
+	"devStatus\0" "ss\0"
+	"from\0" "fr\0"
+	"accessControlPolicyAnnc\0" "m2m:acpA\0"
+	"statsCollectID\0" "sci\0"
+	"int10028\0" "10028\0"
+	"expirationTime\0" "et\0"
+	"firmware\0" "fwr\0"
+	"descriptor\0" "dsp\0"
+	"initialBackoffTime\0" "ibt\0"
+	"int1\0" "1\0"
+	"int52\0" "52\0"
+	"int30\0" "30\0"
+	"periodicIntervalTime\0" "pit\0"
+	"update\0" "ud\0"
+	"int7\0" "7\0"
+	"dataLink\0" "dali\0"
+	"areaNwkInfoAnnc\0" "aniA\0"
+	"notificationTargetPolicy\0" "ntp\0"
+	"tokenLink\0" "rltl\0"
+	"inputLinks\0" "giil\0"
+	"softwareUninstall\0" "swun\0"
+	"locationUpdatePeriod\0" "lou\0"
+	"AE-ID\0" "aei\0"
+	"svcFwWrapperAnnc\0" "ajfwa\0"
+	"serviceRoles\0" "svr\0"
+	"semanticOpExec\0" "soe\0"
+	"contentOffset\0" "cnot\0"
+	"networkAction\0" "nwa\0"
+	"Link\0" "lnk\0"
+	"operationMonitor_list\0" "om\0"
+	"cmdhLimits\0" "cml\0"
+	"ipv6Address\0" "ip6\0"
+	"operationState\0" "gios\0"
+	"esprimObject\0" "epo\0"
+	"modifiedSince\0" "ms\0"
+	"notificationCongestionPolicy\0" "ncp\0"
+	"aEAnnc\0" "m2m:aeA\0"
+	"currentByteSize\0" "cbs\0"
+	"int10002\0" "10002\0"
+	"attribute\0" "atr\0"
+	"proposedPrivilegesLifetime\0" "ppl\0"
+	"uRI\0" "m2m:uri\0"
+	"input\0" "inp\0"
+	"childResourceType\0" "chty\0"
+	"dynamicAuthorizationConsultation\0" "dac\0"
+	"filesize\0" "fsi\0"
+	"accessId\0" "aci\0"
+	"allowedApp-IDs\0" "aai\0"
+	"allJoynSvcObject\0" "ajso\0"
+	"deletionRules\0" "dr\0"
+	"memberTypeValidated\0" "mtv\0"
+	"specializationID\0" "spid\0"
+	"primitiveContent\0" "pc\0"
+	"notificationEvent\0" "nev\0"
+	"int33\0" "33\0"
+	"capabilityName\0" "can\0"
+	"interfaceIntrospectXmlRef\0" "ajir\0"
+	"swVersion\0" "swv\0"
+	"statsCollect\0" "m2m:stcl\0"
+	"cmdhNetworkAccessRules\0" "cmnr\0"
+	"locationStatus\0" "lost\0"
+	"target\0" "tg\0"
+	"dynamicAuthorizationEnabled\0" "dae\0"
+	"securityInfoType\0" "sit\0"
+	"role\0" "rol\0"
+	"genericInterworkingServiceAnnc\0" "m2m:gisa\0"
+	"defaultDelAggregation\0" "dda\0"
+	"request\0" "m2m:req\0"
+	"eventCategory\0" "ec\0"
+	"UUID\0" "uuid\0"
+	"cmdhDefEcValue\0" "cmdv\0"
+	"allJoynMethodCallAnnc\0" "ajmca\0"
+	"batteryLevel\0" "btl\0"
+	"factoryReset\0" "far\0"
+	"providedToNSE\0" "ptn\0"
+	"creator\0" "cr\0"
+	"requestReachability\0" "rr\0"
+	"aE_update_invalid\0" "m2m:ae\0"
+	"announceTo\0" "at\0"
+	"cSE_ID\0" "csi\0"
+	"maxNrOfNotify\0" "mnn\0"
+	"int10013\0" "10013\0"
+	"maximumBackoffTime\0" "mbt\0"
+	"notificationStoragePriority\0" "nsp\0"
+	"notificationForwardingURI\0" "nfu\0"
+	"deactivate\0" "dea\0"
+	"sleepInterval\0" "sli\0"
+	"resourceID\0" "ri\0"
+	"evenStart\0" "evs\0"
+	"fileType\0" "ftyp\0"
+	"allJoynSvcObjectAnnc\0" "ajsoa\0"
+	"aCP_update_invalid\0" "m2m:acp\0"
+	"firmwareName\0" "fwn\0"
+	"CSEBase\0" "cb\0"
+	"objectIDs\0" "obis\0"
+	"requestContext\0" "rct\0"
+	"Trigger-Recipient-ID\0" "tri\0"
+	"int45\0" "45\0"
+	"discoveryResultType\0" "drt\0"
+	"int28\0" "28\0"
+	"minReqVolume\0" "mrv\0"
+	"timeOfDay\0" "tod\0"
+	"originatingTimestamp\0" "ot\0"
+	"consistencyStrategy\0" "csy\0"
+	"softwareName\0" "swn\0"
+	"subscriberURI\0" "su\0"
+	"accessControlObjectDetails_list\0" "acod\0"
+	"int49\0" "49\0"
+	"eventNotificationCriteria\0" "enc\0"
+	"escertkeMessage\0" "eckm\0"
+	"remoteCSEAnnc\0" "m2m:csrA\0"
+	"allowedAEs\0" "aae\0"
+	"roleName\0" "rlnm\0"
+	"action\0" "ac\0"
+	"disable\0" "dis\0"
+	"genericInterworkingService\0" "m2m:gis\0"
+	"securityInfo\0" "m2m:seci\0"
+	"areaNwkDeviceInfo\0" "andi\0"
+	"int15\0" "15\0"
+	"eventType\0" "evt\0"
+	"model\0" "mod\0"
+	"relatedSemantics\0" "rels\0"
+	"int10004\0" "10004\0"
+	"scheduleAnnc\0" "m2m:schA\0"
+	"unmodifiedSince\0" "us\0"
+	"int27\0" "27\0"
+	"dataSize\0" "ds\0"
+	"notBefore\0" "tknb\0"
+	"currentState\0" "cus\0"
+	"notificationContentType\0" "nct\0"
+	"securedDasRequest\0" "sdr\0"
+	"output\0" "out\0"
+	"responsePrimitive\0" "m2m:rsp\0"
+	"semanticDescriptor\0" "m2m:smd\0"
+	"dynamicAuthorizationPoA\0" "dap\0"
+	"int54\0" "54\0"
+	"int38\0" "38\0"
+	"listOfDevices\0" "ldv\0"
+	"defaultRequestExpTime\0" "dqet\0"
+	"targetedResourceType\0" "trt\0"
+	"uRL\0" "m2m:url\0"
+	"ruleLinks\0" "rlk\0"
+	"debugInfo\0" "m2m:dbg\0"
+	"activeStatus\0" "acts\0"
+	"devId\0" "dvd\0"
+	"localTokenIDs\0" "ltids\0"
+	"pendingNotification\0" "pn\0"
+	"trafficPattern\0" "trpt\0"
+	"deviceCapabilityAnnc\0" "dvcA\0"
+	"int62\0" "62\0"
+	"semanticSupportIndicator\0" "ssi\0"
+	"delivery\0" "m2m:dlv\0"
+	"int19\0" "19\0"
+	"allJoynMethodAnnc\0" "ajmda\0"
+	"execEnable\0" "exe\0"
+	"execMode\0" "exm\0"
+	"int44\0" "44\0"
+	"MSISDN\0" "msd\0"
+	"latest\0" "la\0"
+	"softwareInstall\0" "swin\0"
+	"int10009\0" "10009\0"
+	"int0\0" "0\0"
+	"remoteCSE\0" "m2m:csr\0"
+	"locationPolicyAnnc\0" "m2m:lcpA\0"
+	"limitsOpExecTime\0" "loet\0"
+	"operationResult\0" "ors\0"
+	"accessControlPolicyIDs\0" "acpi\0"
+	"to_\0" "to\0"
+	"localTokenID\0" "lti\0"
+	"int10034\0" "10034\0"
+	"requestPrimitive\0" "m2m:rqp\0"
+	"cmdhPolicy\0" "cmp\0"
+	"logStart\0" "lga\0"
+	"execResult\0" "exr\0"
+	"int3\0" "3\0"
+	"notification\0" "m2m:sgn\0"
+	"from_\0" "fr\0"
+	"int35\0" "35\0"
+	"timeSeriesInstance\0" "tsi\0"
+	"limitsRequestExpTime\0" "lqet\0"
+	"locationServer\0" "lor\0"
+	"int10010\0" "10010\0"
+	"description\0" "dc\0"
+	"e2eSecInfo\0" "esi\0"
+	"missingDataMaxNr\0" "mdn\0"
+	"genericInterworkingOperationInstance\0" "m2m:gio\0"
+	"operationMonitor\0" "om\0"
+	"source\0" "sr\0"
+	"verificationRequest\0" "vrq\0"
+	"logData\0" "lgd\0"
+	"membersAccessControlPolicyIDs\0" "macp\0"
+	"localTokenIdAssignment\0" "ltia\0"
+	"execReqArgs\0" "exra\0"
+	"labels\0" "lbl\0"
+	"currentNrOfInstances\0" "cni\0"
+	"limitsDelAggregation\0" "lda\0"
+	"permissions\0" "tkps\0"
+	"software\0" "swr\0"
+	"subscriptionReference\0" "sur\0"
+	"svcObjWrapper\0" "ajsw\0"
+	"deviceLabel\0" "dlb\0"
+	"int21\0" "21\0"
+	"hostedCSELink\0" "hcl\0"
+	"trafficPatternAnnc\0" "trptA\0"
+	"appName\0" "apn\0"
+	"int58\0" "58\0"
+	"maxNrOfMembers\0" "mnm\0"
+	"cmdhNwAccessRule\0" "cmwr\0"
+	"contentFilterQuery\0" "cfq\0"
+	"m2mServiceSubscriptionProfile\0" "m2m:mssp\0"
+	"anyArg\0" "any\0"
+	"requestCharacteristics\0" "rch\0"
+	"memberIDs\0" "mid\0"
+	"ipv6Addresses\0" "ipv6\0"
+	"preSubscriptionNotify\0" "psn\0"
+	"accessControlAuthenticationFlag\0" "acaf\0"
+	"optionalRandomBackoffTime\0" "rbt\0"
+	"int37\0" "37\0"
+	"logStop\0" "lgo\0"
+	"stateTag\0" "st\0"
+	"order\0" "od\0"
+	"pollingChannel\0" "m2m:pch\0"
+	"dasInfo\0" "dasi\0"
+	"serviceSubscribedNode\0" "svsn\0"
+	"eventCatType\0" "ect\0"
+	"int48\0" "48\0"
+	"selfPrivileges\0" "pvs\0"
+	"contentInstance\0" "m2m:cin\0"
+	"containerDefinition\0" "cnd\0"
+	"applicableEventCategory\0" "aec\0"
+	"URIReference\0" "urir\0"
+	"batchNotify\0" "bn\0"
+	"softwareUpdate\0" "swup\0"
+	"download\0" "dld\0"
+	"limitsEventCategory\0" "lec\0"
+	"container\0" "m2m:cnt\0"
+	"limitsRespPersistence\0" "lrp\0"
+	"int16\0" "16\0"
+	"applicableCredIDs\0" "apci\0"
+	"locationContainerID\0" "loi\0"
+	"representation\0" "rep\0"
+	"cmdhDefaults\0" "cmdf\0"
+	"int22\0" "22\0"
+	"int61\0" "61\0"
+	"backOffParameters\0" "bop\0"
+	"createdBefore\0" "crb\0"
+	"createdAfter\0" "cra\0"
+	"genericInterworkingOperationInstanceAnnc\0" "m2m:gioa\0"
+	"allJoynProperty\0" "ajpr\0"
+	"creationTime\0" "ct\0"
+	"inputDataPointLinks\0" "giip\0"
+	"groupID\0" "gpi\0"
+	"subscription\0" "m2m:sub\0"
+	"int50\0" "50\0"
+	"execTarget\0" "ext\0"
+	"esprimRandValue\0" "esrv\0"
+	"storagePriority\0" "sgp\0"
+	"sleepDuration\0" "sld\0"
+	"memTotal\0" "mmt\0"
+	"cmdType\0" "cmt\0"
+	"allowedRole-IDs\0" "ari\0"
+	"container_update_invalid\0" "m2m:cnt\0"
+	"resourceRefList\0" "m2m:rrl\0"
+	"areaNwkDeviceInfoAnnc\0" "andiA\0"
+	"int47\0" "47\0"
+	"validityTime\0" "vdt\0"
+	"circRegion\0" "accr\0"
+	"group_update_invalid\0" "m2m:grp\0"
+	"contentInstanceAnnc\0" "m2m:cinA\0"
+	"flexContainer\0" "m2m:fcnt\0"
+	"esprimKeyGenAlgIDs\0" "esks\0"
+	"int63\0" "63\0"
+	"locationSource\0" "los\0"
+	"int10029\0" "10029\0"
+	"responseTypeValue\0" "rtv\0"
+	"reset\0" "rst\0"
+	"operationType\0" "opt\0"
+	"lifespan\0" "Ls\0"
+	"assignedTokenIdentifiers\0" "ati\0"
+	"password\0" "pwd\0"
+	"deviceInfoAnnc\0" "dviA\0"
+	"timeWindow\0" "tww\0"
+	"roleIDsFromACPs\0" "rfa\0"
+	"int10018\0" "10018\0"
+	"eventCatNo\0" "ecn\0"
+	"areaNwkType\0" "ant\0"
+	"URL\0" "url\0"
+	"stationaryIndication\0" "sti\0"
+	"ipv4Addresses\0" "ipv4\0"
+	"successURL\0" "surl\0"
+	"int25\0" "25\0"
+	"notificationEventType\0" "net\0"
+	"batteryAnnc\0" "batA\0"
+	"accessControlRule_list\0" "acr\0"
+	"contentRef\0" "conr\0"
+	"areaNwkId\0" "awi\0"
+	"filterUsage\0" "fu\0"
+	"collectingEntityID\0" "cei\0"
+	"int2\0" "2\0"
+	"int18\0" "18\0"
+	"execNumber\0" "exn\0"
+	"accessControlOriginators\0" "acor\0"
+	"requestIdentifier\0" "rqi\0"
+	"notificationEventType_list\0" "net\0"
+	"int10003\0" "10003\0"
+	"installStatus\0" "ins\0"
+	"firmwareAnnc\0" "fwrA\0"
+	"eventEnd\0" "eve\0"
+	"locationID\0" "li\0"
+	"tokenID\0" "tkid\0"
+	"accessControlOperations\0" "acop\0"
+	"deviceIdentifier\0" "di\0"
+	"outputLinks\0" "giol\0"
+	"eventLogAnnc\0" "evlA\0"
+	"resultContent\0" "rcn\0"
+	"tracingOption\0" "tcop\0"
+	"allJoynAppAnnc\0" "ajapa\0"
+	"privileges\0" "pv\0"
+	"maxBufferSize\0" "mbfs\0"
+	"int26\0" "26\0"
+	"int41\0" "41\0"
+	"policyLabel\0" "plbl\0"
+	"name\0" "nm\0"
+	"esprimRandExpiry\0" "esrx\0"
+	"notificationlPolicyID\0" "npi\0"
+	"activeCmdhPolicy\0" "acmp\0"
+	"groupRequestIdentifier\0" "gid\0"
+	"int60\0" "60\0"
+	"dataGenerationTime\0" "dgt\0"
+	"notificationEventCat\0" "nec\0"
+	"outputDataPointLinks\0" "giop\0"
+	"countryCode\0" "accc\0"
+	"mgmtClientAddress\0" "mgca\0"
+	"periodicDurationTime\0" "pdt\0"
+	"childResource\0" "ch\0"
+	"operationName\0" "gion\0"
+	"logStatus\0" "lgst\0"
+	"accessControlIpAddresses\0" "acip\0"
+	"requestedValue\0" "rqv\0"
+	"int23\0" "23\0"
+	"allJoynMethodCall\0" "ajmc\0"
+	"serviceName\0" "gisn\0"
+	"callStatus\0" "clst\0"
+	"permission\0" "pm\0"
+	"originatorRoleIDs\0" "orid\0"
+	"dynamicAuthorizationLifetime\0" "dal\0"
+	"deviceInfo\0" "dvi\0"
+	"svcFwWrapper\0" "ajfw\0"
+	"allJoynInterface\0" "ajif\0"
+	"group_\0" "m2m:grp\0"
+	"upload\0" "uld\0"
+	"operation\0" "op\0"
+	"content\0" "con\0"
+	"manufacturer\0" "man\0"
+	"schedule_update_invalid\0" "m2m:sch\0"
+	"mgmtDefinition\0" "mgd\0"
+	"startTime\0" "stt\0"
+	"uninstall\0" "un\0"
+	"fwVersion\0" "fwv\0"
+	"targetFile\0" "tgf\0"
+	"eventLog\0" "evl\0"
+	"memoryAnnc\0" "memA\0"
+	"tokenName\0" "tknm\0"
+	"app_ID\0" "api\0"
+	"cseType\0" "cst\0"
+	"dasResponse\0" "dres\0"
+	"token\0" "tk\0"
+	"subscriptionDeletion\0" "sud\0"
+	"completeTime\0" "cpt\0"
+	"execDelay\0" "exy\0"
+	"containerAnnc\0" "m2m:cntA\0"
+	"groupAnnc\0" "m2m:grpA\0"
+	"maxInstanceAge\0" "mia\0"
+	"missingDataCurrentNr\0" "mdc\0"
+	"announcedAttribute\0" "aa\0"
+	"scheduleEntry\0" "sce\0"
+	"executionEnvRef\0" "eer\0"
+	"sizeAbove\0" "sza\0"
+	"username\0" "unm\0"
+	"mgmtCmd\0" "m2m:mgc\0"
+	"delaySeconds\0" "dss\0"
+	"updateStatus\0" "uds\0"
+	"missingDataDetectTimer\0" "mdt\0"
+	"softwareAnnc\0" "swrA\0"
+	"stateTagSmaller\0" "sts\0"
+	"int10014\0" "10014\0"
+	"extension\0" "tkex\0"
+	"int5\0" "5\0"
+	"allJoynApp\0" "ajap\0"
+	"sequenceNr\0" "snr\0"
+	"sizeBelow\0" "szb\0"
+	"tokenRequestInformation\0" "tqf\0"
+	"maxByteSize\0" "mbs\0"
+	"status\0" "sus\0"
+	"subscription_update_invalid\0" "m2m:sub\0"
+	"dynamicAuthorizationConsultationIDs\0" "daci\0"
+	"roleID\0" "rlid\0"
+	"allJoynMethod\0" "ajmd\0"
+	"locationPolicy_update_invalid\0" "m2m:lcp\0"
+	"esprimProtocolAndAlgIDs\0" "espa\0"
+	"int8\0" "8\0"
+	"group\0" "grp\0"
+	"parentID\0" "pi\0"
+	"dasRequest\0" "dreq\0"
+	"defaultResultExpTime\0" "dset\0"
+	"accessControlWindow_list\0" "actw\0"
+	"int14\0" "14\0"
+	"oldest\0" "ol\0"
+	"statsRuleStatus\0" "srs\0"
+	"tokens\0" "tkns\0"
+	"int4\0" "4\0"
+	"supportedResourceType\0" "srt\0"
+	"duration\0" "dur\0"
+	"operationExecutionTime\0" "oet\0"
+	"offset\0" "ofst\0"
+	"int43\0" "43\0"
+	"objectPaths\0" "obps\0"
+	"triggerReferenceNumber\0" "trn\0"
+	"filterOperation\0" "fo\0"
+	"applicableEventCategories\0" "aecs\0"
+	"level\0" "lvl\0"
+	"mgmtLink\0" "cmlk\0"
+	"maxNrOfInstances\0" "mni\0"
+	"allJoynInterfaceAnnc\0" "ajifa\0"
+	"responseType\0" "rt\0"
+	"int53\0" "53\0"
+	"attached\0" "att\0"
+	"originatorIP\0" "oip\0"
+	"accessControlObjectDetails\0" "acod\0"
+	"esprimKeyGenAlgID\0" "esk\0"
+	"grantedPrivileges\0" "gp\0"
+	"responseStatusCode\0" "rsc\0"
+	"groupName\0" "gn\0"
+	"rateLimit\0" "rl\0"
+	"node\0" "m2m:nod\0"
+	"requestExpirationTimestamp\0" "rqet\0"
+	"memory\0" "mem\0"
+	"execFrequency\0" "exf\0"
+	"int29\0" "29\0"
+	"int10001\0" "10001\0"
+	"missingDataList\0" "mdlt\0"
+	"deliveryAggregation\0" "da\0"
+	"limitsResultExpTime\0" "lset\0"
+	"accessControlRule\0" "acr\0"
+	"notificationURI\0" "nu\0"
+	"int31\0" "31\0"
+	"allJoynPropertyAnnc\0" "ajpra\0"
+	"int17\0" "17\0"
+	"statModel\0" "sm\0"
+	"timeSeries\0" "ts\0"
+	"attributeList\0" "m2m:atrl\0"
+	"svcObjWrapperAnnc\0" "ajswa\0"
+	"ontologyRef\0" "or\0"
+	"version\0" "vr\0"
+	"aggregatedResponse\0" "m2m:agr\0"
+	"battery\0" "bat\0"
+	"audience\0" "tkau\0"
+	"App-ID\0" "api\0"
+	"int10030\0" "10030\0"
+	"int32\0" "32\0"
+	"defaultRespPersistence\0" "drp\0"
+	"direction\0" "dir\0"
+	"backOffParametersSet\0" "bops\0"
+	"objectPath\0" "ajop\0"
+	"locationContainerName\0" "lon\0"
+	"resourceName\0" "rn\0"
+	"expireAfter\0" "exa\0"
+	"batteryStatus\0" "bts\0"
+	"eventCat\0" "ec\0"
+	"statsConfig\0" "m2m:stcg\0"
+	"originatorLocation\0" "olo\0"
+	"notificationTargetURI\0" "ntu\0"
+	"memAvailable\0" "mma\0"
+	"lastModifiedTime\0" "lt\0"
+	"limit\0" "lim\0"
+	"pollingChannelURI\0" "pcu\0"
+	"requestOrigin\0" "ror\0"
+	"aE\0" "m2m:ae\0"
+	"enable\0" "ena\0"
+	"holder\0" "tkhd\0"
+	"nodeAnnc\0" "m2m:nodA\0"
+	"capabilityActionStatus\0" "cas\0"
+	"contentInfo\0" "cnf\0"
+	"contentSerialization\0" "csz\0"
+	"accessControlContexts_list\0" "acco\0"
+	"reboot\0" "rbo\0"
+	"pollingChannel_update_invalid\0" "m2m:pch\0"
+	"memberType\0" "mt\0"
+	"timeSeriesInstanceAnnc\0" "tsia\0"
+	"int10016\0" "10016\0"
+	"int57\0" "57\0"
+	"resourceType\0" "ty\0"
+	"semanticDescriptorAnnc\0" "m2m:smdA\0"
+	"eventID\0" "evi\0"
+	"disableRetrieval\0" "disr\0"
+	"privilegesLifetime\0" "pl\0"
+	"contentStatus\0" "cnst\0"
+	"cSEBase\0" "m2m:cb\0"
+	"int9\0" "9\0"
+	"value\0" "val\0"
+	"sharedReceiverESPrimRandObject\0" "esro\0"
+	"tokenIDs\0" "tids\0"
+	"int6\0" "6\0"
+	"notificationTargetSelfReference\0" "ntsr\0"
+	"int56\0" "56\0"
+	"descriptorRepresentation\0" "dcrp\0"
+	"nodeLink\0" "nl\0"
+	"defEcValue\0" "dev\0"
+	"int10\0" "10\0"
+	"esprimRandObject\0" "ero\0"
+	"defaultOpExecTime\0" "doet\0"
+	"int10033\0" "10033\0"
+	"devType\0" "dvt\0"
+	"accessControlLocationRegion\0" "aclr\0"
+	"requestStatus\0" "rs\0"
+	"mgmtResource\0" "m2m:mgRsc\0"
+	"pointOfAccess\0" "poa\0"
+	"int51\0" "51\0"
+	"dataLinkEntry\0" "dle\0"
+	"semanticFanOutPoint\0" "sfop\0"
+	"missingData\0" "md\0"
+	"fanOutPoint\0" "fopt\0"
+	"tokenRequestIndicator\0" "tqi\0"
+	"dynamicACPInfo\0" "dai\0"
+	"eventConfig\0" "evcg\0"
+	"scheduleElement\0" "se\0"
+	"dataSizeIndicator\0" "dsi\0"
+	"issuer\0" "tkis\0"
+	"aggregatedRequest\0" "arq\0"
+	"supportede2ESecFeatures\0" "esf\0"
+	"deviceCapability\0" "dvc\0"
+	"execStatus\0" "exs\0"
+	"currentValue\0" "crv\0"
+	"announcedMgmtResource\0" "m2m:mgoA\0"
+	"ipv4Address\0" "ip4\0"
+	"deletionRulesRelation\0" "drr\0"
+	"resource\0" "m2m:rce\0"
+	"int24\0" "24\0"
+	"listOfNeighbors\0" "lnh\0"
+	"periodicIndicator\0" "pri\0"
+	"hwVersion\0" "hwv\0"
+	"spreadingWaitTime\0" "swt\0"
+	"to\0" "to\0"
+	"rulesRelationship\0" "rrs\0"
+	"roleIDs\0" "rids\0"
+	"int40\0" "40\0"
+	"cmdhEcDefParamValues\0" "cmpv\0"
+	"activate\0" "act\0"
+	"latestNotify\0" "ln\0"
+	"int12\0" "12\0"
+	"stateTagBigger\0" "stb\0"
+	"logTypeId\0" "lgt\0"
+	"type\0" "typ\0"
+	"resultExpirationTimestamp\0" "rset\0"
+	"int39\0" "39\0"
+	"requestContextNotification\0" "rctn\0"
+	"notificationTargetMgmtPolicyRef\0" "ntpr\0"
+	"resultPersistence\0" "rp\0"
+	"contentType\0" "cty\0"
+	"attributeName\0" "atn\0"
+	"missingDataDetect\0" "mdd\0"
+	"policyDeletionRules\0" "pdr\0"
+	"resourceRef\0" "rrf\0"
+	"aE_ID\0" "aei\0"
+	"collectPeriod\0" "cp\0"
+	"requestTimestamp\0" "rts\0"
+	"cmdhBuffer\0" "cmbf\0"
+	"locationRegions\0" "lr\0"
+	"tokenObject\0" "tkob\0"
+	"semanticsFilter\0" "smf\0"
+	"tracingInfo\0" "tcin\0"
+	"int11\0" "11\0"
+	"int46\0" "46\0"
+	"contentFilterSyntax\0" "cfs\0"
+	"int55\0" "55\0"
+	"install\0" "in\0"
+	"accessControlPolicy\0" "m2m:acp\0"
+	"int34\0" "34\0"
+	"expirationCounter\0" "exc\0"
+	"int13\0" "13\0"
+	"int42\0" "42\0"
+	"periodicInterval\0" "pei\0"
+	"areaNwkInfo\0" "ani\0"
+	"originator\0" "org\0"
+	"int59\0" "59\0"
+	"targetedResourceID\0" "trid\0"
+	"locationPolicy\0" "m2m:lcp\0"
+	"expireBefore\0" "exb\0"
+	"metaInformation\0" "mi\0"
+	"uRIList\0" "m2m:uril\0"
+	"otherConditions\0" "ohc\0"
+	"timeSeriesAnnc\0" "tsa\0"
+	"M2M-Ext-ID\0" "mei\0"
+	"notAfter\0" "tkna\0";
+
+	static const NameDictionaryEntry NAME_DICTIONARY_L2S_ENTRIES[624] = {
+		{0, 6, 7, 2}, // nodeID=ni
+		{10, 13, 24, 3}, // targetNetwork=ttn
+		{28, 6, 35, 3}, // CSE-ID=csi
+		{39, 6, 46, 3}, // number=num
+		{50, 21, 72, 4}, // accessControlContexts=acco
+		{77, 22, 100, 7}, // aggregatedNotification=m2m:agn
+		{108, 14, 123, 3}, // cmdhPolicyName=cpn
+		{127, 17, 145, 3}, // collectedEntityID=cdi
+		{149, 10, 160, 4}, // rebootAnnc=rboA
+		{165, 16, 182, 3}, // deliveryMetaData=dmd
+		{186, 8, 195, 5}, // int10024=10024
+		{201, 10, 212, 3}, // deviceType=dty
+		{216, 18, 235, 3}, // currentNrOfMembers=cnm
+		{239, 15, 255, 4}, // dataContainerID=dcid
+		{260, 14, 275, 2}, // filterCriteria=fc
+		{278, 16, 295, 3}, // locationTargetID=lot
+		{299, 12, 312, 4}, // esprimRandID=esri
+		{317, 24, 342, 8}, // serviceSubscribedAppRule=m2m:asar
+		{351, 8, 360, 7}, // schedule=m2m:sch
+		{368, 21, 390, 3}, // additionalBackoffTime=abt
+		{394, 11, 406, 3}, // resourceIDs=ris
+		{410, 11, 422, 3}, // execDisable=exd
+		{426, 11, 438, 2}, // contentSize=cs
+		{441, 5, 447, 2}, // int36=36
+		{450, 12, 463, 6}, // certificates=escert
+		{470, 12, 483, 4}, // execInstance=exin
+		{488, 5, 494, 2}, // int20=20
+		{497, 19, 517, 3}, // IPEDiscoveryRequest=idr
+		{521, 9, 531, 3}, // requestID=rid
+		{535, 20, 556, 5}, // activeCmdhPolicyLink=acmlk
+		{562, 9, 572, 2}, // devStatus=ss
+		{575, 4, 580, 2}, // from=fr
+		{583, 23, 607, 8}, // accessControlPolicyAnnc=m2m:acpA
+		{616, 14, 631, 3}, // statsCollectID=sci
+		{635, 8, 644, 5}, // int10028=10028
+		{650, 14, 665, 2}, // expirationTime=et
+		{668, 8, 677, 3}, // firmware=fwr
+		{681, 10, 692, 3}, // descriptor=dsp
+		{696, 18, 715, 3}, // initialBackoffTime=ibt
+		{719, 4, 724, 1}, // int1=1
+		{726, 5, 732, 2}, // int52=52
+		{735, 5, 741, 2}, // int30=30
+		{744, 20, 765, 3}, // periodicIntervalTime=pit
+		{769, 6, 776, 2}, // update=ud
+		{779, 4, 784, 1}, // int7=7
+		{786, 8, 795, 4}, // dataLink=dali
+		{800, 15, 816, 4}, // areaNwkInfoAnnc=aniA
+		{821, 24, 846, 3}, // notificationTargetPolicy=ntp
+		{850, 9, 860, 4}, // tokenLink=rltl
+		{865, 10, 876, 4}, // inputLinks=giil
+		{881, 17, 899, 4}, // softwareUninstall=swun
+		{904, 20, 925, 3}, // locationUpdatePeriod=lou
+		{929, 5, 935, 3}, // AE-ID=aei
+		{939, 16, 956, 5}, // svcFwWrapperAnnc=ajfwa
+		{962, 12, 975, 3}, // serviceRoles=svr
+		{979, 14, 994, 3}, // semanticOpExec=soe
+		{998, 13, 1012, 4}, // contentOffset=cnot
+		{1017, 13, 1031, 3}, // networkAction=nwa
+		{1035, 4, 1040, 3}, // Link=lnk
+		{1044, 21, 1066, 2}, // operationMonitor_list=om
+		{1069, 10, 1080, 3}, // cmdhLimits=cml
+		{1084, 11, 1096, 3}, // ipv6Address=ip6
+		{1100, 14, 1115, 4}, // operationState=gios
+		{1120, 12, 1133, 3}, // esprimObject=epo
+		{1137, 13, 1151, 2}, // modifiedSince=ms
+		{1154, 28, 1183, 3}, // notificationCongestionPolicy=ncp
+		{1187, 6, 1194, 7}, // aEAnnc=m2m:aeA
+		{1202, 15, 1218, 3}, // currentByteSize=cbs
+		{1222, 8, 1231, 5}, // int10002=10002
+		{1237, 9, 1247, 3}, // attribute=atr
+		{1251, 26, 1278, 3}, // proposedPrivilegesLifetime=ppl
+		{1282, 3, 1286, 7}, // uRI=m2m:uri
+		{1294, 5, 1300, 3}, // input=inp
+		{1304, 17, 1322, 4}, // childResourceType=chty
+		{1327, 32, 1360, 3}, // dynamicAuthorizationConsultation=dac
+		{1364, 8, 1373, 3}, // filesize=fsi
+		{1377, 8, 1386, 3}, // accessId=aci
+		{1390, 14, 1405, 3}, // allowedApp-IDs=aai
+		{1409, 16, 1426, 4}, // allJoynSvcObject=ajso
+		{1431, 13, 1445, 2}, // deletionRules=dr
+		{1448, 19, 1468, 3}, // memberTypeValidated=mtv
+		{1472, 16, 1489, 4}, // specializationID=spid
+		{1494, 16, 1511, 2}, // primitiveContent=pc
+		{1514, 17, 1532, 3}, // notificationEvent=nev
+		{1536, 5, 1542, 2}, // int33=33
+		{1545, 14, 1560, 3}, // capabilityName=can
+		{1564, 25, 1590, 4}, // interfaceIntrospectXmlRef=ajir
+		{1595, 9, 1605, 3}, // swVersion=swv
+		{1609, 12, 1622, 8}, // statsCollect=m2m:stcl
+		{1631, 22, 1654, 4}, // cmdhNetworkAccessRules=cmnr
+		{1659, 14, 1674, 4}, // locationStatus=lost
+		{1679, 6, 1686, 2}, // target=tg
+		{1689, 27, 1717, 3}, // dynamicAuthorizationEnabled=dae
+		{1721, 16, 1738, 3}, // securityInfoType=sit
+		{1742, 4, 1747, 3}, // role=rol
+		{1751, 30, 1782, 8}, // genericInterworkingServiceAnnc=m2m:gisa
+		{1791, 21, 1813, 3}, // defaultDelAggregation=dda
+		{1817, 7, 1825, 7}, // request=m2m:req
+		{1833, 13, 1847, 2}, // eventCategory=ec
+		{1850, 4, 1855, 4}, // UUID=uuid
+		{1860, 14, 1875, 4}, // cmdhDefEcValue=cmdv
+		{1880, 21, 1902, 5}, // allJoynMethodCallAnnc=ajmca
+		{1908, 12, 1921, 3}, // batteryLevel=btl
+		{1925, 12, 1938, 3}, // factoryReset=far
+		{1942, 13, 1956, 3}, // providedToNSE=ptn
+		{1960, 7, 1968, 2}, // creator=cr
+		{1971, 19, 1991, 2}, // requestReachability=rr
+		{1994, 17, 2012, 6}, // aE_update_invalid=m2m:ae
+		{2019, 10, 2030, 2}, // announceTo=at
+		{2033, 6, 2040, 3}, // cSE_ID=csi
+		{2044, 13, 2058, 3}, // maxNrOfNotify=mnn
+		{2062, 8, 2071, 5}, // int10013=10013
+		{2077, 18, 2096, 3}, // maximumBackoffTime=mbt
+		{2100, 27, 2128, 3}, // notificationStoragePriority=nsp
+		{2132, 25, 2158, 3}, // notificationForwardingURI=nfu
+		{2162, 10, 2173, 3}, // deactivate=dea
+		{2177, 13, 2191, 3}, // sleepInterval=sli
+		{2195, 10, 2206, 2}, // resourceID=ri
+		{2209, 9, 2219, 3}, // evenStart=evs
+		{2223, 8, 2232, 4}, // fileType=ftyp
+		{2237, 20, 2258, 5}, // allJoynSvcObjectAnnc=ajsoa
+		{2264, 18, 2283, 7}, // aCP_update_invalid=m2m:acp
+		{2291, 12, 2304, 3}, // firmwareName=fwn
+		{2308, 7, 2316, 2}, // CSEBase=cb
+		{2319, 9, 2329, 4}, // objectIDs=obis
+		{2334, 14, 2349, 3}, // requestContext=rct
+		{2353, 20, 2374, 3}, // Trigger-Recipient-ID=tri
+		{2378, 5, 2384, 2}, // int45=45
+		{2387, 19, 2407, 3}, // discoveryResultType=drt
+		{2411, 5, 2417, 2}, // int28=28
+		{2420, 12, 2433, 3}, // minReqVolume=mrv
+		{2437, 9, 2447, 3}, // timeOfDay=tod
+		{2451, 20, 2472, 2}, // originatingTimestamp=ot
+		{2475, 19, 2495, 3}, // consistencyStrategy=csy
+		{2499, 12, 2512, 3}, // softwareName=swn
+		{2516, 13, 2530, 2}, // subscriberURI=su
+		{2533, 31, 2565, 4}, // accessControlObjectDetails_list=acod
+		{2570, 5, 2576, 2}, // int49=49
+		{2579, 25, 2605, 3}, // eventNotificationCriteria=enc
+		{2609, 15, 2625, 4}, // escertkeMessage=eckm
+		{2630, 13, 2644, 8}, // remoteCSEAnnc=m2m:csrA
+		{2653, 10, 2664, 3}, // allowedAEs=aae
+		{2668, 8, 2677, 4}, // roleName=rlnm
+		{2682, 6, 2689, 2}, // action=ac
+		{2692, 7, 2700, 3}, // disable=dis
+		{2704, 26, 2731, 7}, // genericInterworkingService=m2m:gis
+		{2739, 12, 2752, 8}, // securityInfo=m2m:seci
+		{2761, 17, 2779, 4}, // areaNwkDeviceInfo=andi
+		{2784, 5, 2790, 2}, // int15=15
+		{2793, 9, 2803, 3}, // eventType=evt
+		{2807, 5, 2813, 3}, // model=mod
+		{2817, 16, 2834, 4}, // relatedSemantics=rels
+		{2839, 8, 2848, 5}, // int10004=10004
+		{2854, 12, 2867, 8}, // scheduleAnnc=m2m:schA
+		{2876, 15, 2892, 2}, // unmodifiedSince=us
+		{2895, 5, 2901, 2}, // int27=27
+		{2904, 8, 2913, 2}, // dataSize=ds
+		{2916, 9, 2926, 4}, // notBefore=tknb
+		{2931, 12, 2944, 3}, // currentState=cus
+		{2948, 23, 2972, 3}, // notificationContentType=nct
+		{2976, 17, 2994, 3}, // securedDasRequest=sdr
+		{2998, 6, 3005, 3}, // output=out
+		{3009, 17, 3027, 7}, // responsePrimitive=m2m:rsp
+		{3035, 18, 3054, 7}, // semanticDescriptor=m2m:smd
+		{3062, 23, 3086, 3}, // dynamicAuthorizationPoA=dap
+		{3090, 5, 3096, 2}, // int54=54
+		{3099, 5, 3105, 2}, // int38=38
+		{3108, 13, 3122, 3}, // listOfDevices=ldv
+		{3126, 21, 3148, 4}, // defaultRequestExpTime=dqet
+		{3153, 20, 3174, 3}, // targetedResourceType=trt
+		{3178, 3, 3182, 7}, // uRL=m2m:url
+		{3190, 9, 3200, 3}, // ruleLinks=rlk
+		{3204, 9, 3214, 7}, // debugInfo=m2m:dbg
+		{3222, 12, 3235, 4}, // activeStatus=acts
+		{3240, 5, 3246, 3}, // devId=dvd
+		{3250, 13, 3264, 5}, // localTokenIDs=ltids
+		{3270, 19, 3290, 2}, // pendingNotification=pn
+		{3293, 14, 3308, 4}, // trafficPattern=trpt
+		{3313, 20, 3334, 4}, // deviceCapabilityAnnc=dvcA
+		{3339, 5, 3345, 2}, // int62=62
+		{3348, 24, 3373, 3}, // semanticSupportIndicator=ssi
+		{3377, 8, 3386, 7}, // delivery=m2m:dlv
+		{3394, 5, 3400, 2}, // int19=19
+		{3403, 17, 3421, 5}, // allJoynMethodAnnc=ajmda
+		{3427, 10, 3438, 3}, // execEnable=exe
+		{3442, 8, 3451, 3}, // execMode=exm
+		{3455, 5, 3461, 2}, // int44=44
+		{3464, 6, 3471, 3}, // MSISDN=msd
+		{3475, 6, 3482, 2}, // latest=la
+		{3485, 15, 3501, 4}, // softwareInstall=swin
+		{3506, 8, 3515, 5}, // int10009=10009
+		{3521, 4, 3526, 1}, // int0=0
+		{3528, 9, 3538, 7}, // remoteCSE=m2m:csr
+		{3546, 18, 3565, 8}, // locationPolicyAnnc=m2m:lcpA
+		{3574, 16, 3591, 4}, // limitsOpExecTime=loet
+		{3596, 15, 3612, 3}, // operationResult=ors
+		{3616, 22, 3639, 4}, // accessControlPolicyIDs=acpi
+		{3644, 3, 3648, 2}, // to_=to
+		{3651, 12, 3664, 3}, // localTokenID=lti
+		{3668, 8, 3677, 5}, // int10034=10034
+		{3683, 16, 3700, 7}, // requestPrimitive=m2m:rqp
+		{3708, 10, 3719, 3}, // cmdhPolicy=cmp
+		{3723, 8, 3732, 3}, // logStart=lga
+		{3736, 10, 3747, 3}, // execResult=exr
+		{3751, 4, 3756, 1}, // int3=3
+		{3758, 12, 3771, 7}, // notification=m2m:sgn
+		{3779, 5, 3785, 2}, // from_=fr
+		{3788, 5, 3794, 2}, // int35=35
+		{3797, 18, 3816, 3}, // timeSeriesInstance=tsi
+		{3820, 20, 3841, 4}, // limitsRequestExpTime=lqet
+		{3846, 14, 3861, 3}, // locationServer=lor
+		{3865, 8, 3874, 5}, // int10010=10010
+		{3880, 11, 3892, 2}, // description=dc
+		{3895, 10, 3906, 3}, // e2eSecInfo=esi
+		{3910, 16, 3927, 3}, // missingDataMaxNr=mdn
+		{3931, 36, 3968, 7}, // genericInterworkingOperationInstance=m2m:gio
+		{3976, 16, 3993, 2}, // operationMonitor=om
+		{3996, 6, 4003, 2}, // source=sr
+		{4006, 19, 4026, 3}, // verificationRequest=vrq
+		{4030, 7, 4038, 3}, // logData=lgd
+		{4042, 29, 4072, 4}, // membersAccessControlPolicyIDs=macp
+		{4077, 22, 4100, 4}, // localTokenIdAssignment=ltia
+		{4105, 11, 4117, 4}, // execReqArgs=exra
+		{4122, 6, 4129, 3}, // labels=lbl
+		{4133, 20, 4154, 3}, // currentNrOfInstances=cni
+		{4158, 20, 4179, 3}, // limitsDelAggregation=lda
+		{4183, 11, 4195, 4}, // permissions=tkps
+		{4200, 8, 4209, 3}, // software=swr
+		{4213, 21, 4235, 3}, // subscriptionReference=sur
+		{4239, 13, 4253, 4}, // svcObjWrapper=ajsw
+		{4258, 11, 4270, 3}, // deviceLabel=dlb
+		{4274, 5, 4280, 2}, // int21=21
+		{4283, 13, 4297, 3}, // hostedCSELink=hcl
+		{4301, 18, 4320, 5}, // trafficPatternAnnc=trptA
+		{4326, 7, 4334, 3}, // appName=apn
+		{4338, 5, 4344, 2}, // int58=58
+		{4347, 14, 4362, 3}, // maxNrOfMembers=mnm
+		{4366, 16, 4383, 4}, // cmdhNwAccessRule=cmwr
+		{4388, 18, 4407, 3}, // contentFilterQuery=cfq
+		{4411, 29, 4441, 8}, // m2mServiceSubscriptionProfile=m2m:mssp
+		{4450, 6, 4457, 3}, // anyArg=any
+		{4461, 22, 4484, 3}, // requestCharacteristics=rch
+		{4488, 9, 4498, 3}, // memberIDs=mid
+		{4502, 13, 4516, 4}, // ipv6Addresses=ipv6
+		{4521, 21, 4543, 3}, // preSubscriptionNotify=psn
+		{4547, 31, 4579, 4}, // accessControlAuthenticationFlag=acaf
+		{4584, 25, 4610, 3}, // optionalRandomBackoffTime=rbt
+		{4614, 5, 4620, 2}, // int37=37
+		{4623, 7, 4631, 3}, // logStop=lgo
+		{4635, 8, 4644, 2}, // stateTag=st
+		{4647, 5, 4653, 2}, // order=od
+		{4656, 14, 4671, 7}, // pollingChannel=m2m:pch
+		{4679, 7, 4687, 4}, // dasInfo=dasi
+		{4692, 21, 4714, 4}, // serviceSubscribedNode=svsn
+		{4719, 12, 4732, 3}, // eventCatType=ect
+		{4736, 5, 4742, 2}, // int48=48
+		{4745, 14, 4760, 3}, // selfPrivileges=pvs
+		{4764, 15, 4780, 7}, // contentInstance=m2m:cin
+		{4788, 19, 4808, 3}, // containerDefinition=cnd
+		{4812, 23, 4836, 3}, // applicableEventCategory=aec
+		{4840, 12, 4853, 4}, // URIReference=urir
+		{4858, 11, 4870, 2}, // batchNotify=bn
+		{4873, 14, 4888, 4}, // softwareUpdate=swup
+		{4893, 8, 4902, 3}, // download=dld
+		{4906, 19, 4926, 3}, // limitsEventCategory=lec
+		{4930, 9, 4940, 7}, // container=m2m:cnt
+		{4948, 21, 4970, 3}, // limitsRespPersistence=lrp
+		{4974, 5, 4980, 2}, // int16=16
+		{4983, 17, 5001, 4}, // applicableCredIDs=apci
+		{5006, 19, 5026, 3}, // locationContainerID=loi
+		{5030, 14, 5045, 3}, // representation=rep
+		{5049, 12, 5062, 4}, // cmdhDefaults=cmdf
+		{5067, 5, 5073, 2}, // int22=22
+		{5076, 5, 5082, 2}, // int61=61
+		{5085, 17, 5103, 3}, // backOffParameters=bop
+		{5107, 13, 5121, 3}, // createdBefore=crb
+		{5125, 12, 5138, 3}, // createdAfter=cra
+		{5142, 40, 5183, 8}, // genericInterworkingOperationInstanceAnnc=m2m:gioa
+		{5192, 15, 5208, 4}, // allJoynProperty=ajpr
+		{5213, 12, 5226, 2}, // creationTime=ct
+		{5229, 19, 5249, 4}, // inputDataPointLinks=giip
+		{5254, 7, 5262, 3}, // groupID=gpi
+		{5266, 12, 5279, 7}, // subscription=m2m:sub
+		{5287, 5, 5293, 2}, // int50=50
+		{5296, 10, 5307, 3}, // execTarget=ext
+		{5311, 15, 5327, 4}, // esprimRandValue=esrv
+		{5332, 15, 5348, 3}, // storagePriority=sgp
+		{5352, 13, 5366, 3}, // sleepDuration=sld
+		{5370, 8, 5379, 3}, // memTotal=mmt
+		{5383, 7, 5391, 3}, // cmdType=cmt
+		{5395, 15, 5411, 3}, // allowedRole-IDs=ari
+		{5415, 24, 5440, 7}, // container_update_invalid=m2m:cnt
+		{5448, 15, 5464, 7}, // resourceRefList=m2m:rrl
+		{5472, 21, 5494, 5}, // areaNwkDeviceInfoAnnc=andiA
+		{5500, 5, 5506, 2}, // int47=47
+		{5509, 12, 5522, 3}, // validityTime=vdt
+		{5526, 10, 5537, 4}, // circRegion=accr
+		{5542, 20, 5563, 7}, // group_update_invalid=m2m:grp
+		{5571, 19, 5591, 8}, // contentInstanceAnnc=m2m:cinA
+		{5600, 13, 5614, 8}, // flexContainer=m2m:fcnt
+		{5623, 18, 5642, 4}, // esprimKeyGenAlgIDs=esks
+		{5647, 5, 5653, 2}, // int63=63
+		{5656, 14, 5671, 3}, // locationSource=los
+		{5675, 8, 5684, 5}, // int10029=10029
+		{5690, 17, 5708, 3}, // responseTypeValue=rtv
+		{5712, 5, 5718, 3}, // reset=rst
+		{5722, 13, 5736, 3}, // operationType=opt
+		{5740, 8, 5749, 2}, // lifespan=Ls
+		{5752, 24, 5777, 3}, // assignedTokenIdentifiers=ati
+		{5781, 8, 5790, 3}, // password=pwd
+		{5794, 14, 5809, 4}, // deviceInfoAnnc=dviA
+		{5814, 10, 5825, 3}, // timeWindow=tww
+		{5829, 15, 5845, 3}, // roleIDsFromACPs=rfa
+		{5849, 8, 5858, 5}, // int10018=10018
+		{5864, 10, 5875, 3}, // eventCatNo=ecn
+		{5879, 11, 5891, 3}, // areaNwkType=ant
+		{5895, 3, 5899, 3}, // URL=url
+		{5903, 20, 5924, 3}, // stationaryIndication=sti
+		{5928, 13, 5942, 4}, // ipv4Addresses=ipv4
+		{5947, 10, 5958, 4}, // successURL=surl
+		{5963, 5, 5969, 2}, // int25=25
+		{5972, 21, 5994, 3}, // notificationEventType=net
+		{5998, 11, 6010, 4}, // batteryAnnc=batA
+		{6015, 22, 6038, 3}, // accessControlRule_list=acr
+		{6042, 10, 6053, 4}, // contentRef=conr
+		{6058, 9, 6068, 3}, // areaNwkId=awi
+		{6072, 11, 6084, 2}, // filterUsage=fu
+		{6087, 18, 6106, 3}, // collectingEntityID=cei
+		{6110, 4, 6115, 1}, // int2=2
+		{6117, 5, 6123, 2}, // int18=18
+		{6126, 10, 6137, 3}, // execNumber=exn
+		{6141, 24, 6166, 4}, // accessControlOriginators=acor
+		{6171, 17, 6189, 3}, // requestIdentifier=rqi
+		{6193, 26, 6220, 3}, // notificationEventType_list=net
+		{6224, 8, 6233, 5}, // int10003=10003
+		{6239, 13, 6253, 3}, // installStatus=ins
+		{6257, 12, 6270, 4}, // firmwareAnnc=fwrA
+		{6275, 8, 6284, 3}, // eventEnd=eve
+		{6288, 10, 6299, 2}, // locationID=li
+		{6302, 7, 6310, 4}, // tokenID=tkid
+		{6315, 23, 6339, 4}, // accessControlOperations=acop
+		{6344, 16, 6361, 2}, // deviceIdentifier=di
+		{6364, 11, 6376, 4}, // outputLinks=giol
+		{6381, 12, 6394, 4}, // eventLogAnnc=evlA
+		{6399, 13, 6413, 3}, // resultContent=rcn
+		{6417, 13, 6431, 4}, // tracingOption=tcop
+		{6436, 14, 6451, 5}, // allJoynAppAnnc=ajapa
+		{6457, 10, 6468, 2}, // privileges=pv
+		{6471, 13, 6485, 4}, // maxBufferSize=mbfs
+		{6490, 5, 6496, 2}, // int26=26
+		{6499, 5, 6505, 2}, // int41=41
+		{6508, 11, 6520, 4}, // policyLabel=plbl
+		{6525, 4, 6530, 2}, // name=nm
+		{6533, 16, 6550, 4}, // esprimRandExpiry=esrx
+		{6555, 21, 6577, 3}, // notificationlPolicyID=npi
+		{6581, 16, 6598, 4}, // activeCmdhPolicy=acmp
+		{6603, 22, 6626, 3}, // groupRequestIdentifier=gid
+		{6630, 5, 6636, 2}, // int60=60
+		{6639, 18, 6658, 3}, // dataGenerationTime=dgt
+		{6662, 20, 6683, 3}, // notificationEventCat=nec
+		{6687, 20, 6708, 4}, // outputDataPointLinks=giop
+		{6713, 11, 6725, 4}, // countryCode=accc
+		{6730, 17, 6748, 4}, // mgmtClientAddress=mgca
+		{6753, 20, 6774, 3}, // periodicDurationTime=pdt
+		{6778, 13, 6792, 2}, // childResource=ch
+		{6795, 13, 6809, 4}, // operationName=gion
+		{6814, 9, 6824, 4}, // logStatus=lgst
+		{6829, 24, 6854, 4}, // accessControlIpAddresses=acip
+		{6859, 14, 6874, 3}, // requestedValue=rqv
+		{6878, 5, 6884, 2}, // int23=23
+		{6887, 17, 6905, 4}, // allJoynMethodCall=ajmc
+		{6910, 11, 6922, 4}, // serviceName=gisn
+		{6927, 10, 6938, 4}, // callStatus=clst
+		{6943, 10, 6954, 2}, // permission=pm
+		{6957, 17, 6975, 4}, // originatorRoleIDs=orid
+		{6980, 28, 7009, 3}, // dynamicAuthorizationLifetime=dal
+		{7013, 10, 7024, 3}, // deviceInfo=dvi
+		{7028, 12, 7041, 4}, // svcFwWrapper=ajfw
+		{7046, 16, 7063, 4}, // allJoynInterface=ajif
+		{7068, 6, 7075, 7}, // group_=m2m:grp
+		{7083, 6, 7090, 3}, // upload=uld
+		{7094, 9, 7104, 2}, // operation=op
+		{7107, 7, 7115, 3}, // content=con
+		{7119, 12, 7132, 3}, // manufacturer=man
+		{7136, 23, 7160, 7}, // schedule_update_invalid=m2m:sch
+		{7168, 14, 7183, 3}, // mgmtDefinition=mgd
+		{7187, 9, 7197, 3}, // startTime=stt
+		{7201, 9, 7211, 2}, // uninstall=un
+		{7214, 9, 7224, 3}, // fwVersion=fwv
+		{7228, 10, 7239, 3}, // targetFile=tgf
+		{7243, 8, 7252, 3}, // eventLog=evl
+		{7256, 10, 7267, 4}, // memoryAnnc=memA
+		{7272, 9, 7282, 4}, // tokenName=tknm
+		{7287, 6, 7294, 3}, // app_ID=api
+		{7298, 7, 7306, 3}, // cseType=cst
+		{7310, 11, 7322, 4}, // dasResponse=dres
+		{7327, 5, 7333, 2}, // token=tk
+		{7336, 20, 7357, 3}, // subscriptionDeletion=sud
+		{7361, 12, 7374, 3}, // completeTime=cpt
+		{7378, 9, 7388, 3}, // execDelay=exy
+		{7392, 13, 7406, 8}, // containerAnnc=m2m:cntA
+		{7415, 9, 7425, 8}, // groupAnnc=m2m:grpA
+		{7434, 14, 7449, 3}, // maxInstanceAge=mia
+		{7453, 20, 7474, 3}, // missingDataCurrentNr=mdc
+		{7478, 18, 7497, 2}, // announcedAttribute=aa
+		{7500, 13, 7514, 3}, // scheduleEntry=sce
+		{7518, 15, 7534, 3}, // executionEnvRef=eer
+		{7538, 9, 7548, 3}, // sizeAbove=sza
+		{7552, 8, 7561, 3}, // username=unm
+		{7565, 7, 7573, 7}, // mgmtCmd=m2m:mgc
+		{7581, 12, 7594, 3}, // delaySeconds=dss
+		{7598, 12, 7611, 3}, // updateStatus=uds
+		{7615, 22, 7638, 3}, // missingDataDetectTimer=mdt
+		{7642, 12, 7655, 4}, // softwareAnnc=swrA
+		{7660, 15, 7676, 3}, // stateTagSmaller=sts
+		{7680, 8, 7689, 5}, // int10014=10014
+		{7695, 9, 7705, 4}, // extension=tkex
+		{7710, 4, 7715, 1}, // int5=5
+		{7717, 10, 7728, 4}, // allJoynApp=ajap
+		{7733, 10, 7744, 3}, // sequenceNr=snr
+		{7748, 9, 7758, 3}, // sizeBelow=szb
+		{7762, 23, 7786, 3}, // tokenRequestInformation=tqf
+		{7790, 11, 7802, 3}, // maxByteSize=mbs
+		{7806, 6, 7813, 3}, // status=sus
+		{7817, 27, 7845, 7}, // subscription_update_invalid=m2m:sub
+		{7853, 35, 7889, 4}, // dynamicAuthorizationConsultationIDs=daci
+		{7894, 6, 7901, 4}, // roleID=rlid
+		{7906, 13, 7920, 4}, // allJoynMethod=ajmd
+		{7925, 29, 7955, 7}, // locationPolicy_update_invalid=m2m:lcp
+		{7963, 23, 7987, 4}, // esprimProtocolAndAlgIDs=espa
+		{7992, 4, 7997, 1}, // int8=8
+		{7999, 5, 8005, 3}, // group=grp
+		{8009, 8, 8018, 2}, // parentID=pi
+		{8021, 10, 8032, 4}, // dasRequest=dreq
+		{8037, 20, 8058, 4}, // defaultResultExpTime=dset
+		{8063, 24, 8088, 4}, // accessControlWindow_list=actw
+		{8093, 5, 8099, 2}, // int14=14
+		{8102, 6, 8109, 2}, // oldest=ol
+		{8112, 15, 8128, 3}, // statsRuleStatus=srs
+		{8132, 6, 8139, 4}, // tokens=tkns
+		{8144, 4, 8149, 1}, // int4=4
+		{8151, 21, 8173, 3}, // supportedResourceType=srt
+		{8177, 8, 8186, 3}, // duration=dur
+		{8190, 22, 8213, 3}, // operationExecutionTime=oet
+		{8217, 6, 8224, 4}, // offset=ofst
+		{8229, 5, 8235, 2}, // int43=43
+		{8238, 11, 8250, 4}, // objectPaths=obps
+		{8255, 22, 8278, 3}, // triggerReferenceNumber=trn
+		{8282, 15, 8298, 2}, // filterOperation=fo
+		{8301, 25, 8327, 4}, // applicableEventCategories=aecs
+		{8332, 5, 8338, 3}, // level=lvl
+		{8342, 8, 8351, 4}, // mgmtLink=cmlk
+		{8356, 16, 8373, 3}, // maxNrOfInstances=mni
+		{8377, 20, 8398, 5}, // allJoynInterfaceAnnc=ajifa
+		{8404, 12, 8417, 2}, // responseType=rt
+		{8420, 5, 8426, 2}, // int53=53
+		{8429, 8, 8438, 3}, // attached=att
+		{8442, 12, 8455, 3}, // originatorIP=oip
+		{8459, 26, 8486, 4}, // accessControlObjectDetails=acod
+		{8491, 17, 8509, 3}, // esprimKeyGenAlgID=esk
+		{8513, 17, 8531, 2}, // grantedPrivileges=gp
+		{8534, 18, 8553, 3}, // responseStatusCode=rsc
+		{8557, 9, 8567, 2}, // groupName=gn
+		{8570, 9, 8580, 2}, // rateLimit=rl
+		{8583, 4, 8588, 7}, // node=m2m:nod
+		{8596, 26, 8623, 4}, // requestExpirationTimestamp=rqet
+		{8628, 6, 8635, 3}, // memory=mem
+		{8639, 13, 8653, 3}, // execFrequency=exf
+		{8657, 5, 8663, 2}, // int29=29
+		{8666, 8, 8675, 5}, // int10001=10001
+		{8681, 15, 8697, 4}, // missingDataList=mdlt
+		{8702, 19, 8722, 2}, // deliveryAggregation=da
+		{8725, 19, 8745, 4}, // limitsResultExpTime=lset
+		{8750, 17, 8768, 3}, // accessControlRule=acr
+		{8772, 15, 8788, 2}, // notificationURI=nu
+		{8791, 5, 8797, 2}, // int31=31
+		{8800, 19, 8820, 5}, // allJoynPropertyAnnc=ajpra
+		{8826, 5, 8832, 2}, // int17=17
+		{8835, 9, 8845, 2}, // statModel=sm
+		{8848, 10, 8859, 2}, // timeSeries=ts
+		{8862, 13, 8876, 8}, // attributeList=m2m:atrl
+		{8885, 17, 8903, 5}, // svcObjWrapperAnnc=ajswa
+		{8909, 11, 8921, 2}, // ontologyRef=or
+		{8924, 7, 8932, 2}, // version=vr
+		{8935, 18, 8954, 7}, // aggregatedResponse=m2m:agr
+		{8962, 7, 8970, 3}, // battery=bat
+		{8974, 8, 8983, 4}, // audience=tkau
+		{8988, 6, 8995, 3}, // App-ID=api
+		{8999, 8, 9008, 5}, // int10030=10030
+		{9014, 5, 9020, 2}, // int32=32
+		{9023, 22, 9046, 3}, // defaultRespPersistence=drp
+		{9050, 9, 9060, 3}, // direction=dir
+		{9064, 20, 9085, 4}, // backOffParametersSet=bops
+		{9090, 10, 9101, 4}, // objectPath=ajop
+		{9106, 21, 9128, 3}, // locationContainerName=lon
+		{9132, 12, 9145, 2}, // resourceName=rn
+		{9148, 11, 9160, 3}, // expireAfter=exa
+		{9164, 13, 9178, 3}, // batteryStatus=bts
+		{9182, 8, 9191, 2}, // eventCat=ec
+		{9194, 11, 9206, 8}, // statsConfig=m2m:stcg
+		{9215, 18, 9234, 3}, // originatorLocation=olo
+		{9238, 21, 9260, 3}, // notificationTargetURI=ntu
+		{9264, 12, 9277, 3}, // memAvailable=mma
+		{9281, 16, 9298, 2}, // lastModifiedTime=lt
+		{9301, 5, 9307, 3}, // limit=lim
+		{9311, 17, 9329, 3}, // pollingChannelURI=pcu
+		{9333, 13, 9347, 3}, // requestOrigin=ror
+		{9351, 2, 9354, 6}, // aE=m2m:ae
+		{9361, 6, 9368, 3}, // enable=ena
+		{9372, 6, 9379, 4}, // holder=tkhd
+		{9384, 8, 9393, 8}, // nodeAnnc=m2m:nodA
+		{9402, 22, 9425, 3}, // capabilityActionStatus=cas
+		{9429, 11, 9441, 3}, // contentInfo=cnf
+		{9445, 20, 9466, 3}, // contentSerialization=csz
+		{9470, 26, 9497, 4}, // accessControlContexts_list=acco
+		{9502, 6, 9509, 3}, // reboot=rbo
+		{9513, 29, 9543, 7}, // pollingChannel_update_invalid=m2m:pch
+		{9551, 10, 9562, 2}, // memberType=mt
+		{9565, 22, 9588, 4}, // timeSeriesInstanceAnnc=tsia
+		{9593, 8, 9602, 5}, // int10016=10016
+		{9608, 5, 9614, 2}, // int57=57
+		{9617, 12, 9630, 2}, // resourceType=ty
+		{9633, 22, 9656, 8}, // semanticDescriptorAnnc=m2m:smdA
+		{9665, 7, 9673, 3}, // eventID=evi
+		{9677, 16, 9694, 4}, // disableRetrieval=disr
+		{9699, 18, 9718, 2}, // privilegesLifetime=pl
+		{9721, 13, 9735, 4}, // contentStatus=cnst
+		{9740, 7, 9748, 6}, // cSEBase=m2m:cb
+		{9755, 4, 9760, 1}, // int9=9
+		{9762, 5, 9768, 3}, // value=val
+		{9772, 30, 9803, 4}, // sharedReceiverESPrimRandObject=esro
+		{9808, 8, 9817, 4}, // tokenIDs=tids
+		{9822, 4, 9827, 1}, // int6=6
+		{9829, 31, 9861, 4}, // notificationTargetSelfReference=ntsr
+		{9866, 5, 9872, 2}, // int56=56
+		{9875, 24, 9900, 4}, // descriptorRepresentation=dcrp
+		{9905, 8, 9914, 2}, // nodeLink=nl
+		{9917, 10, 9928, 3}, // defEcValue=dev
+		{9932, 5, 9938, 2}, // int10=10
+		{9941, 16, 9958, 3}, // esprimRandObject=ero
+		{9962, 17, 9980, 4}, // defaultOpExecTime=doet
+		{9985, 8, 9994, 5}, // int10033=10033
+		{10000, 7, 10008, 3}, // devType=dvt
+		{10012, 27, 10040, 4}, // accessControlLocationRegion=aclr
+		{10045, 13, 10059, 2}, // requestStatus=rs
+		{10062, 12, 10075, 9}, // mgmtResource=m2m:mgRsc
+		{10085, 13, 10099, 3}, // pointOfAccess=poa
+		{10103, 5, 10109, 2}, // int51=51
+		{10112, 13, 10126, 3}, // dataLinkEntry=dle
+		{10130, 19, 10150, 4}, // semanticFanOutPoint=sfop
+		{10155, 11, 10167, 2}, // missingData=md
+		{10170, 11, 10182, 4}, // fanOutPoint=fopt
+		{10187, 21, 10209, 3}, // tokenRequestIndicator=tqi
+		{10213, 14, 10228, 3}, // dynamicACPInfo=dai
+		{10232, 11, 10244, 4}, // eventConfig=evcg
+		{10249, 15, 10265, 2}, // scheduleElement=se
+		{10268, 17, 10286, 3}, // dataSizeIndicator=dsi
+		{10290, 6, 10297, 4}, // issuer=tkis
+		{10302, 17, 10320, 3}, // aggregatedRequest=arq
+		{10324, 23, 10348, 3}, // supportede2ESecFeatures=esf
+		{10352, 16, 10369, 3}, // deviceCapability=dvc
+		{10373, 10, 10384, 3}, // execStatus=exs
+		{10388, 12, 10401, 3}, // currentValue=crv
+		{10405, 21, 10427, 8}, // announcedMgmtResource=m2m:mgoA
+		{10436, 11, 10448, 3}, // ipv4Address=ip4
+		{10452, 21, 10474, 3}, // deletionRulesRelation=drr
+		{10478, 8, 10487, 7}, // resource=m2m:rce
+		{10495, 5, 10501, 2}, // int24=24
+		{10504, 15, 10520, 3}, // listOfNeighbors=lnh
+		{10524, 17, 10542, 3}, // periodicIndicator=pri
+		{10546, 9, 10556, 3}, // hwVersion=hwv
+		{10560, 17, 10578, 3}, // spreadingWaitTime=swt
+		{10582, 2, 10585, 2}, // to=to
+		{10588, 17, 10606, 3}, // rulesRelationship=rrs
+		{10610, 7, 10618, 4}, // roleIDs=rids
+		{10623, 5, 10629, 2}, // int40=40
+		{10632, 20, 10653, 4}, // cmdhEcDefParamValues=cmpv
+		{10658, 8, 10667, 3}, // activate=act
+		{10671, 12, 10684, 2}, // latestNotify=ln
+		{10687, 5, 10693, 2}, // int12=12
+		{10696, 14, 10711, 3}, // stateTagBigger=stb
+		{10715, 9, 10725, 3}, // logTypeId=lgt
+		{10729, 4, 10734, 3}, // type=typ
+		{10738, 25, 10764, 4}, // resultExpirationTimestamp=rset
+		{10769, 5, 10775, 2}, // int39=39
+		{10778, 26, 10805, 4}, // requestContextNotification=rctn
+		{10810, 31, 10842, 4}, // notificationTargetMgmtPolicyRef=ntpr
+		{10847, 17, 10865, 2}, // resultPersistence=rp
+		{10868, 11, 10880, 3}, // contentType=cty
+		{10884, 13, 10898, 3}, // attributeName=atn
+		{10902, 17, 10920, 3}, // missingDataDetect=mdd
+		{10924, 19, 10944, 3}, // policyDeletionRules=pdr
+		{10948, 11, 10960, 3}, // resourceRef=rrf
+		{10964, 5, 10970, 3}, // aE_ID=aei
+		{10974, 13, 10988, 2}, // collectPeriod=cp
+		{10991, 16, 11008, 3}, // requestTimestamp=rts
+		{11012, 10, 11023, 4}, // cmdhBuffer=cmbf
+		{11028, 15, 11044, 2}, // locationRegions=lr
+		{11047, 11, 11059, 4}, // tokenObject=tkob
+		{11064, 15, 11080, 3}, // semanticsFilter=smf
+		{11084, 11, 11096, 4}, // tracingInfo=tcin
+		{11101, 5, 11107, 2}, // int11=11
+		{11110, 5, 11116, 2}, // int46=46
+		{11119, 19, 11139, 3}, // contentFilterSyntax=cfs
+		{11143, 5, 11149, 2}, // int55=55
+		{11152, 7, 11160, 2}, // install=in
+		{11163, 19, 11183, 7}, // accessControlPolicy=m2m:acp
+		{11191, 5, 11197, 2}, // int34=34
+		{11200, 17, 11218, 3}, // expirationCounter=exc
+		{11222, 5, 11228, 2}, // int13=13
+		{11231, 5, 11237, 2}, // int42=42
+		{11240, 16, 11257, 3}, // periodicInterval=pei
+		{11261, 11, 11273, 3}, // areaNwkInfo=ani
+		{11277, 10, 11288, 3}, // originator=org
+		{11292, 5, 11298, 2}, // int59=59
+		{11301, 18, 11320, 4}, // targetedResourceID=trid
+		{11325, 14, 11340, 7}, // locationPolicy=m2m:lcp
+		{11348, 12, 11361, 3}, // expireBefore=exb
+		{11365, 15, 11381, 2}, // metaInformation=mi
+		{11384, 7, 11392, 8}, // uRIList=m2m:uril
+		{11401, 15, 11417, 3}, // otherConditions=ohc
+		{11421, 14, 11436, 3}, // timeSeriesAnnc=tsa
+		{11440, 10, 11451, 3}, // M2M-Ext-ID=mei
+		{11455, 8, 11464, 4}, // notAfter=tkna
+	};
+
+	static const unsigned int NAME_DICTIONARY_L2S_SEEDS[156] = {
+		25, 11, 14, 5, 7, 8, 1, 10, 2, 231, 10, 473, 3, 19, 2, 33,
+		15, 141, 67, 6, 124, 59, 13, 128, 10, 8, 89, 1, 52, 2, 8, 87,
+		13, 58, 39, 2, 72, 8, 0, 0, 5, 1, 16, 112, 55, 2, 94, 1,
+		28, 17, 6, 33, 256, 141, 10, 15, 18, 42, 141, 549, 145, 5, 422, 37,
+		95, 7, 27, 20, 72, 27, 96, 2, 12, 7, 6, 41, 57, 17, 15, 379,
+		12, 28, 124, 73, 1, 13, 189, 32, 43, 18, 524, 1, 624, 7, 93, 45,
+		21, 131, 141, 1, 71, 5, 125, 47, 30, 406, 115, 48, 51, 2, 161, 10,
+		56, 279, 8, 300, 1, 453, 69, 297, 17, 9, 473, 478, 220, 2, 13, 6,
+		36, 3, 189, 656, 597, 466, 6, 1, 702, 86, 70, 18, 1728, 423, 1406, 82,
+		8, 429, 178, 3, 2598, 96, 38, 2, 347, 1217, 2090, 622,
+	};
+
+	static const NameDictionary NAME_DICTIONARY_L2S = {
+		NAME_DICTIONARY_L2S_STRINGS, NAME_DICTIONARY_L2S_ENTRIES, NAME_DICTIONARY_L2S_SEEDS, 624, 156
+	};
+
+	static const char NAME_DICTIONARY_S2L_STRINGS[] =
+	"mid\0" "memberIDs\0"
+	"atr\0" "attribute\0"
+	"rs\0" "requestStatus\0"
+	"cmdv\0" "cmdhDefEcValue\0"
+	"pei\0" "periodicInterval\0"
+	"idr\0" "IPEDiscoveryRequest\0"
+	"da\0" "deliveryAggregation\0"
+	"5105\0" "int5105\0"
+	"4109\0" "int4109\0"
+	"6024\0" "int6024\0"
+	"lor\0" "locationServer\0"
+	"giip\0" "inputDataPointLinks\0"
+	"evlA\0" "eventLogAnnc\0"
+	"ip4\0" "ipv4Address\0"
+	"exn\0" "execNumber\0"
+	"cs\0" "contentSize\0"
+	"ms\0" "modifiedSince\0"
+	"ac\0" "action\0"
+	"vr\0" "version\0"
+	"ajpr\0" "allJoynProperty\0"
+	"md\0" "missingData\0"
+	"mia\0" "maxInstanceAge\0"
+	"opt\0" "operationType\0"
+	"accr\0" "circRegion\0"
+	"cpt\0" "completeTime\0"
+	"6\0" "int6\0"
+	"dsi\0" "dataSizeIndicator\0"
+	"49\0" "int49\0"
+	"rid\0" "requestID\0"
+	"lou\0" "locationUpdatePeriod\0"
+	"evcg\0" "eventConfig\0"
+	"38\0" "int38\0"
+	"5106\0" "int5106\0"
+	"smf\0" "semanticsFilter\0"
+	"6005\0" "int6005\0"
+	"lost\0" "locationStatus\0"
+	"loi\0" "locationContainerID\0"
+	"atn\0" "attributeName\0"
+	"rn\0" "resourceName\0"
+	"10016\0" "int10016\0"
+	"dap\0" "dynamicAuthorizationPoA\0"
+	"su\0" "subscriberURI\0"
+	"m2m:mssp\0" "m2mServiceSubscriptionProfile\0"
+	"dres\0" "dasResponse\0"
+	"in\0" "install\0"
+	"ss\0" "devStatus\0"
+	"4104\0" "int4104\0"
+	"lgd\0" "logData\0"
+	"ajmc\0" "allJoynMethodCall\0"
+	"10004\0" "int10004\0"
+	"plbl\0" "policyLabel\0"
+	"tkhd\0" "holder\0"
+	"ip6\0" "ipv6Address\0"
+	"ajmd\0" "allJoynMethod\0"
+	"esrx\0" "esprimRandExpiry\0"
+	"lqet\0" "limitsRequestExpTime\0"
+	"ol\0" "oldest\0"
+	"10002\0" "int10002\0"
+	"ftyp\0" "fileType\0"
+	"smd\0" "semanticDescriptor\0"
+	"ot\0" "originatingTimestamp\0"
+	"lga\0" "logStart\0"
+	"clst\0" "callStatus\0"
+	"cb\0" "CSEBase\0"
+	"ero\0" "esprimRandObject\0"
+	"4005\0" "int4005\0"
+	"pi\0" "parentID\0"
+	"54\0" "int54\0"
+	"nsp\0" "notificationStoragePriority\0"
+	"swun\0" "softwareUninstall\0"
+	"rtv\0" "responseTypeValue\0"
+	"rqet\0" "requestExpirationTimestamp\0"
+	"acaf\0" "accessControlAuthenticationFlag\0"
+	"abt\0" "additionalBackoffTime\0"
+	"drr\0" "deletionRulesRelation\0"
+	"36\0" "int36\0"
+	"fc\0" "filterCriteria\0"
+	"ncp\0" "notificationCongestionPolicy\0"
+	"cmnr\0" "cmdhNetworkAccessRules\0"
+	"ln\0" "latestNotify\0"
+	"dev\0" "defEcValue\0"
+	"tri\0" "Trigger-Recipient-ID\0"
+	"lt\0" "lastModifiedTime\0"
+	"16\0" "int16\0"
+	"10001\0" "int10001\0"
+	"disr\0" "disableRetrieval\0"
+	"pm\0" "permission\0"
+	"6023\0" "int6023\0"
+	"19\0" "int19\0"
+	"bops\0" "backOffParametersSet\0"
+	"48\0" "int48\0"
+	"val\0" "value\0"
+	"rrs\0" "rulesRelationship\0"
+	"nev\0" "notificationEvent\0"
+	"et\0" "expirationTime\0"
+	"dda\0" "defaultDelAggregation\0"
+	"cfq\0" "contentFilterQuery\0"
+	"m2m:sub\0" "subscription\0"
+	"con\0" "content\0"
+	"tkis\0" "issuer\0"
+	"ntsr\0" "notificationTargetSelfReference\0"
+	"srs\0" "statsRuleStatus\0"
+	"cp\0" "collectPeriod\0"
+	"mbs\0" "maxByteSize\0"
+	"can\0" "capabilityName\0"
+	"sus\0" "status\0"
+	"dle\0" "dataLinkEntry\0"
+	"tknm\0" "tokenName\0"
+	"ajmda\0" "allJoynMethodAnnc\0"
+	"fu\0" "filterUsage\0"
+	"gion\0" "operationName\0"
+	"ch\0" "childResource\0"
+	"62\0" "int62\0"
+	"andiA\0" "areaNwkDeviceInfoAnnc\0"
+	"acod\0" "accessControlObjectDetails_list\0"
+	"swt\0" "spreadingWaitTime\0"
+	"crb\0" "createdBefore\0"
+	"nct\0" "notificationContentType\0"
+	"mbt\0" "maximumBackoffTime\0"
+	"30\0" "int30\0"
+	"op\0" "operation\0"
+	"rt\0" "responseType\0"
+	"ins\0" "installStatus\0"
+	"csi\0" "cSE_ID\0"
+	"20\0" "int20\0"
+	"tknb\0" "notBefore\0"
+	"cni\0" "currentNrOfInstances\0"
+	"memA\0" "memoryAnnc\0"
+	"22\0" "int22\0"
+	"cfs\0" "contentFilterSyntax\0"
+	"aclr\0" "accessControlLocationRegion\0"
+	"far\0" "factoryReset\0"
+	"los\0" "locationSource\0"
+	"ris\0" "resourceIDs\0"
+	"ofst\0" "offset\0"
+	"ajso\0" "allJoynSvcObject\0"
+	"10029\0" "int10029\0"
+	"mt\0" "memberType\0"
+	"55\0" "int55\0"
+	"dlb\0" "deviceLabel\0"
+	"urir\0" "URIReference\0"
+	"cnst\0" "contentStatus\0"
+	"typ\0" "type\0"
+	"m2m:pch\0" "pollingChannel\0"
+	"m2m:dlv\0" "delivery\0"
+	"cmbf\0" "cmdhBuffer\0"
+	"fwn\0" "firmwareName\0"
+	"ror\0" "requestOrigin\0"
+	"rfa\0" "roleIDsFromACPs\0"
+	"mbfs\0" "maxBufferSize\0"
+	"m2m:mgoA\0" "announcedMgmtResource\0"
+	"m2m:rce\0" "resource\0"
+	"4107\0" "int4107\0"
+	"mei\0" "M2M-Ext-ID\0"
+	"4102\0" "int4102\0"
+	"rol\0" "role\0"
+	"acip\0" "accessControlIpAddresses\0"
+	"56\0" "int56\0"
+	"sm\0" "statModel\0"
+	"acco\0" "accessControlContexts_list\0"
+	"27\0" "int27\0"
+	"m2m:mgc\0" "mgmtCmd\0"
+	"npi\0" "notificationlPolicyID\0"
+	"fsi\0" "filesize\0"
+	"uds\0" "updateStatus\0"
+	"cbs\0" "currentByteSize\0"
+	"32\0" "int32\0"
+	"ltia\0" "localTokenIdAssignment\0"
+	"pdt\0" "periodicDurationTime\0"
+	"nfu\0" "notificationForwardingURI\0"
+	"cpn\0" "cmdhPolicyName\0"
+	"5207\0" "int5207\0"
+	"rst\0" "reset\0"
+	"44\0" "int44\0"
+	"vdt\0" "validityTime\0"
+	"exd\0" "execDisable\0"
+	"trt\0" "targetedResourceType\0"
+	"4103\0" "int4103\0"
+	"m2m:gisa\0" "genericInterworkingServiceAnnc\0"
+	"23\0" "int23\0"
+	"ntpr\0" "notificationTargetMgmtPolicyRef\0"
+	"gisn\0" "serviceName\0"
+	"escert\0" "certificates\0"
+	"drp\0" "defaultRespPersistence\0"
+	"la\0" "latest\0"
+	"szb\0" "sizeBelow\0"
+	"6003\0" "int6003\0"
+	"mrv\0" "minReqVolume\0"
+	"2004\0" "int2004\0"
+	"6028\0" "int6028\0"
+	"m2m:uri\0" "uRI\0"
+	"5103\0" "int5103\0"
+	"acpi\0" "accessControlPolicyIDs\0"
+	"rset\0" "resultExpirationTimestamp\0"
+	"6026\0" "int6026\0"
+	"cdi\0" "collectedEntityID\0"
+	"0\0" "int0\0"
+	"m2m:cb\0" "cSEBase\0"
+	"evs\0" "evenStart\0"
+	"rp\0" "resultPersistence\0"
+	"ajsw\0" "svcObjWrapper\0"
+	"34\0" "int34\0"
+	"10\0" "int10\0"
+	"any\0" "anyArg\0"
+	"m2m:sgn\0" "notification\0"
+	"dvc\0" "deviceCapability\0"
+	"dasi\0" "dasInfo\0"
+	"13\0" "int13\0"
+	"dur\0" "duration\0"
+	"m2m:grpA\0" "groupAnnc\0"
+	"mnn\0" "maxNrOfNotify\0"
+	"ct\0" "creationTime\0"
+	"mgd\0" "mgmtDefinition\0"
+	"dgt\0" "dataGenerationTime\0"
+	"actw\0" "accessControlWindow_list\0"
+	"swn\0" "softwareName\0"
+	"rrf\0" "resourceRef\0"
+	"ajir\0" "interfaceIntrospectXmlRef\0"
+	"btl\0" "batteryLevel\0"
+	"dvcA\0" "deviceCapabilityAnnc\0"
+	"cr\0" "creator\0"
+	"cra\0" "createdAfter\0"
+	"csy\0" "consistencyStrategy\0"
+	"m2m:csrA\0" "remoteCSEAnnc\0"
+	"aei\0" "aE_ID\0"
+	"lot\0" "locationTargetID\0"
+	"m2m:nodA\0" "nodeAnnc\0"
+	"m2m:dbg\0" "debugInfo\0"
+	"dty\0" "deviceType\0"
+	"acts\0" "activeStatus\0"
+	"m2m:agn\0" "aggregatedNotification\0"
+	"rsc\0" "responseStatusCode\0"
+	"lon\0" "locationContainerName\0"
+	"ibt\0" "initialBackoffTime\0"
+	"m2m:cin\0" "contentInstance\0"
+	"rels\0" "relatedSemantics\0"
+	"ldv\0" "listOfDevices\0"
+	"50\0" "int50\0"
+	"dali\0" "dataLink\0"
+	"dreq\0" "dasRequest\0"
+	"chty\0" "childResourceType\0"
+	"m2m:smd\0" "semanticDescriptor\0"
+	"dlv\0" "delivery\0"
+	"acmlk\0" "activeCmdhPolicyLink\0"
+	"trpt\0" "trafficPattern\011\0"
+	"m2m:csr\0" "remoteCSE\0"
+	"lgt\0" "logTypeId\0"
+	"swin\0" "softwareInstall\0"
+	"9\0" "int9\0"
+	"batA\0" "batteryAnnc\0"
+	"10024\0" "int10024\0"
+	"lset\0" "limitsResultExpTime\0"
+	"57\0" "int57\0"
+	"us\0" "unmodifiedSince\0"
+	"21\0" "int21\0"
+	"8\0" "int8\0"
+	"conr\0" "contentRef\0"
+	"swv\0" "swVersion\0"
+	"61\0" "int61\0"
+	"cmpv\0" "cmdhEcDefParamValues\0"
+	"dss\0" "delaySeconds\0"
+	"ajpra\0" "allJoynPropertyAnnc\0"
+	"31\0" "int31\0"
+	"dai\0" "dynamicACPInfo\0"
+	"tqf\0" "tokenRequestInformation\0"
+	"rctn\0" "requestContextNotification\0"
+	"ajfw\0" "svcFwWrapper\0"
+	"26\0" "int26\0"
+	"5203\0" "int5203\0"
+	"aai\0" "allowedApp-IDs\0"
+	"sfop\0" "semanticFanOutPoint\0"
+	"m2m:seci\0" "securityInfo\0"
+	"60\0" "int60\0"
+	"swrA\0" "softwareAnnc\0"
+	"cmwr\0" "cmdhNwAccessRule\0"
+	"35\0" "int35\0"
+	"dir\0" "direction\0"
+	"sr\0" "source\0"
+	"exf\0" "execFrequency\0"
+	"4105\0" "int4105\0"
+	"gn\0" "groupName\0"
+	"exe\0" "execEnable\0"
+	"tkns\0" "tokens\0"
+	"accc\0" "countryCode\0"
+	"5206\0" "int5206\0"
+	"pcu\0" "pollingChannelURI\0"
+	"1\0" "int1\0"
+	"m2m:acp\0" "accessControlPolicy\0"
+	"csz\0" "contentSerialization\0"
+	"tkob\0" "tokenObject\0"
+	"6020\0" "int6020\0"
+	"bn\0" "batchNotify\0"
+	"rbt\0" "optionalRandomBackoffTime\0"
+	"ltids\0" "localTokenIDs\0"
+	"dcrp\0" "descriptorRepresentation\0"
+	"obis\0" "objectIDs\0"
+	"4\0" "int4\0"
+	"42\0" "int42\0"
+	"lvl\0" "level\0"
+	"ajap\0" "allJoynApp\0"
+	"arq\0" "aggregatedRequest\0"
+	"rlk\0" "ruleLinks\0"
+	"dqet\0" "defaultRequestExpTime\0"
+	"m2m:stcg\0" "statsConfig\0"
+	"sza\0" "sizeAbove\0"
+	"mdc\0" "missingDataCurrentNr\0"
+	"cnf\0" "contentInfo\0"
+	"fr\0" "from_\0"
+	"pv\0" "privileges\0"
+	"sud\0" "subscriptionDeletion\0"
+	"6022\0" "int6022\0"
+	"m2m:rrl\0" "resourceRefList\0"
+	"m2m:cnt\0" "container\0"
+	"lec\0" "limitsEventCategory\0"
+	"24\0" "int24\0"
+	"trid\0" "targetedResourceID\0"
+	"41\0" "int41\0"
+	"gp\0" "grantedPrivileges\0"
+	"bop\0" "backOffParameters\0"
+	"mni\0" "maxNrOfInstances\0"
+	"sgp\0" "storagePriority\0"
+	"tod\0" "timeOfDay\0"
+	"10018\0" "int10018\0"
+	"acmp\0" "activeCmdhPolicy\0"
+	"dae\0" "dynamicAuthorizationEnabled\0"
+	"rlnm\0" "roleName\0"
+	"se\0" "scheduleElement\0"
+	"esri\0" "esprimRandID\0"
+	"nm\0" "name\0"
+	"ni\0" "nodeID\0"
+	"acr\0" "accessControlRule_list\0"
+	"daci\0" "dynamicAuthorizationConsultationIDs\0"
+	"uril\0" "URIList\0"
+	"acor\0" "accessControlOriginators\0"
+	"m2m:mgRsc\0" "mgmtResource\0"
+	"5204\0" "int5204\0"
+	"di\0" "deviceIdentifier\0"
+	"dal\0" "dynamicAuthorizationLifetime\0"
+	"surl\0" "successURL\0"
+	"rce\0" "resource\0"
+	"ntp\0" "notificationTargetPolicy\0"
+	"mi\0" "metaInformation\0"
+	"rltl\0" "tokenLink\0"
+	"m2m:nod\0" "node\0"
+	"m2m:atrl\0" "attributeList\0"
+	"st\0" "stateTag\0"
+	"pit\0" "periodicIntervalTime\0"
+	"nl\0" "nodeLink\0"
+	"macp\0" "membersAccessControlPolicyIDs\0"
+	"3\0" "int3\0"
+	"ext\0" "execTarget\0"
+	"6025\0" "int6025\0"
+	"mma\0" "memAvailable\0"
+	"ohc\0" "otherConditions\0"
+	"4008\0" "int4008\0"
+	"tk\0" "token\0"
+	"exy\0" "execDelay\0"
+	"evt\0" "eventType\0"
+	"cmp\0" "cmdhPolicy\0"
+	"uri\0" "uRI\0"
+	"nec\0" "notificationEventCat\0"
+	"sce\0" "scheduleEntry\0"
+	"obps\0" "objectPaths\0"
+	"pn\0" "pendingNotification\0"
+	"33\0" "int33\0"
+	"hcl\0" "hostedCSELink\0"
+	"6021\0" "int6021\0"
+	"m2m:gio\0" "genericInterworkingOperationInstance\0"
+	"sit\0" "securityInfoType\0"
+	"espa\0" "esprimProtocolAndAlgIDs\0"
+	"esks\0" "esprimKeyGenAlgIDs\0"
+	"tsi\0" "timeSeriesInstance\0"
+	"esi\0" "e2eSecInfo\0"
+	"ecn\0" "eventCatNo\0"
+	"m2m:semanticDescriptorAnnc\0" "smdA\0"
+	"tkna\0" "notAfter\0"
+	"eve\0" "eventEnd\0"
+	"dviA\0" "deviceInfoAnnc\0"
+	"tcin\0" "tracingInfo\0"
+	"swr\0" "software\0"
+	"dvt\0" "devType\0"
+	"crv\0" "currentValue\0"
+	"m2m:uril\0" "uRIList\0"
+	"enc\0" "eventNotificationCriteria\0"
+	"46\0" "int46\0"
+	"ect\0" "eventCatType\0"
+	"lnk\0" "Link\0"
+	"dsp\0" "descriptor\0"
+	"2\0" "int2\0"
+	"awi\0" "areaNwkId\0"
+	"stb\0" "stateTagBigger\0"
+	"rids\0" "roleIDs\0"
+	"pvs\0" "selfPrivileges\0"
+	"lgo\0" "logStop\0"
+	"olo\0" "originatorLocation\0"
+	"uld\0" "upload\0"
+	"bat\0" "battery\0"
+	"10013\0" "int10013\0"
+	"cnot\0" "contentOffset\0"
+	"org\0" "originator\0"
+	"smdA\0" "semanticDescriptorAnnc\0"
+	"37\0" "int37\0"
+	"rts\0" "requestTimestamp\0"
+	"ajsoa\0" "allJoynSvcObjectAnnc\0"
+	"cmdf\0" "cmdhDefaults\0"
+	"4004\0" "int4004\0"
+	"lbl\0" "labels\0"
+	"od\0" "order\0"
+	"at\0" "announceTo\0"
+	"sti\0" "stationaryIndication\0"
+	"10014\0" "int10014\0"
+	"ors\0" "operationResult\0"
+	"unm\0" "username\0"
+	"10028\0" "int10028\0"
+	"ajifa\0" "allJoynInterfaceAnnc\0"
+	"li\0" "locationID\0"
+	"api\0" "app_ID\0"
+	"att\0" "attached\0"
+	"ajswa\0" "svcObjWrapperAnnc\0"
+	"m2m:sch\0" "schedule\0"
+	"oip\0" "originatorIP\0"
+	"tqi\0" "tokenRequestIndicator\0"
+	"fopt\0" "fanOutPoint\0"
+	"ppl\0" "proposedPrivilegesLifetime\0"
+	"aniA\0" "areaNwkInfoAnnc\0"
+	"esrv\0" "esprimRandValue\0"
+	"tsia\0" "timeSeriesInstanceAnnc\0"
+	"giil\0" "inputLinks\0"
+	"m2m:gioa\0" "genericInterworkingOperationInstanceAnnc\0"
+	"2002\0" "int2002\0"
+	"or\0" "ontologyRef\0"
+	"fwv\0" "fwVersion\0"
+	"rrl\0" "resourceRefList\0"
+	"5000\0" "int5000\0"
+	"m2m:stcl\0" "statsCollect\0"
+	"28\0" "int28\0"
+	"andi\0" "areaNwkDeviceInfo\0"
+	"rr\0" "requestReachability\0"
+	"Ls\0" "lifespan\0"
+	"cst\0" "cseType\0"
+	"trptA\0" "trafficPatternAnnc\0"
+	"1000\0" "int1000\0"
+	"gpi\0" "groupID\0"
+	"58\0" "int58\0"
+	"gis\0" "genericInterworkingService\0"
+	"ec\0" "eventCategory\0"
+	"m2m:schA\0" "scheduleAnnc\0"
+	"17\0" "int17\0"
+	"exc\0" "expirationCounter\0"
+	"m2m:agr\0" "aggregatedResponse\0"
+	"nwa\0" "networkAction\0"
+	"5209\0" "int5209\0"
+	"rbo\0" "reboot\0"
+	"aci\0" "accessId\0"
+	"gisa\0" "genericInterworkingServiceAnnc\0"
+	"ty\0" "resourceType\0"
+	"dset\0" "defaultResultExpTime\0"
+	"oet\0" "operationExecutionTime\0"
+	"59\0" "int59\0"
+	"dvi\0" "deviceInfo\0"
+	"tww\0" "timeWindow\0"
+	"53\0" "int53\0"
+	"eer\0" "executionEnvRef\0"
+	"mmt\0" "memTotal\0"
+	"spid\0" "specializationID\0"
+	"ntu\0" "notificationTargetURI\0"
+	"cmlk\0" "mgmtLink\0"
+	"dc\0" "description\0"
+	"4108\0" "int4108\0"
+	"dcid\0" "dataContainerID\0"
+	"ajfwa\0" "svcFwWrapperAnnc\0"
+	"63\0" "int63\0"
+	"trn\0" "triggerReferenceNumber\0"
+	"tkps\0" "permissions\0"
+	"loet\0" "limitsOpExecTime\0"
+	"agr\0" "aggregatedResponse\0"
+	"ant\0" "areaNwkType\0"
+	"sdr\0" "securedDasRequest\0"
+	"ajapa\0" "allJoynAppAnnc\0"
+	"ri\0" "resourceID\0"
+	"m2m:ae\0" "aE\0"
+	"doet\0" "defaultOpExecTime\0"
+	"lnh\0" "listOfNeighbors\0"
+	"pdr\0" "policyDeletionRules\0"
+	"ud\0" "update\0"
+	"esk\0" "esprimKeyGenAlgID\0"
+	"5001\0" "int5001\0"
+	"15\0" "int15\0"
+	"mdn\0" "missingDataMaxNr\0"
+	"sci\0" "statsCollectID\0"
+	"num\0" "number\0"
+	"giol\0" "outputLinks\0"
+	"tgf\0" "targetFile\0"
+	"tg\0" "target\0"
+	"10034\0" "int10034\0"
+	"tsa\0" "timeSeriesAnnc\0"
+	"sgn\0" "notification\0"
+	"10030\0" "int10030\0"
+	"dbg\0" "debugInfo\0"
+	"dea\0" "deactivate\0"
+	"mod\0" "model\0"
+	"aa\0" "announcedAttribute\0"
+	"pl\0" "privilegesLifetime\0"
+	"tkau\0" "audience\0"
+	"snr\0" "sequenceNr\0"
+	"apci\0" "applicableCredIDs\0"
+	"6010\0" "int6010\0"
+	"10033\0" "int10033\0"
+	"m2m:grp\0" "group_\0"
+	"12\0" "int12\0"
+	"gio\0" "genericInterworkingOperationInstance\0"
+	"ajop\0" "objectPath\0"
+	"rep\0" "representation\0"
+	"net\0" "notificationEventType_list\0"
+	"2000\0" "int2000\0"
+	"39\0" "int39\0"
+	"esf\0" "supportede2ESecFeatures\0"
+	"dvd\0" "devId\0"
+	"vrq\0" "verificationRequest\0"
+	"un\0" "uninstall\0"
+	"ts\0" "timeSeries\0"
+	"mem\0" "memory\0"
+	"ajif\0" "allJoynInterface\0"
+	"mdt\0" "missingDataDetectTimer\0"
+	"exra\0" "execReqArgs\0"
+	"act\0" "activate\0"
+	"rct\0" "requestContext\0"
+	"ena\0" "enable\0"
+	"swup\0" "softwareUpdate\0"
+	"tcop\0" "tracingOption\0"
+	"6029\0" "int6029\0"
+	"mdlt\0" "missingDataList\0"
+	"m2m:cntA\0" "containerAnnc\0"
+	"cml\0" "cmdhLimits\0"
+	"25\0" "int25\0"
+	"mgca\0" "mgmtClientAddress\0"
+	"lda\0" "limitsDelAggregation\0"
+	"rqv\0" "requestedValue\0"
+	"cus\0" "currentState\0"
+	"cei\0" "collectingEntityID\0"
+	"ipv6\0" "ipv6Addresses\0"
+	"dld\0" "download\0"
+	"stt\0" "startTime\0"
+	"dmd\0" "deliveryMetaData\0"
+	"4106\0" "int4106\0"
+	"ds\0" "dataSize\0"
+	"exin\0" "execInstance\0"
+	"m2m:asar\0" "serviceSubscribedAppRule\0"
+	"40\0" "int40\0"
+	"giop\0" "outputDataPointLinks\0"
+	"m2m:aeA\0" "aEAnnc\0"
+	"10009\0" "int10009\0"
+	"lti\0" "localTokenID\0"
+	"gioa\0" "genericInterworkingOperationInstanceAnnc\0"
+	"pc\0" "primitiveContent\0"
+	"10003\0" "int10003\0"
+	"cnd\0" "containerDefinition\0"
+	"svsn\0" "serviceSubscribedNode\0"
+	"fo\0" "filterOperation\0"
+	"aecs\0" "applicableEventCategories\0"
+	"dr\0" "deletionRules\0"
+	"ssi\0" "semanticSupportIndicator\0"
+	"m2m:acpA\0" "accessControlPolicyAnnc\0"
+	"m2m:lcp\0" "locationPolicy\0"
+	"msd\0" "MSISDN\0"
+	"uuid\0" "UUID\0"
+	"5\0" "int5\0"
+	"rcn\0" "resultContent\0"
+	"nu\0" "notificationURI\0"
+	"srt\0" "supportedResourceType\0"
+	"7\0" "int7\0"
+	"poa\0" "pointOfAccess\0"
+	"cnm\0" "currentNrOfMembers\0"
+	"rboA\0" "rebootAnnc\0"
+	"mdl\0" "missingDataList\0"
+	"eckm\0" "escertkeMessage\0"
+	"mtv\0" "memberTypeValidated\0"
+	"10010\0" "int10010\0"
+	"to\0" "to\0"
+	"m2m:url\0" "uRL\0"
+	"m2m:gis\0" "genericInterworkingService\0"
+	"om\0" "operationMonitor\0"
+	"pwd\0" "password\0"
+	"inp\0" "input\0"
+	"dac\0" "dynamicAuthorizationConsultation\0"
+	"esro\0" "sharedReceiverESPrimRandObject\0"
+	"drt\0" "discoveryResultType\0"
+	"ajmca\0" "allJoynMethodCallAnnc\0"
+	"m2m:req\0" "request\0"
+	"sld\0" "sleepDuration\0"
+	"orid\0" "originatorRoleIDs\0"
+	"51\0" "int51\0"
+	"exr\0" "execResult\0"
+	"ati\0" "assignedTokenIdentifiers\0"
+	"sts\0" "stateTagSmaller\0"
+	"bts\0" "batteryStatus\0"
+	"tids\0" "tokenIDs\0"
+	"43\0" "int43\0"
+	"hwv\0" "hwVersion\0"
+	"dis\0" "disable\0"
+	"45\0" "int45\0"
+	"acop\0" "accessControlOperations\0"
+	"psn\0" "preSubscriptionNotify\0"
+	"m2m:cinA\0" "contentInstanceAnnc\0"
+	"ptn\0" "providedToNSE\0"
+	"url\0" "URL\0"
+	"out\0" "output\0"
+	"47\0" "int47\0"
+	"ari\0" "allowedRole-IDs\0"
+	"evl\0" "eventLog\0"
+	"cmt\0" "cmdType\0"
+	"epo\0" "esprimObject\0"
+	"evi\0" "eventID\0"
+	"sur\0" "subscriptionReference\0"
+	"14\0" "int14\0"
+	"tkid\0" "tokenID\0"
+	"seci\0" "securityInfo\0"
+	"lr\0" "locationRegions\0"
+	"m2m:fcnt\0" "flexContainer\0"
+	"rlid\0" "roleID\0"
+	"mnm\0" "maxNrOfMembers\0"
+	"fwrA\0" "firmwareAnnc\0"
+	"lim\0" "limit\0"
+	"atrl\0" "attributeList\0"
+	"soe\0" "semanticOpExec\0"
+	"m2m:lcpA\0" "locationPolicyAnnc\0"
+	"11\0" "int11\0"
+	"rl\0" "rateLimit\0"
+	"apn\0" "appName\0"
+	"2001\0" "int2001\0"
+	"agn\0" "aggregatedNotification\0"
+	"29\0" "int29\0"
+	"exs\0" "execStatus\0"
+	"aec\0" "applicableEventCategory\0"
+	"daq\0" "dasRequest\0"
+	"m2m:rsp\0" "responsePrimitive\0"
+	"exa\0" "expireAfter\0"
+	"cty\0" "contentType\0"
+	"4000\0" "int4000\0"
+	"5205\0" "int5205\0"
+	"4101\0" "int4101\0"
+	"ttn\0" "targetNetwork\0"
+	"gios\0" "operationState\0"
+	"18\0" "int18\0"
+	"ani\0" "areaNwkInfo\0"
+	"tkex\0" "extension\0"
+	"52\0" "int52\0"
+	"fwr\0" "firmware\0"
+	"rch\0" "requestCharacteristics\0"
+	"man\0" "manufacturer\0"
+	"lrp\0" "limitsRespPersistence\0"
+	"cas\0" "capabilityActionStatus\0"
+	"m2m:rqp\0" "requestPrimitive\0"
+	"exb\0" "expireBefore\0"
+	"4110\0" "int4110\0"
+	"gid\0" "groupRequestIdentifier\0"
+	"pri\0" "periodicIndicator\0"
+	"exm\0" "execMode\0"
+	"aae\0" "allowedAEs\0"
+	"svr\0" "serviceRoles\0"
+	"mdd\0" "missingDataDetect\0"
+	"ipv4\0" "ipv4Addresses\0"
+	"lgst\0" "logStatus\0"
+	"sli\0" "sleepInterval\0"
+	"rqi\0" "requestIdentifier\0";
+
+	static const NameDictionaryEntry NAME_DICTIONARY_S2L_ENTRIES[665] = {
+		{0, 3, 4, 9}, // mid=memberIDs
+		{14, 3, 18, 9}, // atr=attribute
+		{28, 2, 31, 13}, // rs=requestStatus
+		{45, 4, 50, 14}, // cmdv=cmdhDefEcValue
+		{65, 3, 69, 16}, // pei=periodicInterval
+		{86, 3, 90, 19}, // idr=IPEDiscoveryRequest
+		{110, 2, 113, 19}, // da=deliveryAggregation
+		{133, 4, 138, 7}, // 5105=int5105
+		{146, 4, 151, 7}, // 4109=int4109
+		{159, 4, 164, 7}, // 6024=int6024
+		{172, 3, 176, 14}, // lor=locationServer
+		{191, 4, 196, 19}, // giip=inputDataPointLinks
+		{216, 4, 221, 12}, // evlA=eventLogAnnc
+		{234, 3, 238, 11}, // ip4=ipv4Address
+		{250, 3, 254, 10}, // exn=execNumber
+		{265, 2, 268, 11}, // cs=contentSize
+		{280, 2, 283, 13}, // ms=modifiedSince
+		{297, 2, 300, 6}, // ac=action
+		{307, 2, 310, 7}, // vr=version
+		{318, 4, 323, 15}, // ajpr=allJoynProperty
+		{339, 2, 342, 11}, // md=missingData
+		{354, 3, 358, 14}, // mia=maxInstanceAge
+		{373, 3, 377, 13}, // opt=operationType
+		{391, 4, 396, 10}, // accr=circRegion
+		{407, 3, 411, 12}, // cpt=completeTime
+		{424, 1, 426, 4}, // 6=int6
+		{431, 3, 435, 17}, // dsi=dataSizeIndicator
+		{453, 2, 456, 5}, // 49=int49
+		{462, 3, 466, 9}, // rid=requestID
+		{476, 3, 480, 20}, // lou=locationUpdatePeriod
+		{501, 4, 506, 11}, // evcg=eventConfig
+		{518, 2, 521, 5}, // 38=int38
+		{527, 4, 532, 7}, // 5106=int5106
+		{540, 3, 544, 15}, // smf=semanticsFilter
+		{560, 4, 565, 7}, // 6005=int6005
+		{573, 4, 578, 14}, // lost=locationStatus
+		{593, 3, 597, 19}, // loi=locationContainerID
+		{617, 3, 621, 13}, // atn=attributeName
+		{635, 2, 638, 12}, // rn=resourceName
+		{651, 5, 657, 8}, // 10016=int10016
+		{666, 3, 670, 23}, // dap=dynamicAuthorizationPoA
+		{694, 2, 697, 13}, // su=subscriberURI
+		{711, 8, 720, 29}, // m2m:mssp=m2mServiceSubscriptionProfile
+		{750, 4, 755, 11}, // dres=dasResponse
+		{767, 2, 770, 7}, // in=install
+		{778, 2, 781, 9}, // ss=devStatus
+		{791, 4, 796, 7}, // 4104=int4104
+		{804, 3, 808, 7}, // lgd=logData
+		{816, 4, 821, 17}, // ajmc=allJoynMethodCall
+		{839, 5, 845, 8}, // 10004=int10004
+		{854, 4, 859, 11}, // plbl=policyLabel
+		{871, 4, 876, 6}, // tkhd=holder
+		{883, 3, 887, 11}, // ip6=ipv6Address
+		{899, 4, 904, 13}, // ajmd=allJoynMethod
+		{918, 4, 923, 16}, // esrx=esprimRandExpiry
+		{940, 4, 945, 20}, // lqet=limitsRequestExpTime
+		{966, 2, 969, 6}, // ol=oldest
+		{976, 5, 982, 8}, // 10002=int10002
+		{991, 4, 996, 8}, // ftyp=fileType
+		{1005, 3, 1009, 18}, // smd=semanticDescriptor
+		{1028, 2, 1031, 20}, // ot=originatingTimestamp
+		{1052, 3, 1056, 8}, // lga=logStart
+		{1065, 4, 1070, 10}, // clst=callStatus
+		{1081, 2, 1084, 7}, // cb=CSEBase
+		{1092, 3, 1096, 16}, // ero=esprimRandObject
+		{1113, 4, 1118, 7}, // 4005=int4005
+		{1126, 2, 1129, 8}, // pi=parentID
+		{1138, 2, 1141, 5}, // 54=int54
+		{1147, 3, 1151, 27}, // nsp=notificationStoragePriority
+		{1179, 4, 1184, 17}, // swun=softwareUninstall
+		{1202, 3, 1206, 17}, // rtv=responseTypeValue
+		{1224, 4, 1229, 26}, // rqet=requestExpirationTimestamp
+		{1256, 4, 1261, 31}, // acaf=accessControlAuthenticationFlag
+		{1293, 3, 1297, 21}, // abt=additionalBackoffTime
+		{1319, 3, 1323, 21}, // drr=deletionRulesRelation
+		{1345, 2, 1348, 5}, // 36=int36
+		{1354, 2, 1357, 14}, // fc=filterCriteria
+		{1372, 3, 1376, 28}, // ncp=notificationCongestionPolicy
+		{1405, 4, 1410, 22}, // cmnr=cmdhNetworkAccessRules
+		{1433, 2, 1436, 12}, // ln=latestNotify
+		{1449, 3, 1453, 10}, // dev=defEcValue
+		{1464, 3, 1468, 20}, // tri=Trigger-Recipient-ID
+		{1489, 2, 1492, 16}, // lt=lastModifiedTime
+		{1509, 2, 1512, 5}, // 16=int16
+		{1518, 5, 1524, 8}, // 10001=int10001
+		{1533, 4, 1538, 16}, // disr=disableRetrieval
+		{1555, 2, 1558, 10}, // pm=permission
+		{1569, 4, 1574, 7}, // 6023=int6023
+		{1582, 2, 1585, 5}, // 19=int19
+		{1591, 4, 1596, 20}, // bops=backOffParametersSet
+		{1617, 2, 1620, 5}, // 48=int48
+		{1626, 3, 1630, 5}, // val=value
+		{1636, 3, 1640, 17}, // rrs=rulesRelationship
+		{1658, 3, 1662, 17}, // nev=notificationEvent
+		{1680, 2, 1683, 14}, // et=expirationTime
+		{1698, 3, 1702, 21}, // dda=defaultDelAggregation
+		{1724, 3, 1728, 18}, // cfq=contentFilterQuery
+		{1747, 7, 1755, 12}, // m2m:sub=subscription
+		{1768, 3, 1772, 7}, // con=content
+		{1780, 4, 1785, 6}, // tkis=issuer
+		{1792, 4, 1797, 31}, // ntsr=notificationTargetSelfReference
+		{1829, 3, 1833, 15}, // srs=statsRuleStatus
+		{1849, 2, 1852, 13}, // cp=collectPeriod
+		{1866, 3, 1870, 11}, // mbs=maxByteSize
+		{1882, 3, 1886, 14}, // can=capabilityName
+		{1901, 3, 1905, 6}, // sus=status
+		{1912, 3, 1916, 13}, // dle=dataLinkEntry
+		{1930, 4, 1935, 9}, // tknm=tokenName
+		{1945, 5, 1951, 17}, // ajmda=allJoynMethodAnnc
+		{1969, 2, 1972, 11}, // fu=filterUsage
+		{1984, 4, 1989, 13}, // gion=operationName
+		{2003, 2, 2006, 13}, // ch=childResource
+		{2020, 2, 2023, 5}, // 62=int62
+		{2029, 5, 2035, 21}, // andiA=areaNwkDeviceInfoAnnc
+		{2057, 4, 2062, 31}, // acod=accessControlObjectDetails_list
+		{2094, 3, 2098, 17}, // swt=spreadingWaitTime
+		{2116, 3, 2120, 13}, // crb=createdBefore
+		{2134, 3, 2138, 23}, // nct=notificationContentType
+		{2162, 3, 2166, 18}, // mbt=maximumBackoffTime
+		{2185, 2, 2188, 5}, // 30=int30
+		{2194, 2, 2197, 9}, // op=operation
+		{2207, 2, 2210, 12}, // rt=responseType
+		{2223, 3, 2227, 13}, // ins=installStatus
+		{2241, 3, 2245, 6}, // csi=cSE_ID
+		{2252, 2, 2255, 5}, // 20=int20
+		{2261, 4, 2266, 9}, // tknb=notBefore
+		{2276, 3, 2280, 20}, // cni=currentNrOfInstances
+		{2301, 4, 2306, 10}, // memA=memoryAnnc
+		{2317, 2, 2320, 5}, // 22=int22
+		{2326, 3, 2330, 19}, // cfs=contentFilterSyntax
+		{2350, 4, 2355, 27}, // aclr=accessControlLocationRegion
+		{2383, 3, 2387, 12}, // far=factoryReset
+		{2400, 3, 2404, 14}, // los=locationSource
+		{2419, 3, 2423, 11}, // ris=resourceIDs
+		{2435, 4, 2440, 6}, // ofst=offset
+		{2447, 4, 2452, 16}, // ajso=allJoynSvcObject
+		{2469, 5, 2475, 8}, // 10029=int10029
+		{2484, 2, 2487, 10}, // mt=memberType
+		{2498, 2, 2501, 5}, // 55=int55
+		{2507, 3, 2511, 11}, // dlb=deviceLabel
+		{2523, 4, 2528, 12}, // urir=URIReference
+		{2541, 4, 2546, 13}, // cnst=contentStatus
+		{2560, 3, 2564, 4}, // typ=type
+		{2569, 7, 2577, 14}, // m2m:pch=pollingChannel
+		{2592, 7, 2600, 8}, // m2m:dlv=delivery
+		{2609, 4, 2614, 10}, // cmbf=cmdhBuffer
+		{2625, 3, 2629, 12}, // fwn=firmwareName
+		{2642, 3, 2646, 13}, // ror=requestOrigin
+		{2660, 3, 2664, 15}, // rfa=roleIDsFromACPs
+		{2680, 4, 2685, 13}, // mbfs=maxBufferSize
+		{2699, 8, 2708, 21}, // m2m:mgoA=announcedMgmtResource
+		{2730, 7, 2738, 8}, // m2m:rce=resource
+		{2747, 4, 2752, 7}, // 4107=int4107
+		{2760, 3, 2764, 10}, // mei=M2M-Ext-ID
+		{2775, 4, 2780, 7}, // 4102=int4102
+		{2788, 3, 2792, 4}, // rol=role
+		{2797, 4, 2802, 24}, // acip=accessControlIpAddresses
+		{2827, 2, 2830, 5}, // 56=int56
+		{2836, 2, 2839, 9}, // sm=statModel
+		{2849, 4, 2854, 26}, // acco=accessControlContexts_list
+		{2881, 2, 2884, 5}, // 27=int27
+		{2890, 7, 2898, 7}, // m2m:mgc=mgmtCmd
+		{2906, 3, 2910, 21}, // npi=notificationlPolicyID
+		{2932, 3, 2936, 8}, // fsi=filesize
+		{2945, 3, 2949, 12}, // uds=updateStatus
+		{2962, 3, 2966, 15}, // cbs=currentByteSize
+		{2982, 2, 2985, 5}, // 32=int32
+		{2991, 4, 2996, 22}, // ltia=localTokenIdAssignment
+		{3019, 3, 3023, 20}, // pdt=periodicDurationTime
+		{3044, 3, 3048, 25}, // nfu=notificationForwardingURI
+		{3074, 3, 3078, 14}, // cpn=cmdhPolicyName
+		{3093, 4, 3098, 7}, // 5207=int5207
+		{3106, 3, 3110, 5}, // rst=reset
+		{3116, 2, 3119, 5}, // 44=int44
+		{3125, 3, 3129, 12}, // vdt=validityTime
+		{3142, 3, 3146, 11}, // exd=execDisable
+		{3158, 3, 3162, 20}, // trt=targetedResourceType
+		{3183, 4, 3188, 7}, // 4103=int4103
+		{3196, 8, 3205, 30}, // m2m:gisa=genericInterworkingServiceAnnc
+		{3236, 2, 3239, 5}, // 23=int23
+		{3245, 4, 3250, 31}, // ntpr=notificationTargetMgmtPolicyRef
+		{3282, 4, 3287, 11}, // gisn=serviceName
+		{3299, 6, 3306, 12}, // escert=certificates
+		{3319, 3, 3323, 22}, // drp=defaultRespPersistence
+		{3346, 2, 3349, 6}, // la=latest
+		{3356, 3, 3360, 9}, // szb=sizeBelow
+		{3370, 4, 3375, 7}, // 6003=int6003
+		{3383, 3, 3387, 12}, // mrv=minReqVolume
+		{3400, 4, 3405, 7}, // 2004=int2004
+		{3413, 4, 3418, 7}, // 6028=int6028
+		{3426, 7, 3434, 3}, // m2m:uri=uRI
+		{3438, 4, 3443, 7}, // 5103=int5103
+		{3451, 4, 3456, 22}, // acpi=accessControlPolicyIDs
+		{3479, 4, 3484, 25}, // rset=resultExpirationTimestamp
+		{3510, 4, 3515, 7}, // 6026=int6026
+		{3523, 3, 3527, 17}, // cdi=collectedEntityID
+		{3545, 1, 3547, 4}, // 0=int0
+		{3552, 6, 3559, 7}, // m2m:cb=cSEBase
+		{3567, 3, 3571, 9}, // evs=evenStart
+		{3581, 2, 3584, 17}, // rp=resultPersistence
+		{3602, 4, 3607, 13}, // ajsw=svcObjWrapper
+		{3621, 2, 3624, 5}, // 34=int34
+		{3630, 2, 3633, 5}, // 10=int10
+		{3639, 3, 3643, 6}, // any=anyArg
+		{3650, 7, 3658, 12}, // m2m:sgn=notification
+		{3671, 3, 3675, 16}, // dvc=deviceCapability
+		{3692, 4, 3697, 7}, // dasi=dasInfo
+		{3705, 2, 3708, 5}, // 13=int13
+		{3714, 3, 3718, 8}, // dur=duration
+		{3727, 8, 3736, 9}, // m2m:grpA=groupAnnc
+		{3746, 3, 3750, 13}, // mnn=maxNrOfNotify
+		{3764, 2, 3767, 12}, // ct=creationTime
+		{3780, 3, 3784, 14}, // mgd=mgmtDefinition
+		{3799, 3, 3803, 18}, // dgt=dataGenerationTime
+		{3822, 4, 3827, 24}, // actw=accessControlWindow_list
+		{3852, 3, 3856, 12}, // swn=softwareName
+		{3869, 3, 3873, 11}, // rrf=resourceRef
+		{3885, 4, 3890, 25}, // ajir=interfaceIntrospectXmlRef
+		{3916, 3, 3920, 12}, // btl=batteryLevel
+		{3933, 4, 3938, 20}, // dvcA=deviceCapabilityAnnc
+		{3959, 2, 3962, 7}, // cr=creator
+		{3970, 3, 3974, 12}, // cra=createdAfter
+		{3987, 3, 3991, 19}, // csy=consistencyStrategy
+		{4011, 8, 4020, 13}, // m2m:csrA=remoteCSEAnnc
+		{4034, 3, 4038, 5}, // aei=aE_ID
+		{4044, 3, 4048, 16}, // lot=locationTargetID
+		{4065, 8, 4074, 8}, // m2m:nodA=nodeAnnc
+		{4083, 7, 4091, 9}, // m2m:dbg=debugInfo
+		{4101, 3, 4105, 10}, // dty=deviceType
+		{4116, 4, 4121, 12}, // acts=activeStatus
+		{4134, 7, 4142, 22}, // m2m:agn=aggregatedNotification
+		{4165, 3, 4169, 18}, // rsc=responseStatusCode
+		{4188, 3, 4192, 21}, // lon=locationContainerName
+		{4214, 3, 4218, 18}, // ibt=initialBackoffTime
+		{4237, 7, 4245, 15}, // m2m:cin=contentInstance
+		{4261, 4, 4266, 16}, // rels=relatedSemantics
+		{4283, 3, 4287, 13}, // ldv=listOfDevices
+		{4301, 2, 4304, 5}, // 50=int50
+		{4310, 4, 4315, 8}, // dali=dataLink
+		{4324, 4, 4329, 10}, // dreq=dasRequest
+		{4340, 4, 4345, 17}, // chty=childResourceType
+		{4363, 7, 4371, 18}, // m2m:smd=semanticDescriptor
+		{4390, 3, 4394, 8}, // dlv=delivery
+		{4403, 5, 4409, 20}, // acmlk=activeCmdhPolicyLink
+		{4430, 4, 4435, 15}, // trpt=trafficPattern\011
+		{4451, 7, 4459, 9}, // m2m:csr=remoteCSE
+		{4469, 3, 4473, 9}, // lgt=logTypeId
+		{4483, 4, 4488, 15}, // swin=softwareInstall
+		{4504, 1, 4506, 4}, // 9=int9
+		{4511, 4, 4516, 11}, // batA=batteryAnnc
+		{4528, 5, 4534, 8}, // 10024=int10024
+		{4543, 4, 4548, 19}, // lset=limitsResultExpTime
+		{4568, 2, 4571, 5}, // 57=int57
+		{4577, 2, 4580, 15}, // us=unmodifiedSince
+		{4596, 2, 4599, 5}, // 21=int21
+		{4605, 1, 4607, 4}, // 8=int8
+		{4612, 4, 4617, 10}, // conr=contentRef
+		{4628, 3, 4632, 9}, // swv=swVersion
+		{4642, 2, 4645, 5}, // 61=int61
+		{4651, 4, 4656, 20}, // cmpv=cmdhEcDefParamValues
+		{4677, 3, 4681, 12}, // dss=delaySeconds
+		{4694, 5, 4700, 19}, // ajpra=allJoynPropertyAnnc
+		{4720, 2, 4723, 5}, // 31=int31
+		{4729, 3, 4733, 14}, // dai=dynamicACPInfo
+		{4748, 3, 4752, 23}, // tqf=tokenRequestInformation
+		{4776, 4, 4781, 26}, // rctn=requestContextNotification
+		{4808, 4, 4813, 12}, // ajfw=svcFwWrapper
+		{4826, 2, 4829, 5}, // 26=int26
+		{4835, 4, 4840, 7}, // 5203=int5203
+		{4848, 3, 4852, 14}, // aai=allowedApp-IDs
+		{4867, 4, 4872, 19}, // sfop=semanticFanOutPoint
+		{4892, 8, 4901, 12}, // m2m:seci=securityInfo
+		{4914, 2, 4917, 5}, // 60=int60
+		{4923, 4, 4928, 12}, // swrA=softwareAnnc
+		{4941, 4, 4946, 16}, // cmwr=cmdhNwAccessRule
+		{4963, 2, 4966, 5}, // 35=int35
+		{4972, 3, 4976, 9}, // dir=direction
+		{4986, 2, 4989, 6}, // sr=source
+		{4996, 3, 5000, 13}, // exf=execFrequency
+		{5014, 4, 5019, 7}, // 4105=int4105
+		{5027, 2, 5030, 9}, // gn=groupName
+		{5040, 3, 5044, 10}, // exe=execEnable
+		{5055, 4, 5060, 6}, // tkns=tokens
+		{5067, 4, 5072, 11}, // accc=countryCode
+		{5084, 4, 5089, 7}, // 5206=int5206
+		{5097, 3, 5101, 17}, // pcu=pollingChannelURI
+		{5119, 1, 5121, 4}, // 1=int1
+		{5126, 7, 5134, 19}, // m2m:acp=accessControlPolicy
+		{5154, 3, 5158, 20}, // csz=contentSerialization
+		{5179, 4, 5184, 11}, // tkob=tokenObject
+		{5196, 4, 5201, 7}, // 6020=int6020
+		{5209, 2, 5212, 11}, // bn=batchNotify
+		{5224, 3, 5228, 25}, // rbt=optionalRandomBackoffTime
+		{5254, 5, 5260, 13}, // ltids=localTokenIDs
+		{5274, 4, 5279, 24}, // dcrp=descriptorRepresentation
+		{5304, 4, 5309, 9}, // obis=objectIDs
+		{5319, 1, 5321, 4}, // 4=int4
+		{5326, 2, 5329, 5}, // 42=int42
+		{5335, 3, 5339, 5}, // lvl=level
+		{5345, 4, 5350, 10}, // ajap=allJoynApp
+		{5361, 3, 5365, 17}, // arq=aggregatedRequest
+		{5383, 3, 5387, 9}, // rlk=ruleLinks
+		{5397, 4, 5402, 21}, // dqet=defaultRequestExpTime
+		{5424, 8, 5433, 11}, // m2m:stcg=statsConfig
+		{5445, 3, 5449, 9}, // sza=sizeAbove
+		{5459, 3, 5463, 20}, // mdc=missingDataCurrentNr
+		{5484, 3, 5488, 11}, // cnf=contentInfo
+		{5500, 2, 5503, 5}, // fr=from_
+		{5509, 2, 5512, 10}, // pv=privileges
+		{5523, 3, 5527, 20}, // sud=subscriptionDeletion
+		{5548, 4, 5553, 7}, // 6022=int6022
+		{5561, 7, 5569, 15}, // m2m:rrl=resourceRefList
+		{5585, 7, 5593, 9}, // m2m:cnt=container
+		{5603, 3, 5607, 19}, // lec=limitsEventCategory
+		{5627, 2, 5630, 5}, // 24=int24
+		{5636, 4, 5641, 18}, // trid=targetedResourceID
+		{5660, 2, 5663, 5}, // 41=int41
+		{5669, 2, 5672, 17}, // gp=grantedPrivileges
+		{5690, 3, 5694, 17}, // bop=backOffParameters
+		{5712, 3, 5716, 16}, // mni=maxNrOfInstances
+		{5733, 3, 5737, 15}, // sgp=storagePriority
+		{5753, 3, 5757, 9}, // tod=timeOfDay
+		{5767, 5, 5773, 8}, // 10018=int10018
+		{5782, 4, 5787, 16}, // acmp=activeCmdhPolicy
+		{5804, 3, 5808, 27}, // dae=dynamicAuthorizationEnabled
+		{5836, 4, 5841, 8}, // rlnm=roleName
+		{5850, 2, 5853, 15}, // se=scheduleElement
+		{5869, 4, 5874, 12}, // esri=esprimRandID
+		{5887, 2, 5890, 4}, // nm=name
+		{5895, 2, 5898, 6}, // ni=nodeID
+		{5905, 3, 5909, 22}, // acr=accessControlRule_list
+		{5932, 4, 5937, 35}, // daci=dynamicAuthorizationConsultationIDs
+		{5973, 4, 5978, 7}, // uril=URIList
+		{5986, 4, 5991, 24}, // acor=accessControlOriginators
+		{6016, 9, 6026, 12}, // m2m:mgRsc=mgmtResource
+		{6039, 4, 6044, 7}, // 5204=int5204
+		{6052, 2, 6055, 16}, // di=deviceIdentifier
+		{6072, 3, 6076, 28}, // dal=dynamicAuthorizationLifetime
+		{6105, 4, 6110, 10}, // surl=successURL
+		{6121, 3, 6125, 8}, // rce=resource
+		{6134, 3, 6138, 24}, // ntp=notificationTargetPolicy
+		{6163, 2, 6166, 15}, // mi=metaInformation
+		{6182, 4, 6187, 9}, // rltl=tokenLink
+		{6197, 7, 6205, 4}, // m2m:nod=node
+		{6210, 8, 6219, 13}, // m2m:atrl=attributeList
+		{6233, 2, 6236, 8}, // st=stateTag
+		{6245, 3, 6249, 20}, // pit=periodicIntervalTime
+		{6270, 2, 6273, 8}, // nl=nodeLink
+		{6282, 4, 6287, 29}, // macp=membersAccessControlPolicyIDs
+		{6317, 1, 6319, 4}, // 3=int3
+		{6324, 3, 6328, 10}, // ext=execTarget
+		{6339, 4, 6344, 7}, // 6025=int6025
+		{6352, 3, 6356, 12}, // mma=memAvailable
+		{6369, 3, 6373, 15}, // ohc=otherConditions
+		{6389, 4, 6394, 7}, // 4008=int4008
+		{6402, 2, 6405, 5}, // tk=token
+		{6411, 3, 6415, 9}, // exy=execDelay
+		{6425, 3, 6429, 9}, // evt=eventType
+		{6439, 3, 6443, 10}, // cmp=cmdhPolicy
+		{6454, 3, 6458, 3}, // uri=uRI
+		{6462, 3, 6466, 20}, // nec=notificationEventCat
+		{6487, 3, 6491, 13}, // sce=scheduleEntry
+		{6505, 4, 6510, 11}, // obps=objectPaths
+		{6522, 2, 6525, 19}, // pn=pendingNotification
+		{6545, 2, 6548, 5}, // 33=int33
+		{6554, 3, 6558, 13}, // hcl=hostedCSELink
+		{6572, 4, 6577, 7}, // 6021=int6021
+		{6585, 7, 6593, 36}, // m2m:gio=genericInterworkingOperationInstance
+		{6630, 3, 6634, 16}, // sit=securityInfoType
+		{6651, 4, 6656, 23}, // espa=esprimProtocolAndAlgIDs
+		{6680, 4, 6685, 18}, // esks=esprimKeyGenAlgIDs
+		{6704, 3, 6708, 18}, // tsi=timeSeriesInstance
+		{6727, 3, 6731, 10}, // esi=e2eSecInfo
+		{6742, 3, 6746, 10}, // ecn=eventCatNo
+		{6757, 26, 6784, 4}, // m2m:semanticDescriptorAnnc=smdA
+		{6789, 4, 6794, 8}, // tkna=notAfter
+		{6803, 3, 6807, 8}, // eve=eventEnd
+		{6816, 4, 6821, 14}, // dviA=deviceInfoAnnc
+		{6836, 4, 6841, 11}, // tcin=tracingInfo
+		{6853, 3, 6857, 8}, // swr=software
+		{6866, 3, 6870, 7}, // dvt=devType
+		{6878, 3, 6882, 12}, // crv=currentValue
+		{6895, 8, 6904, 7}, // m2m:uril=uRIList
+		{6912, 3, 6916, 25}, // enc=eventNotificationCriteria
+		{6942, 2, 6945, 5}, // 46=int46
+		{6951, 3, 6955, 12}, // ect=eventCatType
+		{6968, 3, 6972, 4}, // lnk=Link
+		{6977, 3, 6981, 10}, // dsp=descriptor
+		{6992, 1, 6994, 4}, // 2=int2
+		{6999, 3, 7003, 9}, // awi=areaNwkId
+		{7013, 3, 7017, 14}, // stb=stateTagBigger
+		{7032, 4, 7037, 7}, // rids=roleIDs
+		{7045, 3, 7049, 14}, // pvs=selfPrivileges
+		{7064, 3, 7068, 7}, // lgo=logStop
+		{7076, 3, 7080, 18}, // olo=originatorLocation
+		{7099, 3, 7103, 6}, // uld=upload
+		{7110, 3, 7114, 7}, // bat=battery
+		{7122, 5, 7128, 8}, // 10013=int10013
+		{7137, 4, 7142, 13}, // cnot=contentOffset
+		{7156, 3, 7160, 10}, // org=originator
+		{7171, 4, 7176, 22}, // smdA=semanticDescriptorAnnc
+		{7199, 2, 7202, 5}, // 37=int37
+		{7208, 3, 7212, 16}, // rts=requestTimestamp
+		{7229, 5, 7235, 20}, // ajsoa=allJoynSvcObjectAnnc
+		{7256, 4, 7261, 12}, // cmdf=cmdhDefaults
+		{7274, 4, 7279, 7}, // 4004=int4004
+		{7287, 3, 7291, 6}, // lbl=labels
+		{7298, 2, 7301, 5}, // od=order
+		{7307, 2, 7310, 10}, // at=announceTo
+		{7321, 3, 7325, 20}, // sti=stationaryIndication
+		{7346, 5, 7352, 8}, // 10014=int10014
+		{7361, 3, 7365, 15}, // ors=operationResult
+		{7381, 3, 7385, 8}, // unm=username
+		{7394, 5, 7400, 8}, // 10028=int10028
+		{7409, 5, 7415, 20}, // ajifa=allJoynInterfaceAnnc
+		{7436, 2, 7439, 10}, // li=locationID
+		{7450, 3, 7454, 6}, // api=app_ID
+		{7461, 3, 7465, 8}, // att=attached
+		{7474, 5, 7480, 17}, // ajswa=svcObjWrapperAnnc
+		{7498, 7, 7506, 8}, // m2m:sch=schedule
+		{7515, 3, 7519, 12}, // oip=originatorIP
+		{7532, 3, 7536, 21}, // tqi=tokenRequestIndicator
+		{7558, 4, 7563, 11}, // fopt=fanOutPoint
+		{7575, 3, 7579, 26}, // ppl=proposedPrivilegesLifetime
+		{7606, 4, 7611, 15}, // aniA=areaNwkInfoAnnc
+		{7627, 4, 7632, 15}, // esrv=esprimRandValue
+		{7648, 4, 7653, 22}, // tsia=timeSeriesInstanceAnnc
+		{7676, 4, 7681, 10}, // giil=inputLinks
+		{7692, 8, 7701, 40}, // m2m:gioa=genericInterworkingOperationInstanceAnnc
+		{7742, 4, 7747, 7}, // 2002=int2002
+		{7755, 2, 7758, 11}, // or=ontologyRef
+		{7770, 3, 7774, 9}, // fwv=fwVersion
+		{7784, 3, 7788, 15}, // rrl=resourceRefList
+		{7804, 4, 7809, 7}, // 5000=int5000
+		{7817, 8, 7826, 12}, // m2m:stcl=statsCollect
+		{7839, 2, 7842, 5}, // 28=int28
+		{7848, 4, 7853, 17}, // andi=areaNwkDeviceInfo
+		{7871, 2, 7874, 19}, // rr=requestReachability
+		{7894, 2, 7897, 8}, // Ls=lifespan
+		{7906, 3, 7910, 7}, // cst=cseType
+		{7918, 5, 7924, 18}, // trptA=trafficPatternAnnc
+		{7943, 4, 7948, 7}, // 1000=int1000
+		{7956, 3, 7960, 7}, // gpi=groupID
+		{7968, 2, 7971, 5}, // 58=int58
+		{7977, 3, 7981, 26}, // gis=genericInterworkingService
+		{8008, 2, 8011, 13}, // ec=eventCategory
+		{8025, 8, 8034, 12}, // m2m:schA=scheduleAnnc
+		{8047, 2, 8050, 5}, // 17=int17
+		{8056, 3, 8060, 17}, // exc=expirationCounter
+		{8078, 7, 8086, 18}, // m2m:agr=aggregatedResponse
+		{8105, 3, 8109, 13}, // nwa=networkAction
+		{8123, 4, 8128, 7}, // 5209=int5209
+		{8136, 3, 8140, 6}, // rbo=reboot
+		{8147, 3, 8151, 8}, // aci=accessId
+		{8160, 4, 8165, 30}, // gisa=genericInterworkingServiceAnnc
+		{8196, 2, 8199, 12}, // ty=resourceType
+		{8212, 4, 8217, 20}, // dset=defaultResultExpTime
+		{8238, 3, 8242, 22}, // oet=operationExecutionTime
+		{8265, 2, 8268, 5}, // 59=int59
+		{8274, 3, 8278, 10}, // dvi=deviceInfo
+		{8289, 3, 8293, 10}, // tww=timeWindow
+		{8304, 2, 8307, 5}, // 53=int53
+		{8313, 3, 8317, 15}, // eer=executionEnvRef
+		{8333, 3, 8337, 8}, // mmt=memTotal
+		{8346, 4, 8351, 16}, // spid=specializationID
+		{8368, 3, 8372, 21}, // ntu=notificationTargetURI
+		{8394, 4, 8399, 8}, // cmlk=mgmtLink
+		{8408, 2, 8411, 11}, // dc=description
+		{8423, 4, 8428, 7}, // 4108=int4108
+		{8436, 4, 8441, 15}, // dcid=dataContainerID
+		{8457, 5, 8463, 16}, // ajfwa=svcFwWrapperAnnc
+		{8480, 2, 8483, 5}, // 63=int63
+		{8489, 3, 8493, 22}, // trn=triggerReferenceNumber
+		{8516, 4, 8521, 11}, // tkps=permissions
+		{8533, 4, 8538, 16}, // loet=limitsOpExecTime
+		{8555, 3, 8559, 18}, // agr=aggregatedResponse
+		{8578, 3, 8582, 11}, // ant=areaNwkType
+		{8594, 3, 8598, 17}, // sdr=securedDasRequest
+		{8616, 5, 8622, 14}, // ajapa=allJoynAppAnnc
+		{8637, 2, 8640, 10}, // ri=resourceID
+		{8651, 6, 8658, 2}, // m2m:ae=aE
+		{8661, 4, 8666, 17}, // doet=defaultOpExecTime
+		{8684, 3, 8688, 15}, // lnh=listOfNeighbors
+		{8704, 3, 8708, 19}, // pdr=policyDeletionRules
+		{8728, 2, 8731, 6}, // ud=update
+		{8738, 3, 8742, 17}, // esk=esprimKeyGenAlgID
+		{8760, 4, 8765, 7}, // 5001=int5001
+		{8773, 2, 8776, 5}, // 15=int15
+		{8782, 3, 8786, 16}, // mdn=missingDataMaxNr
+		{8803, 3, 8807, 14}, // sci=statsCollectID
+		{8822, 3, 8826, 6}, // num=number
+		{8833, 4, 8838, 11}, // giol=outputLinks
+		{8850, 3, 8854, 10}, // tgf=targetFile
+		{8865, 2, 8868, 6}, // tg=target
+		{8875, 5, 8881, 8}, // 10034=int10034
+		{8890, 3, 8894, 14}, // tsa=timeSeriesAnnc
+		{8909, 3, 8913, 12}, // sgn=notification
+		{8926, 5, 8932, 8}, // 10030=int10030
+		{8941, 3, 8945, 9}, // dbg=debugInfo
+		{8955, 3, 8959, 10}, // dea=deactivate
+		{8970, 3, 8974, 5}, // mod=model
+		{8980, 2, 8983, 18}, // aa=announcedAttribute
+		{9002, 2, 9005, 18}, // pl=privilegesLifetime
+		{9024, 4, 9029, 8}, // tkau=audience
+		{9038, 3, 9042, 10}, // snr=sequenceNr
+		{9053, 4, 9058, 17}, // apci=applicableCredIDs
+		{9076, 4, 9081, 7}, // 6010=int6010
+		{9089, 5, 9095, 8}, // 10033=int10033
+		{9104, 7, 9112, 6}, // m2m:grp=group_
+		{9119, 2, 9122, 5}, // 12=int12
+		{9128, 3, 9132, 36}, // gio=genericInterworkingOperationInstance
+		{9169, 4, 9174, 10}, // ajop=objectPath
+		{9185, 3, 9189, 14}, // rep=representation
+		{9204, 3, 9208, 26}, // net=notificationEventType_list
+		{9235, 4, 9240, 7}, // 2000=int2000
+		{9248, 2, 9251, 5}, // 39=int39
+		{9257, 3, 9261, 23}, // esf=supportede2ESecFeatures
+		{9285, 3, 9289, 5}, // dvd=devId
+		{9295, 3, 9299, 19}, // vrq=verificationRequest
+		{9319, 2, 9322, 9}, // un=uninstall
+		{9332, 2, 9335, 10}, // ts=timeSeries
+		{9346, 3, 9350, 6}, // mem=memory
+		{9357, 4, 9362, 16}, // ajif=allJoynInterface
+		{9379, 3, 9383, 22}, // mdt=missingDataDetectTimer
+		{9406, 4, 9411, 11}, // exra=execReqArgs
+		{9423, 3, 9427, 8}, // act=activate
+		{9436, 3, 9440, 14}, // rct=requestContext
+		{9455, 3, 9459, 6}, // ena=enable
+		{9466, 4, 9471, 14}, // swup=softwareUpdate
+		{9486, 4, 9491, 13}, // tcop=tracingOption
+		{9505, 4, 9510, 7}, // 6029=int6029
+		{9518, 4, 9523, 15}, // mdlt=missingDataList
+		{9539, 8, 9548, 13}, // m2m:cntA=containerAnnc
+		{9562, 3, 9566, 10}, // cml=cmdhLimits
+		{9577, 2, 9580, 5}, // 25=int25
+		{9586, 4, 9591, 17}, // mgca=mgmtClientAddress
+		{9609, 3, 9613, 20}, // lda=limitsDelAggregation
+		{9634, 3, 9638, 14}, // rqv=requestedValue
+		{9653, 3, 9657, 12}, // cus=currentState
+		{9670, 3, 9674, 18}, // cei=collectingEntityID
+		{9693, 4, 9698, 13}, // ipv6=ipv6Addresses
+		{9712, 3, 9716, 8}, // dld=download
+		{9725, 3, 9729, 9}, // stt=startTime
+		{9739, 3, 9743, 16}, // dmd=deliveryMetaData
+		{9760, 4, 9765, 7}, // 4106=int4106
+		{9773, 2, 9776, 8}, // ds=dataSize
+		{9785, 4, 9790, 12}, // exin=execInstance
+		{9803, 8, 9812, 24}, // m2m:asar=serviceSubscribedAppRule
+		{9837, 2, 9840, 5}, // 40=int40
+		{9846, 4, 9851, 20}, // giop=outputDataPointLinks
+		{9872, 7, 9880, 6}, // m2m:aeA=aEAnnc
+		{9887, 5, 9893, 8}, // 10009=int10009
+		{9902, 3, 9906, 12}, // lti=localTokenID
+		{9919, 4, 9924, 40}, // gioa=genericInterworkingOperationInstanceAnnc
+		{9965, 2, 9968, 16}, // pc=primitiveContent
+		{9985, 5, 9991, 8}, // 10003=int10003
+		{10000, 3, 10004, 19}, // cnd=containerDefinition
+		{10024, 4, 10029, 21}, // svsn=serviceSubscribedNode
+		{10051, 2, 10054, 15}, // fo=filterOperation
+		{10070, 4, 10075, 25}, // aecs=applicableEventCategories
+		{10101, 2, 10104, 13}, // dr=deletionRules
+		{10118, 3, 10122, 24}, // ssi=semanticSupportIndicator
+		{10147, 8, 10156, 23}, // m2m:acpA=accessControlPolicyAnnc
+		{10180, 7, 10188, 14}, // m2m:lcp=locationPolicy
+		{10203, 3, 10207, 6}, // msd=MSISDN
+		{10214, 4, 10219, 4}, // uuid=UUID
+		{10224, 1, 10226, 4}, // 5=int5
+		{10231, 3, 10235, 13}, // rcn=resultContent
+		{10249, 2, 10252, 15}, // nu=notificationURI
+		{10268, 3, 10272, 21}, // srt=supportedResourceType
+		{10294, 1, 10296, 4}, // 7=int7
+		{10301, 3, 10305, 13}, // poa=pointOfAccess
+		{10319, 3, 10323, 18}, // cnm=currentNrOfMembers
+		{10342, 4, 10347, 10}, // rboA=rebootAnnc
+		{10358, 3, 10362, 15}, // mdl=missingDataList
+		{10378, 4, 10383, 15}, // eckm=escertkeMessage
+		{10399, 3, 10403, 19}, // mtv=memberTypeValidated
+		{10423, 5, 10429, 8}, // 10010=int10010
+		{10438, 2, 10441, 2}, // to=to
+		{10444, 7, 10452, 3}, // m2m:url=uRL
+		{10456, 7, 10464, 26}, // m2m:gis=genericInterworkingService
+		{10491, 2, 10494, 16}, // om=operationMonitor
+		{10511, 3, 10515, 8}, // pwd=password
+		{10524, 3, 10528, 5}, // inp=input
+		{10534, 3, 10538, 32}, // dac=dynamicAuthorizationConsultation
+		{10571, 4, 10576, 30}, // esro=sharedReceiverESPrimRandObject
+		{10607, 3, 10611, 19}, // drt=discoveryResultType
+		{10631, 5, 10637, 21}, // ajmca=allJoynMethodCallAnnc
+		{10659, 7, 10667, 7}, // m2m:req=request
+		{10675, 3, 10679, 13}, // sld=sleepDuration
+		{10693, 4, 10698, 17}, // orid=originatorRoleIDs
+		{10716, 2, 10719, 5}, // 51=int51
+		{10725, 3, 10729, 10}, // exr=execResult
+		{10740, 3, 10744, 24}, // ati=assignedTokenIdentifiers
+		{10769, 3, 10773, 15}, // sts=stateTagSmaller
+		{10789, 3, 10793, 13}, // bts=batteryStatus
+		{10807, 4, 10812, 8}, // tids=tokenIDs
+		{10821, 2, 10824, 5}, // 43=int43
+		{10830, 3, 10834, 9}, // hwv=hwVersion
+		{10844, 3, 10848, 7}, // dis=disable
+		{10856, 2, 10859, 5}, // 45=int45
+		{10865, 4, 10870, 23}, // acop=accessControlOperations
+		{10894, 3, 10898, 21}, // psn=preSubscriptionNotify
+		{10920, 8, 10929, 19}, // m2m:cinA=contentInstanceAnnc
+		{10949, 3, 10953, 13}, // ptn=providedToNSE
+		{10967, 3, 10971, 3}, // url=URL
+		{10975, 3, 10979, 6}, // out=output
+		{10986, 2, 10989, 5}, // 47=int47
+		{10995, 3, 10999, 15}, // ari=allowedRole-IDs
+		{11015, 3, 11019, 8}, // evl=eventLog
+		{11028, 3, 11032, 7}, // cmt=cmdType
+		{11040, 3, 11044, 12}, // epo=esprimObject
+		{11057, 3, 11061, 7}, // evi=eventID
+		{11069, 3, 11073, 21}, // sur=subscriptionReference
+		{11095, 2, 11098, 5}, // 14=int14
+		{11104, 4, 11109, 7}, // tkid=tokenID
+		{11117, 4, 11122, 12}, // seci=securityInfo
+		{11135, 2, 11138, 15}, // lr=locationRegions
+		{11154, 8, 11163, 13}, // m2m:fcnt=flexContainer
+		{11177, 4, 11182, 6}, // rlid=roleID
+		{11189, 3, 11193, 14}, // mnm=maxNrOfMembers
+		{11208, 4, 11213, 12}, // fwrA=firmwareAnnc
+		{11226, 3, 11230, 5}, // lim=limit
+		{11236, 4, 11241, 13}, // atrl=attributeList
+		{11255, 3, 11259, 14}, // soe=semanticOpExec
+		{11274, 8, 11283, 18}, // m2m:lcpA=locationPolicyAnnc
+		{11302, 2, 11305, 5}, // 11=int11
+		{11311, 2, 11314, 9}, // rl=rateLimit
+		{11324, 3, 11328, 7}, // apn=appName
+		{11336, 4, 11341, 7}, // 2001=int2001
+		{11349, 3, 11353, 22}, // agn=aggregatedNotification
+		{11376, 2, 11379, 5}, // 29=int29
+		{11385, 3, 11389, 10}, // exs=execStatus
+		{11400, 3, 11404, 23}, // aec=applicableEventCategory
+		{11428, 3, 11432, 10}, // daq=dasRequest
+		{11443, 7, 11451, 17}, // m2m:rsp=responsePrimitive
+		{11469, 3, 11473, 11}, // exa=expireAfter
+		{11485, 3, 11489, 11}, // cty=contentType
+		{11501, 4, 11506, 7}, // 4000=int4000
+		{11514, 4, 11519, 7}, // 5205=int5205
+		{11527, 4, 11532, 7}, // 4101=int4101
+		{11540, 3, 11544, 13}, // ttn=targetNetwork
+		{11558, 4, 11563, 14}, // gios=operationState
+		{11578, 2, 11581, 5}, // 18=int18
+		{11587, 3, 11591, 11}, // ani=areaNwkInfo
+		{11603, 4, 11608, 9}, // tkex=extension
+		{11618, 2, 11621, 5}, // 52=int52
+		{11627, 3, 11631, 8}, // fwr=firmware
+		{11640, 3, 11644, 22}, // rch=requestCharacteristics
+		{11667, 3, 11671, 12}, // man=manufacturer
+		{11684, 3, 11688, 21}, // lrp=limitsRespPersistence
+		{11710, 3, 11714, 22}, // cas=capabilityActionStatus
+		{11737, 7, 11745, 16}, // m2m:rqp=requestPrimitive
+		{11762, 3, 11766, 12}, // exb=expireBefore
+		{11779, 4, 11784, 7}, // 4110=int4110
+		{11792, 3, 11796, 22}, // gid=groupRequestIdentifier
+		{11819, 3, 11823, 17}, // pri=periodicIndicator
+		{11841, 3, 11845, 8}, // exm=execMode
+		{11854, 3, 11858, 10}, // aae=allowedAEs
+		{11869, 3, 11873, 12}, // svr=serviceRoles
+		{11886, 3, 11890, 17}, // mdd=missingDataDetect
+		{11908, 4, 11913, 13}, // ipv4=ipv4Addresses
+		{11927, 4, 11932, 9}, // lgst=logStatus
+		{11942, 3, 11946, 13}, // sli=sleepInterval
+		{11960, 3, 11964, 17}, // rqi=requestIdentifier
+	};
+
+	static const unsigned int NAME_DICTIONARY_S2L_SEEDS[167] = {
+		125, 47, 9, 18, 77, 2, 55, 1, 14, 15, 5, 11, 184, 3, 85, 13,
+		11, 20, 29, 79, 1, 2, 79, 20, 98, 3, 100, 53, 6, 57, 40, 11,
+		226, 5, 11, 120, 42, 8, 43, 3, 37, 63, 74, 2, 57, 26, 539, 29,
+		30, 91, 8, 57, 88, 94, 10, 112, 25, 35, 128, 252, 59, 54, 102, 66,
+		0, 142, 59, 69, 149, 3, 308, 102, 1, 35, 23, 255, 548, 2, 211, 6,
+		40, 27, 20, 171, 9, 51, 4, 552, 22, 22, 27, 2, 1, 218, 18, 621,
+		12, 353, 31, 5, 1, 6, 784, 38, 6, 5, 7, 353, 3, 51, 24, 108,
+		31, 73, 565, 531, 79, 66, 86, 821, 64, 0, 62, 257, 1211, 821, 136, 1,
+		31, 676, 619, 26, 512, 427, 2, 5, 1158, 689, 1093, 390, 10, 2, 112, 278,
+		300, 1120, 11, 501, 907, 22, 1, 473, 49, 1909, 6, 5, 95, 65, 2, 310,
+		1, 1612, 466, 1127, 98, 77, 51,
+	};
+
+	static const NameDictionary NAME_DICTIONARY_S2L = {
+		NAME_DICTIONARY_S2L_STRINGS, NAME_DICTIONARY_S2L_ENTRIES, NAME_DICTIONARY_S2L_SEEDS, 665, 167
+	};
+
+}
+
+#endif
@@ -0,0 +1,241 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_NameMapping.cc
+//  Description:        Process-wide registry of the oneM2M long/short name mapping tables
+//  Rev:                R2I
+
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+#include "OneM2M_NameMapping.hh"
+#include "OneM2M_NameDictionary.hh"
+#include "External_function.hh"
+#include "OneM2M_DualFaceMapping.hh"
+
+namespace OneM2M__DualFaceMapping {
+
+	static const char* LONG_TO_SHORT_FILE = "long_to_short_mapping.txt";
+	static const char* SHORT_TO_LONG_FILE = "short_to_long_mapping.txt";
+
+	/**
+	 * @desc FNV-1a followed by the murmur3 finalizer, must match name_hash() in gen_name_dictionary.py
+	 */
+	uint32_t NameDictionary::hash(const char* key, size_t length, uint32_t seed) {
+		uint32_t h = 2166136261u ^ seed;
+
+		for(size_t i = 0; i < length; i++) {
+			h ^= (unsigned char)key[i];
+			h *= 16777619u;
+		}
+		h ^= h >> 16;
+		h *= 0x85ebca6bu;
+		h ^= h >> 13;
+		h *= 0xc2b2ae35u;
+		h ^= h >> 16;
+		return h;
+	}
+
+	const char* NameDictionary::find(const char* key, size_t length) const {
+		unsigned int seed = seeds[hash(key, length, 0) % bucket_count];
+
+		if(seed == 0) { // empty bucket
+			return NULL;
+		}
+
+		const NameDictionaryEntry& entry = entries[hash(key, length, seed) % size];
+
+		if(entry.key_length != length || memcmp(strings + entry.key_offset, key, length) != 0) {
+			return NULL;
+		}
+		return strings + entry.value_offset;
+	}
+
+	static pthread_once_t initial_load_once = PTHREAD_ONCE_INIT;
+
+	static void initial_load() {
+		NameMappingRegistry::instance().reload();
+	}
+
+	NameMappingRegistry& NameMappingRegistry::instance() {
+		static NameMappingRegistry registry;
+		return registry;
+	}
+
+	NameMappingRegistry::NameMappingRegistry() : loaded(false), hmap_l2s(NULL), hmap_s2l(NULL), interned_names(2048) {
+		pthread_mutex_init(&lock, NULL);
+	}
+
+	NameMappingRegistry::~NameMappingRegistry() {
+		pthread_mutex_destroy(&lock);
+	}
+
+	bool NameMappingRegistry::ensureLoaded() {
+		// the files are read at most once here, later attempts have to go through reload()
+		pthread_once(&initial_load_once, initial_load);
+
+		return __atomic_load_n(&loaded, __ATOMIC_ACQUIRE);
+	}
+
+	bool NameMappingRegistry::reload(const char* p_table_dir) {
+		std::string table_dir;
+
+		if(p_table_dir != NULL && *p_table_dir != '\0') {
+			table_dir = p_table_dir;
+		} else {
+			table_dir = (const char*)OneM2M__Constants::tsp__nameMappingTableDir;
+		}
+
+		if(table_dir.empty()) {
+			pthread_mutex_lock(&lock);
+			NameMappingTable* old_l2s = __atomic_exchange_n(&hmap_l2s, (NameMappingTable*)NULL, __ATOMIC_ACQ_REL);
+			NameMappingTable* old_s2l = __atomic_exchange_n(&hmap_s2l, (NameMappingTable*)NULL, __ATOMIC_ACQ_REL);
+			__atomic_store_n(&loaded, true, __ATOMIC_RELEASE);
+			pthread_mutex_unlock(&lock);
+			delete old_l2s;
+			delete old_s2l;
+
+			TTCN_Logger::log(TTCN_DEBUG, "Using the compiled-in oneM2M long/short name mapping tables");
+			return true;
+		}
+		return load(table_dir);
+	}
+
+	/**
+	 * @desc read both table files into new hash maps and publish them only if both could be read,
+	 *       so that a failed reload keeps the previous tables. The replaced index tables are deleted,
+	 *       the names they pointed to stay in the arena.
+	 */
+	bool NameMappingRegistry::load(const std::string& table_dir) {
+		std::string dir_prefix = table_dir;
+
+		if(!dir_prefix.empty() && dir_prefix[dir_prefix.length() - 1] != '/') {
+			dir_prefix += '/';
+		}
+
+		NameMappingTable* new_l2s = new NameMappingTable(1024);
+		NameMappingTable* new_s2l = new NameMappingTable(1024);
+
+		// the lock also protects the name arena filled while reading
+		pthread_mutex_lock(&lock);
+		if(!readTableFile(dir_prefix + LONG_TO_SHORT_FILE, *new_l2s) ||
+		   !readTableFile(dir_prefix + SHORT_TO_LONG_FILE, *new_s2l)) {
+			pthread_mutex_unlock(&lock);
+			TTCN_Logger::log(TTCN_WARNING, "oneM2M long/short name mapping tables could not be read from %s", table_dir.c_str());
+			delete new_l2s;
+			delete new_s2l;
+			return false;
+		}
+
+		NameMappingTable* old_l2s = __atomic_exchange_n(&hmap_l2s, new_l2s, __ATOMIC_ACQ_REL);
+		NameMappingTable* old_s2l = __atomic_exchange_n(&hmap_s2l, new_s2l, __ATOMIC_ACQ_REL);
+		__atomic_store_n(&loaded, true, __ATOMIC_RELEASE);
+		pthread_mutex_unlock(&lock);
+		delete old_l2s;
+		delete old_s2l;
+
+		TTCN_Logger::log(TTCN_DEBUG, "oneM2M long/short name mapping tables loaded from %s", table_dir.c_str());
+		return true;
+	}
+
+	/**
+	 * @desc read mapping information "name=mapped_name" line by line from a text file into a hash map
+	 */
+	bool NameMappingRegistry::readTableFile(const std::string& file_path, NameMappingTable& table) {
+		std::ifstream fin(file_path.c_str());
+
+		if(!fin.is_open()) {
+			return false;
+		}
+
+		std::string line;
+		bool flag = false;
+
+		while(std::getline(fin, line)) {
+			if(!line.empty() && line[line.length() - 1] == '\r') {
+				line.erase(line.length() - 1);
+			}
+
+			if(line.empty()) {
+				continue;
+			}
+
+			std::vector<std::string> vector_l2s = split(line, '=');
+			std::string source_str = "";
+			std::string dest_str = "";
+
+			for(unsigned int j = 0; j < vector_l2s.size(); j++) {
+				if(0 == j && vector_l2s[j] != "")
+					source_str = vector_l2s[j];
+				if(j > 0 && vector_l2s[j] != "")
+					dest_str = vector_l2s[j];
+			}
+
+			if(source_str == "" || dest_str == "") {
+				TTCN_Logger::log(TTCN_WARNING, "Invalid oneM2M name mapping entry <%s> in %s", line.c_str(), file_path.c_str());
+				return false;
+			}
+
+			table.put(source_str, intern(dest_str));
+			flag = true;
+		}
+		return flag;
+	}
+
+	/**
+	 * @desc returns the copy of name in the name arena, adding it if it is not there yet.
+	 *       Reloading the same files therefore does not grow the arena.
+	 */
+	const char* NameMappingRegistry::intern(const std::string& name) {
+		const char* const* interned = interned_names.find(name);
+
+		if(interned != NULL) {
+			return *interned;
+		}
+
+		name_arena.push_back(name);
+		const char* copy = name_arena.back().c_str();
+		interned_names.put(name, copy);
+		return copy;
+	}
+
+	const char* NameMappingRegistry::lookup(bool long_to_short, const char* key, size_t length) {
+		// lookups do not lock, published tables are immutable until a reload replaces them
+		NameMappingTable* table = __atomic_load_n(long_to_short ? &hmap_l2s : &hmap_s2l, __ATOMIC_ACQUIRE);
+
+		if(table == NULL) {
+			return long_to_short ? NAME_DICTIONARY_L2S.find(key, length) : NAME_DICTIONARY_S2L.find(key, length);
+		}
+
+		const char* const* value = table->find(StringRef(key, length));
+		return value != NULL ? *value : NULL;
+	}
+
+	const char* NameMappingRegistry::getShortName(const char* long_name, size_t length) {
+		return lookup(true, long_name, length);
+	}
+
+	const char* NameMappingRegistry::getLongName(const char* short_name, size_t length) {
+		return lookup(false, short_name, length);
+	}
+
+	/**
+	 * @desc re-read the long/short name mapping tables, e.g. after the table files have been modified
+	 * @p__table__dir: directory containing the table files, the module parameter tsp_nameMappingTableDir is used if empty
+	 */
+	BOOLEAN f__reloadNameMapping(const CHARSTRING& p__table__dir) {
+		return NameMappingRegistry::instance().reload((const char*)p__table__dir);
+	}
+}
@@ -0,0 +1,105 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_NameMapping.hh
+//  Description:        Process-wide registry of the oneM2M long/short name mapping tables
+//  Rev:                R2I
+
+#ifndef ONEM2M_NAMEMAPPING_HH
+#define ONEM2M_NAMEMAPPING_HH
+
+#include <string>
+#include <deque>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "FlatHashMap.h"
+
+namespace OneM2M__DualFaceMapping {
+
+	/**
+	 * @desc one name pair of a compiled-in dictionary, offsets point into NameDictionary::strings
+	 */
+	struct NameDictionaryEntry {
+		unsigned short key_offset;
+		unsigned char key_length;
+		unsigned short value_offset;
+		unsigned char value_length;
+	};
+
+	/**
+	 * @desc read-only minimal perfect hash table generated by gen_name_dictionary.py (see OneM2M_NameDictionary.hh).
+	 *       A key is first assigned to one of bucket_count buckets, the seed of the bucket then selects its slot in entries.
+	 */
+	struct NameDictionary {
+		const char* strings;
+		const NameDictionaryEntry* entries;
+		const unsigned int* seeds;
+		unsigned int size;
+		unsigned int bucket_count;
+
+		static uint32_t hash(const char* key, size_t length, uint32_t seed);
+
+		// returns the NUL terminated mapped name, or NULL if the key is not in the dictionary
+		const char* find(const char* key, size_t length) const;
+	};
+
+	// the mapped names point into the name arena of NameMappingRegistry
+	typedef FlatHashMap<std::string, const char*> NameMappingTable;
+
+	/**
+	 * @desc Holds the long-to-short and short-to-long tables for the whole process.
+	 *       By default the dictionaries compiled into the binary are used. If tsp_nameMappingTableDir is set,
+	 *       the table files of that directory are read on first use instead; reload() re-reads them.
+	 *       The names of the tables read from files are interned in an append-only arena that is never freed,
+	 *       so returned names stay valid after a reload; only the index tables are replaced and deleted.
+	 *       Reloading while another thread looks up names is not supported.
+	 */
+	class NameMappingRegistry {
+	public:
+		static NameMappingRegistry& instance();
+
+		// Loads the configured tables if this has not been done yet, returns true if names can be looked up
+		bool ensureLoaded();
+
+		// Re-reads the tables from p_table_dir, or from the configured directory if NULL or empty.
+		// Without any directory the compiled-in dictionaries are used again.
+		bool reload(const char* p_table_dir = NULL);
+
+		// Return the NUL terminated mapped name without copying it, or NULL if the name is not mapped
+		const char* getShortName(const char* long_name, size_t length);
+		const char* getLongName(const char* short_name, size_t length);
+
+	private:
+		NameMappingRegistry();
+		~NameMappingRegistry();
+		NameMappingRegistry(const NameMappingRegistry&);
+		NameMappingRegistry& operator=(const NameMappingRegistry&);
+
+		bool load(const std::string& table_dir);
+		const char* lookup(bool long_to_short, const char* key, size_t length);
+
+		bool readTableFile(const std::string& file_path, NameMappingTable& table);
+		const char* intern(const std::string& name);
+
+		pthread_mutex_t lock; // serializes reloads
+		bool loaded;
+		NameMappingTable* hmap_l2s; //long-2-short name mapping read from file, NULL for the compiled-in one
+		NameMappingTable* hmap_s2l; //short-2-long name mapping read from file, NULL for the compiled-in one
+		std::deque<std::string> name_arena; // every distinct mapped name read from a file, elements never move
+		FlatHashMap<std::string, const char*> interned_names; // name -> its copy in name_arena
+	};
+}
+
+#endif
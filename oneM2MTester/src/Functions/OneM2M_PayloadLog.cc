@@ -0,0 +1,72 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_PayloadLog.cc
+//  Description:        Debug logging of the message payloads handled by the oneM2M dual face mapping
+//  Rev:                R2I
+
+#include "json.h"
+#include "OneM2M_PayloadLog.hh"
+#include "OneM2M_DualFaceMapping.hh"
+
+namespace OneM2M__DualFaceMapping {
+
+	void log_payload(const char* title, const char* payload, size_t length) {
+		if(!payload_log_enabled()) {
+			return;
+		}
+
+		int max_length = (int)OneM2M__Constants::tsp__maxLoggedPayloadLength;
+
+		if(max_length <= 0 || length <= (size_t)max_length) {
+			TTCN_Logger::log(TTCN_DEBUG, "%s:\n%.*s", title, (int)length, payload);
+			return;
+		}
+
+		size_t cut = max_length;
+
+		// do not cut an UTF-8 sequence
+		while(cut > 0 && (payload[cut] & 0xC0) == 0x80) {
+			cut--;
+		}
+		TTCN_Logger::log(TTCN_DEBUG, "%s (first %lu of %lu bytes):\n%.*s\n...", title,
+		                 (unsigned long)cut, (unsigned long)length, (int)cut, payload);
+	}
+
+	void log_payload(const char* title, const std::string& payload) {
+		log_payload(title, payload.data(), payload.length());
+	}
+
+	void log_payload(const char* title, const Json::Value& value) {
+		if(!payload_log_enabled()) {
+			return;
+		}
+
+		Json::StyledWriter writer;
+		std::string styled = writer.write(value);
+
+		log_payload(title, styled);
+	}
+
+	void log_payload(const char* title, const tinyxml2::XMLNode& node) {
+		if(!payload_log_enabled()) {
+			return;
+		}
+
+		tinyxml2::XMLPrinter printer;
+
+		node.Accept(&printer);
+		log_payload(title, printer.CStr(), printer.CStrSize() - 1);
+	}
+}
@@ -0,0 +1,46 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_PayloadLog.hh
+//  Description:        Debug logging of the message payloads handled by the oneM2M dual face mapping
+//  Rev:                R2I
+
+#ifndef ONEM2M_PAYLOADLOG_HH
+#define ONEM2M_PAYLOADLOG_HH
+
+#include <string>
+#include <stddef.h>
+#include <TTCN3.hh>
+#include "tinyxml2.h"
+#include "json-forwards.h"
+
+namespace OneM2M__DualFaceMapping {
+
+	// true if payload dumps are logged, anything that is only built for the log should be skipped otherwise
+	inline bool payload_log_enabled() {
+		return TTCN_Logger::log_this_event(TTCN_DEBUG);
+	}
+
+	/**
+	 * @desc Log a payload as DEBUG event after the title line. Payloads longer than the module parameter
+	 *       tsp_maxLoggedPayloadLength are cut. The Json::Value and XMLNode variants print the document
+	 *       only if DEBUG events are logged.
+	 */
+	void log_payload(const char* title, const char* payload, size_t length);
+	void log_payload(const char* title, const std::string& payload);
+	void log_payload(const char* title, const Json::Value& value);
+	void log_payload(const char* title, const tinyxml2::XMLNode& node);
+}
+
+#endif
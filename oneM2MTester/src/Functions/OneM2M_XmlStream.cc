@@ -0,0 +1,698 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_XmlStream.cc
+//  Description:        Streaming XML tokenizer, writer and long/short name transcoders of the
+//                      oneM2M dual face mapping, used instead of DeepParser and DeepParserDec
+//  Rev:                R2I
+
+#include <string.h>
+#include "OneM2M_XmlStream.hh"
+#include "OneM2M_NameMapping.hh"
+#include "External_function.hh"
+
+namespace OneM2M__DualFaceMapping {
+
+	enum {
+		EXPECT_PROLOG, EXPECT_ROOT, EXPECT_ATTRIBUTE, EXPECT_CONTENT, EXPECT_END, EXPECT_NOTHING
+	};
+
+	// tinyxml2 has no nesting limit, deeper documents are left to the DOM parsers
+	static const size_t MAX_NESTING = 1000;
+	static const size_t PRINTER_INDENT_SIZE = 4; // tinyxml2::XMLPrinter::PrintSpace()
+
+	// the entities of tinyxml2, both in the order of its entity table
+	static const char* const ENTITY_PATTERNS[] = { "quot", "amp", "apos", "lt", "gt" };
+	static const char ENTITY_VALUES[] = { '"', '&', '\'', '<', '>' };
+	static const size_t ENTITY_COUNT = sizeof(ENTITY_VALUES);
+
+	// XMLUtil::IsWhiteSpace() for the ASCII range
+	static inline bool isWhitespace(char c) {
+		return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+	}
+
+	// XMLUtil::IsNameStartChar() and XMLUtil::IsNameChar()
+	static inline bool isNameStartChar(unsigned char c) {
+		return c >= 128 || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == ':' || c == '_';
+	}
+
+	static inline bool isNameChar(unsigned char c) {
+		return isNameStartChar(c) || (c >= '0' && c <= '9') || c == '.' || c == '-';
+	}
+
+	static inline bool nameIs(const char* name, size_t length, const char* literal) {
+		return strlen(literal) == length && memcmp(name, literal, length) == 0;
+	}
+
+	/**
+	 * @desc index of the entity starting at the '&' of text in ENTITY_VALUES, -1 if there is none
+	 */
+	static int findEntity(const char* text, size_t length) {
+		for(size_t i = 0; i < ENTITY_COUNT; i++) {
+			size_t pattern_length = strlen(ENTITY_PATTERNS[i]);
+
+			if(pattern_length + 2 <= length && memcmp(text + 1, ENTITY_PATTERNS[i], pattern_length) == 0 &&
+			   text[pattern_length + 1] == ';') {
+				return (int)i;
+			}
+		}
+		return -1;
+	}
+
+	XMLTokenizer::XMLTokenizer(const char* input) : pos(input), expect(EXPECT_PROLOG) {
+	}
+
+	void XMLTokenizer::skipWhitespace() {
+		while(isWhitespace(*pos)) {
+			pos++;
+		}
+	}
+
+	XMLTokenizer::Token XMLTokenizer::fail() {
+		Token token;
+
+		token.type = TOKEN_ERROR;
+		token.text = pos;
+		token.length = 0;
+		token.value = NULL;
+		token.value_length = 0;
+		expect = EXPECT_NOTHING;
+		return token;
+	}
+
+	XMLTokenizer::Token XMLTokenizer::next() {
+		Token token;
+		const char* start = pos;
+
+		token.text = NULL;
+		token.length = 0;
+		token.value = NULL;
+		token.value_length = 0;
+
+		skipWhitespace();
+
+		switch(expect) {
+		case EXPECT_PROLOG:
+		case EXPECT_ROOT:
+			if(expect == EXPECT_PROLOG && pos[0] == '<' && pos[1] == '?') {
+				const char* end = strstr(pos + 2, "?>");
+
+				if(end == NULL) {
+					break;
+				}
+				token.type = TOKEN_DECLARATION;
+				token.text = pos + 2;
+				token.length = end - token.text;
+				pos = end + 2;
+				expect = EXPECT_ROOT;
+				return token;
+			}
+			if(*pos == '<' && readStartTag(token)) {
+				return token;
+			}
+			break;
+		case EXPECT_ATTRIBUTE:
+			if(*pos == '>') {
+				pos++;
+				expect = EXPECT_CONTENT;
+				token.type = TOKEN_CONTENT_BEGIN;
+				return token;
+			}
+			if(pos[0] == '/' && pos[1] == '>') {
+				pos += 2;
+				token.type = TOKEN_ELEMENT_END;
+				closeElement();
+				return token;
+			}
+			// tinyxml2 also reads attributes that are not separated by whitespace
+			if(pos != start && readAttribute(token)) {
+				return token;
+			}
+			break;
+		case EXPECT_CONTENT:
+			if(*pos == '<') {
+				if(pos[1] == '/' ? readEndTag(token) : readStartTag(token)) {
+					return token;
+				}
+				break;
+			}
+			// text that is not only whitespace is kept as it is, including the leading whitespace
+			pos = start;
+			if(readText(token)) {
+				return token;
+			}
+			break;
+		case EXPECT_END:
+			if(*pos == '\0') {
+				token.type = TOKEN_END;
+				return token;
+			}
+			break;
+		}
+		return fail();
+	}
+
+	bool XMLTokenizer::readName(Name& name) {
+		if(!isNameStartChar(*pos)) {
+			return false;
+		}
+		name.text = pos;
+		while(isNameChar(*pos)) {
+			pos++;
+		}
+		name.length = pos - name.text;
+		return true;
+	}
+
+	/**
+	 * @desc start tag up to its name, comments, CDATA sections and the like do not start with a name
+	 */
+	bool XMLTokenizer::readStartTag(Token& token) {
+		Name name;
+
+		pos++;
+		if(!readName(name)) {
+			return false;
+		}
+		open_elements.push_back(name);
+		attributes.clear();
+		expect = EXPECT_ATTRIBUTE;
+		token.type = TOKEN_ELEMENT_BEGIN;
+		token.text = name.text;
+		token.length = name.length;
+		return true;
+	}
+
+	bool XMLTokenizer::readEndTag(Token& token) {
+		Name name;
+		const Name& open = open_elements.back();
+
+		pos += 2;
+		if(!readName(name) || name.length != open.length || memcmp(name.text, open.text, name.length) != 0) {
+			return false;
+		}
+		skipWhitespace();
+		if(*pos != '>') {
+			return false;
+		}
+		pos++;
+		token.type = TOKEN_ELEMENT_END;
+		token.text = name.text;
+		token.length = name.length;
+		closeElement();
+		return true;
+	}
+
+	bool XMLTokenizer::readAttribute(Token& token) {
+		Name name;
+
+		if(!readName(name)) {
+			return false;
+		}
+		skipWhitespace();
+		if(*pos != '=') {
+			return false;
+		}
+		pos++;
+		skipWhitespace();
+		if(*pos != '"' && *pos != '\'') {
+			return false;
+		}
+
+		const char* end = strchr(pos + 1, *pos);
+
+		if(end == NULL || !checkEntities(pos + 1, end - pos - 1)) {
+			return false;
+		}
+
+		// tinyxml2 rejects the whole document
+		for(size_t i = 0; i < attributes.size(); i++) {
+			if(attributes[i].length == name.length && memcmp(attributes[i].text, name.text, name.length) == 0) {
+				return false;
+			}
+		}
+		attributes.push_back(name);
+
+		token.type = TOKEN_ATTRIBUTE;
+		token.text = name.text;
+		token.length = name.length;
+		token.value = pos + 1;
+		token.value_length = end - pos - 1;
+		pos = end + 1;
+		return true;
+	}
+
+	bool XMLTokenizer::readText(Token& token) {
+		const char* end = strchr(pos, '<');
+
+		if(end == NULL || !checkEntities(pos, end - pos)) {
+			return false;
+		}
+		token.type = TOKEN_TEXT;
+		token.text = pos;
+		token.length = end - pos;
+		pos = end;
+		return true;
+	}
+
+	/**
+	 * @desc true if text only has entities that tinyxml2 decodes by name and no carriage returns,
+	 *       which it would normalize
+	 */
+	bool XMLTokenizer::checkEntities(const char* text, size_t length) const {
+		for(size_t i = 0; i < length; i++) {
+			if(text[i] == '\r' || (text[i] == '&' && findEntity(text + i, length - i) < 0)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void XMLTokenizer::closeElement() {
+		open_elements.pop_back();
+		expect = open_elements.empty() ? EXPECT_END : EXPECT_CONTENT;
+	}
+
+	XMLStreamWriter::XMLStreamWriter(std::string& output) : out(output), just_opened(false), has_text(false), first(true) {
+	}
+
+	void XMLStreamWriter::indent(size_t level) {
+		out.append(level * PRINTER_INDENT_SIZE, ' ');
+	}
+
+	void XMLStreamWriter::seal() {
+		if(just_opened) {
+			out += '>';
+			just_opened = false;
+		}
+	}
+
+	void XMLStreamWriter::declaration() {
+		seal();
+		if(!first) {
+			out += '\n';
+			indent(open_elements.size());
+		}
+		first = false;
+		out += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>";
+	}
+
+	void XMLStreamWriter::beginElement(const char* name, size_t length) {
+		Name element;
+
+		seal();
+		if(!first) {
+			out += '\n';
+		}
+		indent(open_elements.size());
+		out += '<';
+		out.append(name, length);
+
+		element.text = name;
+		element.length = length;
+		open_elements.push_back(element);
+		just_opened = true;
+		has_text = false;
+		first = false;
+	}
+
+	void XMLStreamWriter::endElement() {
+		const Name& element = open_elements.back();
+
+		if(just_opened) {
+			out += "/>";
+		} else {
+			if(!has_text) {
+				out += '\n';
+				indent(open_elements.size() - 1);
+			}
+			out += "</";
+			out.append(element.text, element.length);
+			out += '>';
+		}
+		open_elements.pop_back();
+		if(open_elements.empty()) {
+			out += '\n';
+		}
+		just_opened = false;
+		has_text = false;
+	}
+
+	void XMLStreamWriter::attribute(const char* name, size_t length, const char* value, size_t value_length) {
+		out += ' ';
+		out.append(name, length);
+		out += "=\"";
+		appendEscaped(value, value_length, true);
+		out += '"';
+	}
+
+	void XMLStreamWriter::text(const char* value, size_t length) {
+		seal();
+		appendEscaped(value, length, false);
+		has_text = true;
+	}
+
+	/**
+	 * @desc XMLPrinter::PrintString() of the decoded value, attribute values get all the entities and
+	 *       text only the restricted ones
+	 */
+	void XMLStreamWriter::appendEscaped(const char* value, size_t length, bool attribute_value) {
+		size_t run = 0; // start of the bytes not written yet
+
+		for(size_t i = 0; i < length; i++) {
+			char c = value[i];
+			size_t skip = 0;
+
+			if(c == '&') {
+				int entity = findEntity(value + i, length - i);
+
+				if(entity >= 0) {
+					c = ENTITY_VALUES[entity];
+					skip = strlen(ENTITY_PATTERNS[entity]) + 1;
+				}
+			}
+
+			if(c == '&' || c == '<' || c == '>' || (attribute_value && (c == '"' || c == '\''))) {
+				out.append(value + run, i - run);
+				for(size_t e = 0; e < ENTITY_COUNT; e++) {
+					if(ENTITY_VALUES[e] == c) {
+						out += '&';
+						out += ENTITY_PATTERNS[e];
+						out += ';';
+						break;
+					}
+				}
+				i += skip;
+				run = i + 1;
+			} else if(skip > 0) { // decoded quote in text
+				out.append(value + run, i - run);
+				out += c;
+				i += skip;
+				run = i + 1;
+			}
+		}
+		out.append(value + run, length - run);
+	}
+
+	XMLStreamEncoder::XMLStreamEncoder(const char* source, std::string& output) :
+		tokenizer(source), writer(output), resource_name_short(NULL) {
+	}
+
+	const char* XMLStreamEncoder::shortName(const char* name, size_t length, size_t& short_length) {
+		const char* short_name = NameMappingRegistry::instance().getShortName(name, length);
+
+		if(short_name == NULL) {
+			short_length = length;
+			return name;
+		}
+		short_length = strlen(short_name);
+		return short_name;
+	}
+
+	bool XMLStreamEncoder::encode() {
+		resource_name_short = getShortName(RESOURCE_NAME);
+		if(*resource_name_short == '\0') {
+			return false;
+		}
+
+		// the DOM based encoder only handles a PrimitiveContent element without a declaration in front
+		Token root = tokenizer.next();
+
+		if(root.type != XMLTokenizer::TOKEN_ELEMENT_BEGIN) {
+			return false;
+		}
+
+		size_t name_length;
+		const char* name = shortName(root.text, root.length, name_length);
+
+		if(!nameIs(name, name_length, PRIMITIVE_CONTENT)) {
+			return false;
+		}
+
+		Token token = tokenizer.next();
+
+		while(token.type == XMLTokenizer::TOKEN_ATTRIBUTE) {
+			token = tokenizer.next();
+		}
+		if(token.type != XMLTokenizer::TOKEN_CONTENT_BEGIN) {
+			return false;
+		}
+
+		token = tokenizer.next();
+		if(token.type != XMLTokenizer::TOKEN_ELEMENT_BEGIN || !encodeResource(token)) {
+			return false;
+		}
+
+		// anything after the resource would be ignored by the DOM based encoder
+		return tokenizer.next().type == XMLTokenizer::TOKEN_ELEMENT_END && tokenizer.next().type == XMLTokenizer::TOKEN_END;
+	}
+
+	/**
+	 * @desc the resource element, which gets the namespace attributes and is the root of the encoded document
+	 */
+	bool XMLStreamEncoder::encodeResource(const Token& begin) {
+		size_t name_length;
+		const char* name = shortName(begin.text, begin.length, name_length);
+		Token namespace_attr, xsi_attr, resource_name_attr;
+		bool has_namespace = false, has_xsi = false, has_resource_name = false;
+		Token token = tokenizer.next();
+
+		for(; token.type == XMLTokenizer::TOKEN_ATTRIBUTE; token = tokenizer.next()) {
+			if(nameIs(token.text, token.length, NAMESPACE_TAG)) {
+				namespace_attr = token;
+				has_namespace = true;
+			} else if(nameIs(token.text, token.length, XSI_TAG)) {
+				xsi_attr = token;
+				has_xsi = true;
+			} else if(nameIs(token.text, token.length, RESOURCE_NAME)) {
+				resource_name_attr = token;
+				has_resource_name = true;
+			}
+		}
+		if(token.type != XMLTokenizer::TOKEN_CONTENT_BEGIN && token.type != XMLTokenizer::TOKEN_ELEMENT_END) {
+			return false;
+		}
+
+		writer.declaration();
+		writer.beginElement(name, name_length);
+		if(has_namespace) {
+			writer.attribute(NAMESPACE_TAG, strlen(NAMESPACE_TAG), namespace_attr.value, namespace_attr.value_length);
+		}
+		if(has_xsi) {
+			writer.attribute(XSI_TAG, strlen(XSI_TAG), xsi_attr.value, xsi_attr.value_length);
+		}
+		if(!has_namespace && !has_xsi) {
+			writer.attribute(NAMESPACE_TAG, strlen(NAMESPACE_TAG), XML_NAMESPACE, strlen(XML_NAMESPACE));
+			writer.attribute(XSI_TAG, strlen(XSI_TAG), XSI, strlen(XSI));
+		}
+		if(has_resource_name) {
+			writer.attribute(resource_name_short, strlen(resource_name_short), resource_name_attr.value, resource_name_attr.value_length);
+		}
+
+		if(token.type == XMLTokenizer::TOKEN_CONTENT_BEGIN) {
+			// every child node is given to DeepParser as an element
+			for(token = tokenizer.next(); token.type == XMLTokenizer::TOKEN_ELEMENT_BEGIN; token = tokenizer.next()) {
+				if(!encodeElement(token)) {
+					return false;
+				}
+			}
+			if(token.type != XMLTokenizer::TOKEN_ELEMENT_END) {
+				return false;
+			}
+		}
+		writer.endElement();
+		return true;
+	}
+
+	/**
+	 * @desc an element as DeepParser maps it: only resourceName is kept of the attributes, the text
+	 *       only if there are no child elements
+	 */
+	bool XMLStreamEncoder::encodeElement(const Token& begin) {
+		if(tokenizer.depth() > MAX_NESTING) {
+			return false;
+		}
+
+		size_t name_length;
+		const char* name = shortName(begin.text, begin.length, name_length);
+		Token token = tokenizer.next();
+
+		writer.beginElement(name, name_length);
+		for(; token.type == XMLTokenizer::TOKEN_ATTRIBUTE; token = tokenizer.next()) {
+			if(nameIs(token.text, token.length, RESOURCE_NAME)) {
+				writer.attribute(resource_name_short, strlen(resource_name_short), token.value, token.value_length);
+			}
+		}
+		if(token.type == XMLTokenizer::TOKEN_ELEMENT_END) {
+			writer.endElement();
+			return true;
+		}
+		if(token.type != XMLTokenizer::TOKEN_CONTENT_BEGIN) {
+			return false;
+		}
+
+		const char* text = NULL;
+		size_t text_length = 0;
+		bool has_children = false;
+
+		for(token = tokenizer.next(); token.type != XMLTokenizer::TOKEN_ELEMENT_END; token = tokenizer.next()) {
+			if(token.type == XMLTokenizer::TOKEN_ELEMENT_BEGIN) {
+				has_children = true;
+				if(!encodeElement(token)) {
+					return false;
+				}
+			} else if(token.type == XMLTokenizer::TOKEN_TEXT) {
+				if(text == NULL) {
+					text = token.text;
+					text_length = token.length;
+				}
+			} else {
+				return false;
+			}
+		}
+		if(text != NULL && !has_children) {
+			writer.text(text, text_length);
+		}
+		writer.endElement();
+		return true;
+	}
+
+	XMLStreamDecoder::XMLStreamDecoder(const char* source, std::string& output) : tokenizer(source), writer(output) {
+	}
+
+	const char* XMLStreamDecoder::longName(const char* name, size_t length, size_t& long_length) {
+		const char* long_name = NameMappingRegistry::instance().getLongName(name, length);
+
+		if(long_name == NULL) {
+			long_length = length;
+			return name;
+		}
+		long_length = strlen(long_name);
+		return long_name;
+	}
+
+	bool XMLStreamDecoder::decode() {
+		const char* resource_name_short = getShortName(RESOURCE_NAME);
+		Token root = tokenizer.next();
+
+		if(root.type == XMLTokenizer::TOKEN_DECLARATION) {
+			root = tokenizer.next();
+		}
+		if(root.type != XMLTokenizer::TOKEN_ELEMENT_BEGIN) {
+			return false;
+		}
+
+		size_t name_length;
+		const char* name = longName(root.text, root.length, name_length);
+		Token namespace_attr, resource_name_attr;
+		bool has_namespace = false, has_resource_name = false;
+		Token token = tokenizer.next();
+
+		for(; token.type == XMLTokenizer::TOKEN_ATTRIBUTE; token = tokenizer.next()) {
+			if(nameIs(token.text, token.length, NAMESPACE_TAG)) {
+				namespace_attr = token;
+				has_namespace = true;
+			} else if(*resource_name_short != '\0' && nameIs(token.text, token.length, resource_name_short)) {
+				resource_name_attr = token;
+				has_resource_name = true;
+			}
+		}
+		if(token.type != XMLTokenizer::TOKEN_CONTENT_BEGIN && token.type != XMLTokenizer::TOKEN_ELEMENT_END) {
+			return false;
+		}
+
+		writer.beginElement(PRIMITIVE_CONTENT, strlen(PRIMITIVE_CONTENT));
+		if(has_namespace) {
+			writer.attribute(NAMESPACE_TAG, strlen(NAMESPACE_TAG), namespace_attr.value, namespace_attr.value_length);
+		} else {
+			writer.attribute(NAMESPACE_TAG, strlen(NAMESPACE_TAG), XML_NAMESPACE, strlen(XML_NAMESPACE));
+		}
+		writer.beginElement(name, name_length);
+		if(has_resource_name) {
+			const char* resource_name_long = getLongName(resource_name_short);
+
+			if(*resource_name_long == '\0') {
+				return false;
+			}
+			writer.attribute(resource_name_long, strlen(resource_name_long), resource_name_attr.value, resource_name_attr.value_length);
+		}
+
+		if(token.type == XMLTokenizer::TOKEN_CONTENT_BEGIN) {
+			// every child node is given to DeepParserDec as an element
+			for(token = tokenizer.next(); token.type == XMLTokenizer::TOKEN_ELEMENT_BEGIN; token = tokenizer.next()) {
+				if(!decodeElement(token)) {
+					return false;
+				}
+			}
+			if(token.type != XMLTokenizer::TOKEN_ELEMENT_END) {
+				return false;
+			}
+		}
+		writer.endElement();
+		writer.endElement();
+
+		// the DOM based decoder takes the last node of the document as root
+		return tokenizer.next().type == XMLTokenizer::TOKEN_END;
+	}
+
+	/**
+	 * @desc an element as DeepParserDec maps it: without attributes, the text only if there are no child elements
+	 */
+	bool XMLStreamDecoder::decodeElement(const Token& begin) {
+		if(tokenizer.depth() > MAX_NESTING) {
+			return false;
+		}
+
+		size_t name_length;
+		const char* name = longName(begin.text, begin.length, name_length);
+		Token token = tokenizer.next();
+
+		writer.beginElement(name, name_length);
+		while(token.type == XMLTokenizer::TOKEN_ATTRIBUTE) {
+			token = tokenizer.next();
+		}
+		if(token.type == XMLTokenizer::TOKEN_ELEMENT_END) {
+			writer.endElement();
+			return true;
+		}
+		if(token.type != XMLTokenizer::TOKEN_CONTENT_BEGIN) {
+			return false;
+		}
+
+		const char* text = NULL;
+		size_t text_length = 0;
+		bool has_children = false;
+
+		for(token = tokenizer.next(); token.type != XMLTokenizer::TOKEN_ELEMENT_END; token = tokenizer.next()) {
+			if(token.type == XMLTokenizer::TOKEN_ELEMENT_BEGIN) {
+				has_children = true;
+				if(!decodeElement(token)) {
+					return false;
+				}
+			} else if(token.type == XMLTokenizer::TOKEN_TEXT) {
+				if(text == NULL) {
+					text = token.text;
+					text_length = token.length;
+				}
+			} else {
+				return false;
+			}
+		}
+		if(text != NULL && !has_children) {
+			writer.text(text, text_length);
+		}
+		writer.endElement();
+		return true;
+	}
+}
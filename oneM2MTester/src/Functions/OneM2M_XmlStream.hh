@@ -0,0 +1,164 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_XmlStream.hh
+//  Description:        Streaming XML tokenizer, writer and long/short name transcoders of the
+//                      oneM2M dual face mapping, used instead of DeepParser and DeepParserDec
+//  Rev:                R2I
+
+#ifndef ONEM2M_XMLSTREAM_HH
+#define ONEM2M_XMLSTREAM_HH
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+
+namespace OneM2M__DualFaceMapping {
+
+	/**
+	 * @desc Pull tokenizer over a NUL terminated XML text. It only accepts what tinyxml2 parses into a
+	 *       document of elements, attributes and text in a well defined way: an optional declaration in
+	 *       front of a single root element, no comments, CDATA sections, DOCTYPEs, carriage returns or
+	 *       character references. Like tinyxml2, whitespace only text between tags is skipped.
+	 *       Anything else ends the token stream with TOKEN_ERROR.
+	 */
+	class XMLTokenizer {
+	public:
+		enum TokenType {
+			TOKEN_ERROR, TOKEN_END, TOKEN_DECLARATION,
+			TOKEN_ELEMENT_BEGIN, // start tag name, followed by its attributes and TOKEN_CONTENT_BEGIN or TOKEN_ELEMENT_END
+			TOKEN_ATTRIBUTE, TOKEN_CONTENT_BEGIN, TOKEN_ELEMENT_END, TOKEN_TEXT
+		};
+
+		struct Token {
+			TokenType type;
+			const char* text;   // element or attribute name, or the text
+			size_t length;
+			const char* value;  // attribute value without the quotes
+			size_t value_length;
+		};
+
+		explicit XMLTokenizer(const char* input);
+
+		Token next();
+
+		// number of open elements
+		size_t depth() const { return open_elements.size(); }
+
+	private:
+		struct Name {
+			const char* text;
+			size_t length;
+		};
+
+		bool readStartTag(Token& token);
+		bool readEndTag(Token& token);
+		bool readAttribute(Token& token);
+		bool readText(Token& token);
+		bool readName(Name& name);
+		bool checkEntities(const char* text, size_t length) const;
+		void closeElement();
+		void skipWhitespace();
+		Token fail();
+
+		const char* pos;
+		int expect;
+		std::vector<Name> open_elements;
+		std::vector<Name> attributes; // of the start tag being read, to find duplicates like tinyxml2 does
+	};
+
+	/**
+	 * @desc Appends XML with exactly the layout of tinyxml2::XMLPrinter (4 space indentation, the text of
+	 *       an element on the line of its tags), so streamed output looks like the output of the DOM parsers.
+	 *       Names are not copied, they have to stay valid until the element is ended.
+	 */
+	class XMLStreamWriter {
+	public:
+		explicit XMLStreamWriter(std::string& output);
+
+		// the declaration that XMLDocument::NewDeclaration() creates
+		void declaration();
+		void beginElement(const char* name, size_t length);
+		void endElement();
+
+		// Values are given as they appear in an XML text: entities are decoded and the result is
+		// escaped again the way XMLPrinter does it
+		void attribute(const char* name, size_t length, const char* value, size_t value_length);
+		void text(const char* value, size_t length);
+
+	private:
+		struct Name {
+			const char* text;
+			size_t length;
+		};
+
+		void seal();
+		void indent(size_t level);
+		void appendEscaped(const char* value, size_t length, bool attribute_value);
+
+		std::string& out;
+		std::vector<Name> open_elements;
+		bool just_opened; // the start tag of the innermost element is not closed with '>' yet
+		bool has_text;    // the innermost element got text
+		bool first;
+	};
+
+	/**
+	 * @desc Single pass long-to-short transcoder for outgoing XML primitive content, producing the same
+	 *       document as the XML branch of f__serialization__Enc with DeepParser. Input that the DOM based
+	 *       encoder does not handle in a well defined way is rejected so the caller can use it instead.
+	 */
+	class XMLStreamEncoder {
+	public:
+		XMLStreamEncoder(const char* source, std::string& output);
+
+		// returns false if the DOM based encoder has to be used for this message
+		bool encode();
+
+	private:
+		typedef XMLTokenizer::Token Token;
+
+		bool encodeResource(const Token& begin);
+		bool encodeElement(const Token& begin);
+		const char* shortName(const char* name, size_t length, size_t& short_length);
+
+		XMLTokenizer tokenizer;
+		XMLStreamWriter writer;
+		const char* resource_name_short; // short name of the resourceName attribute
+	};
+
+	/**
+	 * @desc Single pass short-to-long transcoder for received XML primitive content, producing the same
+	 *       document as the XML branch of f__primitiveContent__Dec with DeepParserDec. Input that the DOM
+	 *       based decoder does not handle in a well defined way is rejected so the caller can use it instead.
+	 */
+	class XMLStreamDecoder {
+	public:
+		XMLStreamDecoder(const char* source, std::string& output);
+
+		// returns false if the DOM based decoder has to be used for this message
+		bool decode();
+
+	private:
+		typedef XMLTokenizer::Token Token;
+
+		bool decodeElement(const Token& begin);
+		const char* longName(const char* name, size_t length, size_t& long_length);
+
+		XMLTokenizer tokenizer;
+		XMLStreamWriter writer;
+	};
+}
+
+#endif
@@ -26,25 +26,24 @@
 #include <iostream>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <algorithm>
 #include <functional>
 #include "json.h"
-#include "HashMap.h"
 #include "tinyxml2.h"
 #include "json-forwards.h"
 #include "External_function.hh"
+#include "OneM2M_JsonStream.hh"
+#include "OneM2M_MappingArena.hh"
+#include "OneM2M_NameMapping.hh"
+#include "OneM2M_PayloadLog.hh"
+#include "OneM2M_XmlStream.hh"
 #include "OneM2M_DualFaceMapping.hh"
 
 using namespace tinyxml2;
 using namespace Json;
 using namespace std;
 
-struct MyKeyHash {
-	unsigned long operator()(const std::string& k) const {
-	  	return k.length() % 10;
-	}
-};
-
 namespace OneM2M__DualFaceMapping {
 
 	int connectionID = 0;
@@ -54,10 +53,6 @@ namespace OneM2M__DualFaceMapping {
 				 OPERATION_MONITOR_LIST("operationMonitor_list"), AGGREGATED_RESPONSE("aggregatedResponse"),
 				 RESPONSE_PRIMITIVE_LIST("responsePrimitive_list"), REQUEST_IDENTIFIER("rqi"), REQUEST_PRIMITIVE("rqp");
 
-	int array_size = 20480; //initial array for storing resource name
-	HashMap<std::string, std::string, 50, MyKeyHash> hmap_l2s; //long-2-short name mapping
-	HashMap<std::string, std::string, 50, MyKeyHash> hmap_s2l; //short-2-long name mapping
-
 	const char* XML_NAMESPACE 	= "http://www.onem2m.org/xml/protocols"; // to be replace by PIXIT value
 	const char* NAMESPACE_TAG	= "xmlns:m2m"; // to be added in constant module
 	const char* RESOURCE_NAME	= "resourceName";
@@ -83,17 +78,27 @@ namespace OneM2M__DualFaceMapping {
 	 */
 	CHARSTRING f__upper2lower(const CHARSTRING& p__string){
 		const char* tmp_str = (const char*)p__string;
-		std::string s(tmp_str);
+		size_t length = p__string.lengthof();
+		size_t first = 0;
 
-		for(unsigned int i = 0; i < s.length(); i++){
+		while(first < length && !(tmp_str[first] >= 'A' && tmp_str[first] <= 'Z')){
+			first++;
+		}
+
+		// binding and serialization names are mostly given in lowercase, share the value then
+		if(first == length){
+			return p__string;
+		}
+
+		std::string s(tmp_str, length);
+
+		for(size_t i = first; i < length; i++){
 			if(s[i] >= 'A' && s[i] <= 'Z'){
 				s[i] = char(((int)s[i])+32);
 		 	}
 		}
 
-		CHARSTRING s_str(s.c_str());
-
-		return s_str;
+		return CHARSTRING((int)length, s.data());
 	}
 
 	CHARSTRING f__extract__from__string(const CHARSTRING& p__string) {
@@ -130,15 +135,25 @@ namespace OneM2M__DualFaceMapping {
 
 		if("json" == serial_str){
 
+			// single pass encoding, the Json::Value based parsers below are only needed for the special cases
+			if(OneM2M__Constants::tsp__jsonStreaming) {
+				std::string& stream_str = MappingArena::instance().outputBuffer();
+				JSONStreamEncoder stream_encoder(p_body, stream_str, JSON_compact_serialization());
+
+				if(stream_encoder.encode(p__forcedFields)) {
+					return CHARSTRING(stream_str.length(), stream_str.data());
+				}
+				TTCN_Logger::log(TTCN_DEBUG, "Primitive content not streamable, using the JsonCPP based encoder");
+			}
+
 			Value jsonDoc(objectValue);
 			Value jsonRoot(objectValue);
-			Reader jsonReader;
+			Reader& jsonReader = MappingArena::instance().jsonReader();
 
 			Value rootTag;
 			Value elemName;			
 			Value elemObj(objectValue);
 			Value subelemObj(objectValue);
-			Value grandelemObj(objectValue);
 
 			Value jsonRootClone(objectValue);
 			Value jsonObjClone(objectValue);
@@ -147,7 +162,7 @@ namespace OneM2M__DualFaceMapping {
 			std::string name_short;
 			std::string parent_tag = "";
 
-			bool parsingSuccessful = jsonReader.parse(p_body, jsonRoot, false);
+			bool parsingSuccessful = jsonReader.parse(p_body, p_body + strlen(p_body), jsonRoot, false);
 
 			if ( !parsingSuccessful ) {
 				TTCN_Logger::log(TTCN_DEBUG, "JsonCPP API parsing error!");
@@ -156,18 +171,17 @@ namespace OneM2M__DualFaceMapping {
 
 			// This function has been temporary added to encode the operationMonitor_list case
 			if(jsonRoot.isObject()){
-				for (Value::iterator iter = jsonRoot.begin(); iter != jsonRoot.end(); ++iter) {
-					Value subElemName = iter.key();
-					Value subElemObj = jsonRoot.get(subElemName.asString(), "");
+				for (Value::const_iterator iter = jsonRoot.begin(); iter != jsonRoot.end(); ++iter) {
+					const Value& subElemObj = *iter;
 
-					for (Value::iterator iter = subElemObj.begin(); iter != subElemObj.end(); ++iter) {
+					for (Value::const_iterator iter = subElemObj.begin(); iter != subElemObj.end(); ++iter) {
 						Value subElemName2 = iter.key();
 
 						// 1. Subscription
 						if(subElemName2 == "eventNotificationCriteria") {
-							Value subElemObj2 = subElemObj.get(subElemName2.asString(), "");
+							const Value& subElemObj2 = *iter;
 
-							for (Value::iterator iter = subElemObj2.begin(); iter != subElemObj2.end(); ++iter) {
+							for (Value::const_iterator iter = subElemObj2.begin(); iter != subElemObj2.end(); ++iter) {
 								Value subElemName3 = iter.key();
 								if(subElemName3 == "operationMonitor_list") {
 									encoded_message = sub_JSON_Enc_Parser(p__source);
@@ -178,12 +192,12 @@ namespace OneM2M__DualFaceMapping {
 
 						// 2. AccessControlPolicy, TC_CSE_SEC_ACP_CRE_004
 						if(subElemName2 == "privileges" || subElemName2 == "selfPrivileges") {
-							Value subElemObj2 = subElemObj.get(subElemName2.asString(), "");
+							const Value& subElemObj2 = *iter;
 
-							for (Value::iterator iter = subElemObj2.begin(); iter != subElemObj2.end(); ++iter) {
+							for (Value::const_iterator iter = subElemObj2.begin(); iter != subElemObj2.end(); ++iter) {
 								Value subElemName3 = iter.key();
 								if(subElemName3 == "accessControlRule_list") {
-									Value subElemName4 = subElemObj2.get(subElemName3.asString(), "");
+									const Value& subElemName4 = *iter;
 
 									// if pvs or pv accessControlRule are emtpy array
 									if(subElemName4.empty()) {
@@ -200,9 +214,10 @@ namespace OneM2M__DualFaceMapping {
 			// Following procedures are the original functions for the onem2m resource encoding
 			if(jsonRoot.isObject()){  
 
+				// jsonRoot is not used after this loop, its members are moved into the clones
 				for (Value::iterator iter = jsonRoot.begin(); iter != jsonRoot.end(); ++iter) {
 					elemName = iter.key();
-					elemObj = jsonRoot.get(elemName.asString(), "");
+					Value& memberObj = *iter;
 			
 					name_short = getShortName(elemName.asString());
 					if(name_short == ""){
@@ -211,16 +226,15 @@ namespace OneM2M__DualFaceMapping {
 
 					parent_tag = name_short;
 					
-					if(elemObj.isArray()){
-						for(unsigned int index = 0; index < elemObj.size(); index++){
-							grandelemObj = elemObj[index];
-							jsonObjClone[parent_tag.c_str()] = grandelemObj;
+					if(memberObj.isArray()){
+						if(memberObj.size() != 0) { // only the last element is kept
+							jsonObjClone[parent_tag.c_str()].swap(memberObj[memberObj.size() - 1]);
 						}
-					}else if(!elemObj.isObject() && !elemObj.isArray()){ 
-						jsonRootClone[name_short.c_str()] = elemObj;
-					}else if(elemObj.isObject()){ // go deep parsing child objects
-						jsonObjClone[parent_tag.c_str()] = elemObj;
-						jsonRootClone = JSONDeepParser(jsonObjClone, jsonRootClone, jsonRootClone);
+					}else if(!memberObj.isObject() && !memberObj.isArray()){ 
+						jsonRootClone[name_short.c_str()].swap(memberObj);
+					}else if(memberObj.isObject()){ // go deep parsing child objects
+						jsonObjClone[parent_tag.c_str()].swap(memberObj);
+						JSONDeepParser(jsonObjClone, jsonRootClone);
 					}
 										
 				}
@@ -320,21 +334,19 @@ namespace OneM2M__DualFaceMapping {
 				}
 			}
 
-			StyledWriter writer;
-			std::string json_str = writer.write(jsonRootClone);
-
-			// std::replace(json_str.begin(), json_str.end(), '\\\\', '\0');
-			// json_str.erase(std::remove(json_str.begin(), json_str.end(), '\n'), json_str.end());
-			// json_str.erase(std::remove(json_str.begin(), json_str.end(), ' '), json_str.end());
-
-			CHARSTRING temp_cs(json_str.c_str());
-			encoded_message = temp_cs;
-
-			return encoded_message;
+			return JSON_wire_string(jsonRootClone);
 
 		}else if("xml" == serial_str){
 
-			XMLDocument xmlDoc;
+			// single pass encoding, the tinyxml2 based parser below is only needed for the special cases
+			std::string& stream_str = MappingArena::instance().outputBuffer();
+			XMLStreamEncoder stream_encoder(p_body, stream_str);
+			if(stream_encoder.encode()) {
+				return CHARSTRING(stream_str.length(), stream_str.data());
+			}
+			TTCN_Logger::log(TTCN_DEBUG, "Primitive content not streamable, using the tinyxml2 based encoder");
+
+			XMLDocument& xmlDoc = MappingArena::instance().sourceDocument(p__source.lengthof());
 			xmlDoc.Parse(p_body);
 
 			XMLNode* pRoot = xmlDoc.FirstChild();
@@ -348,7 +360,7 @@ namespace OneM2M__DualFaceMapping {
 
 			const char* name_el;
 			std::string name_short;
-			XMLDocument xmlDoclone;
+			XMLDocument& xmlDoclone = MappingArena::instance().cloneDocument(p__source.lengthof());
 
 			XMLElement* pRootElem = pRoot->ToElement();
 			name_el = pRootElem->Name();
@@ -393,7 +405,7 @@ namespace OneM2M__DualFaceMapping {
 
 			if(pRootElem->Attribute(RESOURCE_NAME)){ 
 				std::string val_resourceName = pRootElem->Attribute(RESOURCE_NAME);
-				pRootClone->SetAttribute((getShortName(RESOURCE_NAME).c_str()), val_resourceName.c_str());
+				pRootClone->SetAttribute(getShortName(RESOURCE_NAME), val_resourceName.c_str());
 			}				
 
 			xmlDoclone.InsertEndChild(pRootClone);
@@ -412,114 +424,40 @@ namespace OneM2M__DualFaceMapping {
 		return "";
 	}
 
-	//initial mapping functions
+	/**
+	 * @desc make sure the process-wide long/short name mapping tables are available,
+	 *       the table files are only read on the first call (see NameMappingRegistry)
+	 */
 	bool initial_mapping(){
-
-		const char* file_path_l2s = "";
-		const char* file_path_s2l = "";
-
-		file_path_l2s 	= "../oneM2MTester/Lib/ResourceMappingTable/long_to_short_mapping.txt";
-		file_path_s2l	= "../oneM2MTester/Lib/ResourceMappingTable/short_to_long_mapping.txt";
-
-		const std::string LONG2SHORT	= "L2S";
-		const std::string SHORT2LONG	= "S2L";
-		bool l2s_flag = long_to_short_name_mapping(file_path_l2s, LONG2SHORT);
-		bool s2l_flag = long_to_short_name_mapping(file_path_s2l, SHORT2LONG);
-		if(l2s_flag && s2l_flag)
-			return true;
-
-		return false;
+		return NameMappingRegistry::instance().ensureLoaded();
 	}
 
-	//read mapping information from a text file and add the mapping info into a hash map
-	bool long_to_short_name_mapping(const char* file_path, const std::string mapping_tag){
-
-		bool flag = false;
-		int pos = 0;
-		size_t pos_1 = 0;
-		size_t pos_2 = 0;
-
-		char* map_array = new char[array_size];
-
-		std::string map_str 	= "";
-		std::string str_temp 	= "";
-		std::string source_str 	= "";
-		std::string dest_str 	= "";
-
-		std::vector<std::string> vector_map_list;
-		std::vector<std::string> vector_l2s;
-
-		ifstream fin(file_path);
-
-		if(fin.is_open()){
-			pos =0;
-			while(!fin.eof() && pos < array_size){
-				fin.get(map_array[pos]);
-				pos++;
-			}
-		
-			map_array[pos-1] = '\0';
-
-			for(int i = 0; map_array[i] != '\0'; i++)
-				map_str = map_str + map_array[i];
-
-			if(map_str != ""){
-
-				vector_map_list = split(map_str, '\n');
+	/**
+	 * @desc get long/short name from the mapping table without copying it
+	 * return the mapped name, or "" if the name is not mapped
+     */
+	const char* getShortName(const char* long_name){
+		const char* short_name = NameMappingRegistry::instance().getShortName(long_name, strlen(long_name));
 
-				for(unsigned int i = 0;i < vector_map_list.size(); i++){
+		return short_name != NULL ? short_name : "";
+	}
 
-					pos_2 = map_str.find('\n', pos_1);
-					vector_map_list[i] = map_str.substr(pos_1, (pos_2-pos_1));
+	const char* getShortName(const std::string& long_name){
+		const char* short_name = NameMappingRegistry::instance().getShortName(long_name.data(), long_name.length());
 
-					str_temp = vector_map_list[i];
-					vector_l2s = split(str_temp, '=');
-					for(unsigned int j = 0; j < vector_l2s.size(); j++){
-						if(0 == j && vector_l2s[j] != "")
-							source_str = vector_l2s[j];
-						if(j > 0 && vector_l2s[j] != "")
-							dest_str = vector_l2s[j];
-					}
-					
-					if(source_str != "" && dest_str != ""){
-						if("L2S" == mapping_tag){
-							hmap_l2s.put(source_str, dest_str);
-							flag = true;
-						}else if("S2L" == mapping_tag){
-							hmap_s2l.put(source_str, dest_str);
-							flag = true;
-						}else
-							return false;
-					}else
-						return false;
-					pos_1 = pos_2 + 1;
-				}
-			}else
-				return false;
-		}else
-			return false;
-		return flag;
+		return short_name != NULL ? short_name : "";
 	}
 
-	/**
-	 * @desc get long/short name from hash mapping table
-     */
-	std::string getShortName(std::string long_name){ 
-		std::string short_name = "";
-		bool isOk =  hmap_l2s.get(long_name, short_name);
+	const char* getLongName(const char* short_name){
+		const char* long_name = NameMappingRegistry::instance().getLongName(short_name, strlen(short_name));
 
-		if(isOk)
-			return short_name;
-		return "";
+		return long_name != NULL ? long_name : "";
 	}
-	
-	std::string getLongName(std::string short_name){
-		std::string long_name = "";
-		bool isOk =  hmap_s2l.get(short_name, long_name);
 
-		if(isOk)
-			return long_name;
-		return "";
+	const char* getLongName(const std::string& short_name){
+		const char* long_name = NameMappingRegistry::instance().getLongName(short_name.data(), short_name.length());
+
+		return long_name != NULL ? long_name : "";
 	}
 
 	/**
@@ -714,7 +652,7 @@ namespace OneM2M__DualFaceMapping {
 
 		if( pSrcElem->Attribute(RESOURCE_NAME) ){ 
 			val_resourceName = pSrcElem->Attribute(RESOURCE_NAME);
-			pSrcElemClone->SetAttribute((getShortName(RESOURCE_NAME).c_str()), val_resourceName.c_str());
+			pSrcElemClone->SetAttribute(getShortName(RESOURCE_NAME), val_resourceName.c_str());
 		}
 
 		pDestParent->InsertEndChild(pSrcElemClone);
@@ -770,30 +708,89 @@ namespace OneM2M__DualFaceMapping {
 		}
 	}
 
+	/**
+	 * @desc For the arrays of a nested object, JSONDeepParser and JSONDeepParserDec used to store the array
+	 *       being built, or the reused subObjClone holding it, into elemObjClone after every element. Only the
+	 *       last of these stores is visible, together with the subObjClone entry of the last element that set
+	 *       it. ArraySnapshots records which store came last and does it once when the array is complete,
+	 *       moving the array instead of copying it where it is not needed any more.
+	 */
+	class ArraySnapshots {
+	public:
+		ArraySnapshots() : last(NONE), sub_object_size(0) {}
+
+		// elemObjClone[parent] = array
+		void setArray() {
+			last = ARRAY;
+		}
+
+		// subObjClone[name] = array; elemObjClone[parent] = subObjClone
+		void setSubObject(const Json::Value& array) {
+			last = SUB_OBJECT;
+			sub_object_size = array.size();
+		}
+
+		// elemObjClone[parent] was assigned directly
+		void setOther() {
+			last = NONE;
+		}
+
+		void store(Json::Value& array, Json::Value& sub_obj_clone, const char* name, Json::Value& elem_obj_clone, const char* parent) {
+			if(sub_object_size > 0) {
+				Json::Value& sub_array = sub_obj_clone[name];
+
+				if(last == ARRAY) { // the array itself goes to elemObjClone, subObjClone gets its first elements
+					Json::Value prefix(Json::arrayValue);
+
+					for(unsigned int i = 0; i < sub_object_size; i++) {
+						prefix.append(array[i]);
+					}
+					sub_array.swap(prefix);
+				} else {
+					array.resize(sub_object_size);
+					sub_array.swap(array);
+				}
+			}
+			if(last == ARRAY) {
+				elem_obj_clone[parent].swap(array);
+			} else if(last == SUB_OBJECT) {
+				elem_obj_clone[parent] = sub_obj_clone; // subObjClone is reused for the next arrays
+			}
+		}
+
+	private:
+		enum { NONE, ARRAY, SUB_OBJECT } last;
+		unsigned int sub_object_size; // size of the array when subObjClone was last set
+	};
+
 	/**
 	 * @jsonSrc: json root element that is parsing
-     * @jsonCurrent: input a jsonCurrent
-	 * return a jsonParent included the encode json data
+	 * @jsonObjClone: node the encoded members are added to, in place
 	 */
-	Json::Value JSONDeepParser(Json::Value jsonSrc, Json::Value jsonObjClone, Json::Value jsonTarget){
+	void JSONDeepParser(const Json::Value& jsonSrc, Json::Value& jsonObjClone){
 	
 		Value elemName;
-		Value elemObj(objectValue);
-		Value subelemObj(objectValue);
 		Value subObjClone(objectValue);
 		Value elemObjClone(objectValue);
-		Value grandelemObj(objectValue);
-		Value tempObj;
 		Value tempObjClone;
 
 		std::string parent_tag = "";
 		std::string root_tag = "";
 		std::string name_short = "";
 
-		for (Value::iterator iter = jsonSrc.begin(); iter != jsonSrc.end(); iter++) {
+		// elemObjClone is reused for every object member, only the last one can take it over without a copy
+		unsigned int objects_left = 0;
+
+		for (Value::const_iterator iter = jsonSrc.begin(); iter != jsonSrc.end(); iter++) {
+			if((*iter).isObject()) {
+				objects_left++;
+			}
+		}
+
+		for (Value::const_iterator iter = jsonSrc.begin(); iter != jsonSrc.end(); iter++) {
 
 			elemName = iter.key();
-			elemObj = jsonSrc.get(elemName.asString(), "");
+			const Value& elemObj = *iter;
 
 			name_short = getShortName(elemName.asString());
 
@@ -812,12 +809,12 @@ namespace OneM2M__DualFaceMapping {
 
 				root_tag = name_short;
 
-				elemObjClone = JSONDeepParser(elemObj, elemObjClone, jsonObjClone);
+				JSONDeepParser(elemObj, elemObjClone);
 
-				for (Value::iterator iter = elemObj.begin(); iter != elemObj.end(); ++iter) {
+				for (Value::const_iterator iter = elemObj.begin(); iter != elemObj.end(); ++iter) {
 
 					elemName = iter.key();
-					subelemObj = elemObj.get(elemName.asString(), "");
+					const Value& subelemObj = *iter;
 
 					name_short = getShortName(elemName.asString());
 
@@ -837,11 +834,11 @@ namespace OneM2M__DualFaceMapping {
 
 					if(subelemObj.isObject()){
 
-						for (Value::iterator iter = subelemObj.begin(); iter != subelemObj.end(); ++iter) {
+						for (Value::const_iterator iter = subelemObj.begin(); iter != subelemObj.end(); ++iter) {
 
 							elemName = iter.key();
 
-							grandelemObj = subelemObj.get(elemName.asString(), "");
+							const Value& grandelemObj = *iter;
 
 							name_short = getShortName(elemName.asString());
 
@@ -857,33 +854,35 @@ namespace OneM2M__DualFaceMapping {
 
 							if(grandelemObj.isArray()){
 								Value elemArrayObj(arrayValue);
+								ArraySnapshots snapshots;
 
 								for(unsigned int index = 0; index < grandelemObj.size(); index++){
-									tempObj = grandelemObj[index];
+									const Value& tempObj = grandelemObj[index];
 
 									if(tempObj.isString()){
 										if(flag_1){
 											elemObjClone[parent_tag.c_str()] = tempObj.asString();
+											snapshots.setOther();
 										}else{
 											elemArrayObj.append(tempObj.asString());
-											elemObjClone[parent_tag.c_str()] = elemArrayObj;
+											snapshots.setArray();
 										}
 									}else if(tempObj.isBool()){
 										elemArrayObj.append(tempObj.asBool());
-										elemObjClone[parent_tag.c_str()] = elemArrayObj;
+										snapshots.setArray();
 									}else if(tempObj.isDouble()){
 										elemArrayObj.append(tempObj.asDouble());
-										elemObjClone[parent_tag.c_str()] = elemArrayObj;
+										snapshots.setArray();
 									}else if(tempObj.isInt64()){
 										elemArrayObj.append(tempObj.asInt64());
-										elemObjClone[parent_tag.c_str()] = elemArrayObj;
+										snapshots.setArray();
 									}else if(tempObj.isObject()){
-										tempObjClone = JSONDeepParser(tempObj, tempObjClone, subObjClone);
+										JSONDeepParser(tempObj, tempObjClone);
 										elemArrayObj.append(tempObjClone);
-										subObjClone[name_short.c_str()] = elemArrayObj;
-										elemObjClone[parent_tag.c_str()] = subObjClone;
+										snapshots.setSubObject(elemArrayObj);
 									}
 								}
+								snapshots.store(elemArrayObj, subObjClone, name_short.c_str(), elemObjClone, parent_tag.c_str());
 							}
 						}
 					}else if(subelemObj.isArray()){
@@ -891,7 +890,7 @@ namespace OneM2M__DualFaceMapping {
 
 						if(subelemObj.size() != 0) {
 							for(unsigned int index = 0; index < subelemObj.size(); index++){
-								tempObj = subelemObj[index];
+								const Value& tempObj = subelemObj[index];
 
 								if(tempObj.isString()){
 									elemArrayObj.append(tempObj.asString());
@@ -902,15 +901,19 @@ namespace OneM2M__DualFaceMapping {
 								}else if(tempObj.isInt64()){
 									elemArrayObj.append(tempObj.asInt64());
 								}else if(tempObj.isObject()){
-									tempObjClone = JSONDeepParser(tempObj, tempObjClone, subObjClone);
+									JSONDeepParser(tempObj, tempObjClone);
 									elemArrayObj.append(tempObjClone);
 								}
 							}
-							elemObjClone[parent_tag.c_str()] = elemArrayObj;
+							elemObjClone[parent_tag.c_str()].swap(elemArrayObj);
 						}
 					}
 				}
-				jsonObjClone[root_tag.c_str()] = elemObjClone;
+				if(--objects_left == 0) {
+					jsonObjClone[root_tag.c_str()].swap(elemObjClone);
+				} else {
+					jsonObjClone[root_tag.c_str()] = elemObjClone;
+				}
 
 			} else if(elemObj.isString()) {
 				if(	"op" 	== name_short   ||  "ty" 	== name_short   ||
@@ -930,14 +933,14 @@ namespace OneM2M__DualFaceMapping {
 
 					if(elemObj.size() != 0) {
 						for(unsigned int index = 0; index < elemObj.size(); index++){
-							tempObj = elemObj[index];
+							const Value& tempObj = elemObj[index];
 
 							if(tempObj.isObject()){
-								tempObjClone = JSONDeepParser(tempObj, tempObjClone, subObjClone);
+								JSONDeepParser(tempObj, tempObjClone);
 								elemArrayObj.append(tempObjClone);
 							}
 						}
-						jsonObjClone[name_short.c_str()] = elemArrayObj;
+						jsonObjClone[name_short.c_str()].swap(elemArrayObj);
 					}
 				} else { // Handling empty actw testcases
 					if(elemObj.isArray()) {
@@ -950,7 +953,6 @@ namespace OneM2M__DualFaceMapping {
 				}
 			}
 		}
-		return jsonObjClone;
 	}
 
 	/**
@@ -981,12 +983,22 @@ namespace OneM2M__DualFaceMapping {
 
 			if("json" == serial_type){
 
+				// single pass decoding, the Json::Value based parser below is only needed for the special cases
+				if(OneM2M__Constants::tsp__jsonStreaming) {
+					std::string& stream_str = MappingArena::instance().outputBuffer();
+					JSONStreamDecoder stream_decoder(p_body, stream_str);
+					if(stream_decoder.decode()) {
+						log_payload("Pretty print of DECODED JSON message", stream_str);
+						return CHARSTRING(stream_str.length(), stream_str.data());
+					}
+					TTCN_Logger::log(TTCN_DEBUG, "Primitive content not streamable, using the JsonCPP based decoder");
+				}
+
 				Value jsonDoc(objectValue);
 				Value jsonRoot(objectValue);
-				Reader jsonReader;
+				Reader& jsonReader = MappingArena::instance().jsonReader();
 				Value rootTag;
 				Value elemName;
-				Value elemObj(objectValue);
 				Value subelemObj(objectValue);
 				Value grandelemObj(objectValue);
 
@@ -998,21 +1010,22 @@ namespace OneM2M__DualFaceMapping {
 				std::string name_long;
 				std::string parent_tag = "";
 
-				bool parsingSuccessful = jsonReader.parse(p_body, jsonRoot, false);
+				bool parsingSuccessful = jsonReader.parse(p_body, p_body + strlen(p_body), jsonRoot, false);
 
 				if ( !parsingSuccessful ) {
 					TTCN_Logger::log(TTCN_DEBUG, "JsonCPP API parsing error!");
 					return "JsonCPP API parsing error!";
 				}
 
-				TTCN_Logger::log(TTCN_DEBUG, "[Decoding] Read JSON document for decoding:\n%s", jsonRoot.toStyledString().c_str());
+				log_payload("[Decoding] Read JSON document for decoding", jsonRoot);
 
+				// jsonRoot is not used after this point, its members are moved into the clones
 				if(jsonRoot.isObject()){
 
 					for (Value::iterator iter = jsonRoot.begin(); iter != jsonRoot.end(); ++iter) {
 
 						elemName = iter.key();
-						elemObj = jsonRoot.get(elemName.asString(), "");
+						Value& memberObj = *iter;
 
 						name_long = getLongName(elemName.asString());
 
@@ -1022,48 +1035,44 @@ namespace OneM2M__DualFaceMapping {
 
 						parent_tag = name_long;
 
-						if(elemObj.isArray()){
+						if(memberObj.isArray()){
 							if (parent_tag == "uRIList") { // This branch is defined for the Discovery testcases
 
-								if(elemObj.size() != 0) {
-									for(unsigned int index = 0; index < elemObj.size(); index++){
-										Value subElemObjRoot = elemObj[index];
-										jsonRootClone[parent_tag.c_str()].append(subElemObjRoot);
+								if(memberObj.size() != 0) {
+									for(unsigned int index = 0; index < memberObj.size(); index++){
+										jsonRootClone[parent_tag.c_str()].append(Value()).swap(memberObj[index]);
 									}
 								} else {
 									jsonRootClone[parent_tag.c_str()] = Json::Value(Json::arrayValue);
 								}
 							}
-						}else if(!elemObj.isObject() && !elemObj.isArray()){
-							jsonObjClone[name_long.c_str()] = elemObj;
-						}else if(elemObj.isObject()){
+						}else if(!memberObj.isObject() && !memberObj.isArray()){
+							jsonObjClone[name_long.c_str()].swap(memberObj);
+						}else if(memberObj.isObject()){
 
 							// This branch is defined for the group and fanout
 							if (parent_tag == "aggregatedResponse") {
 
-								Value responseArray(objectValue);
-								responseArray = elemObj["m2m:rsp"];
+								Value& responseArray = memberObj["m2m:rsp"];
 
 								for(unsigned int index = 0; index < responseArray.size(); index++){
 									Value subElemObjRoot;
-									Value subElemObj(objectValue);
-									subElemObj = responseArray[index]; // Extracting the one of Element from JSON Array.
+									Value& subElemObj = responseArray[index]; // Extracting the one of Element from JSON Array.
 
 									subElemObj[REQUEST_IDENTIFIER] = "temp_requestIdentifier"; // rqi is defined to meet the responsePrimitive format
 
-									subElemObjRoot = JSONDeepParserDec(subElemObj, subElemObjRoot, jsonRootClone);
-									jsonRootClone[AGGREGATED_RESPONSE][RESPONSE_PRIMITIVE_LIST].append(subElemObjRoot);
+									JSONDeepParserDec(subElemObj, subElemObjRoot);
+									jsonRootClone[AGGREGATED_RESPONSE][RESPONSE_PRIMITIVE_LIST].append(Value()).swap(subElemObjRoot);
 								}
 							} else {
-								jsonObjClone[parent_tag.c_str()] = elemObj;
-								jsonRootClone = JSONDeepParserDec(jsonObjClone, jsonRootClone, jsonRootClone);
+								jsonObjClone[parent_tag.c_str()].swap(memberObj);
+								JSONDeepParserDec(jsonObjClone, jsonRootClone);
 							}
 						}
 					}
 				} else if (jsonRoot.isArray()){
-					for(unsigned int index = 0; index < jsonRoot.size(); index++){
-						elemObj = jsonRoot[index];
-						jsonObjClone = elemObj;
+					if(jsonRoot.size() != 0) { // only the last element is kept
+						jsonObjClone.swap(jsonRoot[jsonRoot.size() - 1]);
 					}
 				}
 
@@ -1212,18 +1221,26 @@ namespace OneM2M__DualFaceMapping {
 					}
 				}
 
-				TTCN_Logger::log(TTCN_DEBUG, "Pretty print of DECODED JSON message:\n%s", jsonRootClone.toStyledString().c_str());
-
 				StyledWriter writer;
 				std::string json_str = writer.write(jsonRootClone);
 
+				log_payload("Pretty print of DECODED JSON message", json_str);
+
 				CHARSTRING temp_cs(json_str.c_str());
 
 				encoded_message	= temp_cs;
 
 			} else if("xml" == serial_type){
 
-				XMLDocument xmlDoc;
+				// single pass decoding, the tinyxml2 based parser below is only needed for the special cases
+				std::string& stream_str = MappingArena::instance().outputBuffer();
+				XMLStreamDecoder stream_decoder(p_body, stream_str);
+				if(stream_decoder.decode()) {
+					return CHARSTRING(stream_str.length(), stream_str.data());
+				}
+				TTCN_Logger::log(TTCN_DEBUG, "Primitive content not streamable, using the tinyxml2 based decoder");
+
+				XMLDocument& xmlDoc = MappingArena::instance().sourceDocument(source_str.lengthof());
 				xmlDoc.Parse(p_body);
 				XMLNode* pRoot;
 				XMLDeclaration* pDecl;
@@ -1234,7 +1251,7 @@ namespace OneM2M__DualFaceMapping {
 				XMLElement* pResourceRoot;
 				const char* name_el;
 				std::string name_long;
-				XMLDocument xmlDoclone;
+				XMLDocument& xmlDoclone = MappingArena::instance().cloneDocument(source_str.lengthof());
 				XMLElement* pRootElem;
 				XMLNode* pTemp;
 
@@ -1243,8 +1260,6 @@ namespace OneM2M__DualFaceMapping {
 						pDecl = pTemp->ToDeclaration();
 					}else if(pTemp->ToElement()){
 						pRoot = pTemp->ToElement();
-						XMLPrinter print2;
-						pRoot->Accept(&print2);
 						break;
 					}
 				}
@@ -1276,9 +1291,9 @@ namespace OneM2M__DualFaceMapping {
 						} else
 							pRootClone->SetAttribute(NAMESPACE_TAG, XML_NAMESPACE);
 
-						if(pRootElem->Attribute((getShortName(RESOURCE_NAME).c_str()))){
-							std::string val_resourceName = pRootElem->Attribute((getShortName(RESOURCE_NAME).c_str()));
-							pResourceRoot->SetAttribute( getLongName(getShortName(RESOURCE_NAME)).c_str(), val_resourceName.c_str() );
+						if(pRootElem->Attribute(getShortName(RESOURCE_NAME))){
+							std::string val_resourceName = pRootElem->Attribute(getShortName(RESOURCE_NAME));
+							pResourceRoot->SetAttribute( getLongName(getShortName(RESOURCE_NAME)), val_resourceName.c_str() );
 						}
 
 						pRootClone->InsertEndChild(pResourceRoot);
@@ -1303,32 +1318,36 @@ namespace OneM2M__DualFaceMapping {
 	/**
 	 * @desc decoding json formated short name represented data into long name format 
 	 * @jsonSrc: json root element that is parsing
-     * @jsonCurrent: input a jsonCurrent
-	 * return a jsonParent included the encode json data
+	 * @jsonObjClone: node the decoded members are added to, in place
 	 */
-	Json::Value JSONDeepParserDec(Json::Value jsonSrc, Json::Value jsonObjClone, Json::Value jsonTarget){
+	void JSONDeepParserDec(const Json::Value& jsonSrc, Json::Value& jsonObjClone){
 		
 		Value elemName;
-		Value elemObj(objectValue);
-		Value subelemObj(objectValue);
 		Value subObjClone(objectValue);
 		Value elemObjClone(objectValue);
-		Value grandelemObj(objectValue);
-		Value tempObj;
 		Value tempObjClone;
 	
 		std::string parent_tag = "";
 		std::string root_tag = "";
 		std::string name_long = "";
 
-		Value root_name_element;
+		std::string root_name;
 		bool hasRootTag = false; // key for storing the root tag name
 
-		for (Value::iterator iter = jsonSrc.begin(); iter != jsonSrc.end(); iter++) {
+		// elemObjClone is reused for every object member, only the last one can take it over without a copy
+		unsigned int objects_left = 0;
+
+		for (Value::const_iterator iter = jsonSrc.begin(); iter != jsonSrc.end(); iter++) {
+			if((*iter).isObject()) {
+				objects_left++;
+			}
+		}
+
+		for (Value::const_iterator iter = jsonSrc.begin(); iter != jsonSrc.end(); iter++) {
 			
 			elemName = iter.key();
 			
-			elemObj = jsonSrc.get(elemName.asString(), "");
+			const Value& elemObj = *iter;
 			
 			name_long = getLongName(elemName.asString());
 
@@ -1344,18 +1363,18 @@ namespace OneM2M__DualFaceMapping {
 			// TTCN_Logger::log(TTCN_DEBUG, "**************root*********************\n");
 
 			if(hasRootTag == false) {
-				root_name_element = elemName;
+				root_name = elemName.asString();
 				hasRootTag = true;
 			}
 
 			if(elemObj.isObject()){ 
 				root_tag = name_long;
 
-				elemObjClone = JSONDeepParserDec(elemObj, elemObjClone, jsonObjClone);
+				JSONDeepParserDec(elemObj, elemObjClone);
 				
-				for (Value::iterator iter = elemObj.begin(); iter != elemObj.end(); ++iter) {
+				for (Value::const_iterator iter = elemObj.begin(); iter != elemObj.end(); ++iter) {
 					elemName = iter.key();
-					subelemObj = elemObj.get(elemName.asString(), "");
+					const Value& subelemObj = *iter;
 					name_long = getLongName(elemName.asString());
 
 					if(name_long == ""){
@@ -1366,10 +1385,10 @@ namespace OneM2M__DualFaceMapping {
 
 					if(subelemObj.isObject()){
 
-						for (Value::iterator iter = subelemObj.begin(); iter != subelemObj.end(); ++iter) {
+						for (Value::const_iterator iter = subelemObj.begin(); iter != subelemObj.end(); ++iter) {
 							
 							elemName = iter.key();
-							grandelemObj = subelemObj.get(elemName.asString(), "");
+							const Value& grandelemObj = *iter;
 
 							name_long = getLongName(elemName.asString());
 
@@ -1379,38 +1398,37 @@ namespace OneM2M__DualFaceMapping {
 							
 							if(grandelemObj.isArray()){
 								Value elemArrayObj(arrayValue);
+								ArraySnapshots snapshots;
 
 								for(unsigned int index = 0; index < grandelemObj.size(); index++){
 								
-									Value tempObj = grandelemObj[index];
+									const Value& tempObj = grandelemObj[index];
 																	
 									if(tempObj.isIntegral()){
 										std::string tmp_str((const char*)(int2str(tempObj.asLargestInt())));
 										
 										std::string attr_val = getLongName(tmp_str);
 										elemArrayObj.append(attr_val);
-
-										subObjClone[name_long.c_str()] = elemArrayObj;
-										elemObjClone[parent_tag.c_str()] = subObjClone;
+										snapshots.setSubObject(elemArrayObj);
 									}else if(tempObj.isString()){
 										elemArrayObj.append(tempObj.asString());
-										elemObjClone[parent_tag.c_str()] = elemArrayObj;
+										snapshots.setArray();
 									}else if(tempObj.isBool()){
 										elemArrayObj.append(tempObj.asBool());
-										elemObjClone[parent_tag.c_str()] = elemArrayObj;
+										snapshots.setArray();
 									}else if(tempObj.isDouble()){
 										elemArrayObj.append(tempObj.asDouble());
-										elemObjClone[parent_tag.c_str()] = elemArrayObj;
+										snapshots.setArray();
 									}else if(tempObj.isUInt()){
 										elemArrayObj.append(tempObj.asUInt());
-										elemObjClone[parent_tag.c_str()] = elemArrayObj;
+										snapshots.setArray();
 									}else if(tempObj.isObject()){
-										tempObjClone = JSONDeepParserDec(tempObj, tempObjClone, subObjClone);
+										JSONDeepParserDec(tempObj, tempObjClone);
 										elemArrayObj.append(tempObjClone);
-										subObjClone[name_long.c_str()] = elemArrayObj;
-										elemObjClone[parent_tag.c_str()] = subObjClone;
+										snapshots.setSubObject(elemArrayObj);
 									}
 								}
+								snapshots.store(elemArrayObj, subObjClone, name_long.c_str(), elemObjClone, parent_tag.c_str());
 							}
 						}
 					}else if(subelemObj.isArray()){
@@ -1419,7 +1437,7 @@ namespace OneM2M__DualFaceMapping {
 
 						for(unsigned int index = 0; index < subelemObj.size(); index++){
 
-							tempObj = subelemObj[index];
+							const Value& tempObj = subelemObj[index];
 							
 							if(tempObj.isString()){
 								elemArrayObj.append(tempObj.asString());
@@ -1433,17 +1451,23 @@ namespace OneM2M__DualFaceMapping {
 							}else if(tempObj.isInt64()){
 								elemArrayObj.append(tempObj.asInt64());
 							}else if(tempObj.isObject()){
-								tempObjClone = JSONDeepParserDec(tempObj, tempObjClone, subObjClone);
+								JSONDeepParserDec(tempObj, tempObjClone);
 								elemArrayObj.append(tempObjClone);								
 							} else {
 								TTCN_Logger::log(TTCN_DEBUG, "Unexpected flow");
 							}
-							elemObjClone[parent_tag.c_str()] = elemArrayObj;
+						}
+						if(subelemObj.size() != 0) {
+							elemObjClone[parent_tag.c_str()].swap(elemArrayObj);
 						}
 					}					
 				}
 
-				jsonObjClone[root_tag.c_str()] = elemObjClone;
+				if(--objects_left == 0) {
+					jsonObjClone[root_tag.c_str()].swap(elemObjClone);
+				} else {
+					jsonObjClone[root_tag.c_str()] = elemObjClone;
+				}
 			}else if(elemObj.isString()){
 
 				//Handling responseStatusCode
@@ -1480,23 +1504,23 @@ namespace OneM2M__DualFaceMapping {
 					Value elemArrayObj(arrayValue);
 
 					for(unsigned int index = 0; index < elemObj.size(); index++){
-						tempObj = elemObj[index];
+						const Value& tempObj = elemObj[index];
 
 						if(tempObj.isObject()){
-							tempObjClone = JSONDeepParserDec(tempObj, tempObjClone, subObjClone);
+							JSONDeepParserDec(tempObj, tempObjClone);
 							elemArrayObj.append(tempObjClone);
 						}
 					}
-					jsonObjClone[name_long.c_str()] = elemArrayObj;
+					jsonObjClone[name_long.c_str()].swap(elemArrayObj);
 				} else {
 					jsonObjClone[name_long.c_str()] = elemObj;
 				}
 			}
 		}
 
-		if((root_name_element.asString()).compare(SUBSCRIPTION) == 0) {
+		if(root_name.compare(SUBSCRIPTION) == 0) {
 
-			Value elemObj = jsonObjClone.get(root_name_element.asString(), "");
+			Value elemObj = jsonObjClone.get(root_name, "");
 
 			for (Value::iterator iter = elemObj.begin(); iter != elemObj.end(); iter++) {
 
@@ -1512,7 +1536,7 @@ namespace OneM2M__DualFaceMapping {
 						Value elemKey = iter.key();
 
 						if((elemKey.asString()).compare(OPERATION_MONITOR_LIST) == 0) { // has operationMonitor_list
-							return jsonObjClone;
+							return;
 						} else {
 							Json::Value emptyArray_for_om;
 							emptyArray_for_om.append("int1");
@@ -1524,9 +1548,9 @@ namespace OneM2M__DualFaceMapping {
 			}
 		}
 
-		if((root_name_element.asString()).compare("group_") == 0) {
+		if(root_name.compare("group_") == 0) {
 
-			Value elemObj = jsonObjClone.get(root_name_element.asString(), "");
+			Value elemObj = jsonObjClone.get(root_name, "");
 
 			for (Value::iterator iter = elemObj.begin(); iter != elemObj.end(); iter++) {
 
@@ -1540,7 +1564,6 @@ namespace OneM2M__DualFaceMapping {
 				}
 			}
 		}
-		return jsonObjClone;
 	}
 
 	// Encoding function for triggering request message
@@ -1549,11 +1572,10 @@ namespace OneM2M__DualFaceMapping {
 			TTCN_Logger::log(TTCN_DEBUG, "[WARNING]oneM2M long-short mapping initialization failed!!");
 
 		const char* p_body = (const char*)p__source;
-		CHARSTRING encoded_message	= "";
 
 		Value jsonDoc(objectValue);
 		Value jsonRoot(objectValue);
-		Reader jsonReader;
+		Reader& jsonReader = MappingArena::instance().jsonReader();
 
 		Value rootTag;
 		Value elemName;
@@ -1568,7 +1590,7 @@ namespace OneM2M__DualFaceMapping {
 		std::string name_short;
 		std::string parent_tag = "";
 
-		bool parsingSuccessful = jsonReader.parse(p_body, jsonRoot, false);
+		bool parsingSuccessful = jsonReader.parse(p_body, p_body + strlen(p_body), jsonRoot, false);
 
 		if ( !parsingSuccessful ) {
 			TTCN_Logger::log(TTCN_DEBUG, "JSONCPP API parsing error!");
@@ -1608,19 +1630,13 @@ namespace OneM2M__DualFaceMapping {
 					}
 				} else if(elemObj.isObject()){ // Go deep parsing child objects
 					jsonObjClone[parent_tag.c_str()] = elemObj;
-					jsonRootClone = JSONDeepParser(jsonObjClone, jsonRootClone, jsonRootClone);
+					JSONDeepParser(jsonObjClone, jsonRootClone);
 				}
 			}
 		}
 
-		StyledWriter writer;
 		rootTag[REQUEST_PRIMITIVE] = jsonRootClone; // Root tag for triggering message
-		std::string json_str = writer.write(rootTag);
-
-		CHARSTRING temp_cs(json_str.c_str());
-		encoded_message = temp_cs;
-		// TTCN_Logger::log(TTCN_DEBUG, (const char*)encoded_message);
 
-		return encoded_message;
+		return JSON_wire_string(rootTag);
 	}
 }
@@ -0,0 +1,109 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_jsonCopyBench.cc
+//  Description:        Counts the Json::Value copies of the JsonCPP based encoder and decoder
+//  Rev:                R2I
+//
+//  Stand-alone program, not part of the test suite build (oneM2MTester.tpd).
+//  Every document given on the command line is decoded by f_primitiveContent_Dec and encoded
+//  by f_serialization_Enc with tsp_jsonStreaming off, so JSONDeepParserDec and JSONDeepParser
+//  are used. The copy constructor of Json::Value is counted
+//  through a copy of jsoncpp.cc made by the build steps below. "copies" counts every call,
+//  "non-null" leaves out the null placeholders JsonCPP copies into new object members and
+//  array slots. The TITAN runtime is replaced by the stand-ins in titan_stub.
+//
+//  Corpus: json_corpus/nested holds m2m:agr responses with containers nested 2 and 4 deep,
+//  with short names (decoder input) and with long names (*_long.json, encoder input).
+//
+//  Build and run (Linux), from this directory:
+//    sed -e '/^Value::Value(Value const& other)$/i unsigned long g_value_copies = 0, g_non_null_copies = 0;' \
+//      -e '/^Value::Value(Value const& other)$/,/^{$/ s/^{$/{ ++g_value_copies; if (other.type_ != nullValue) ++g_non_null_copies;/' \
+//      ../../../Lib/JSONCPP/jsoncpp.cc > /tmp/jsoncpp_counted.cc
+//    g++ -O2 -Ititan_stub -I.. -I../../Parser -I../../../Lib/HashTable -I../../../Lib/JSONCPP/json \
+//      -I../../../Lib/JSONCPP -I../../../Lib/TinyXml -o OneM2M_jsonCopyBench OneM2M_jsonCopyBench.cc \
+//      titan_stub/TTCN3_stub.cc ../OneM2M_long2short_Enc.cc ../OneM2M_JsonStream.cc ../OneM2M_NameMapping.cc \
+//      ../OneM2M_MappingArena.cc ../OneM2M_PayloadLog.cc ../OneM2M_XmlStream.cc ../../Parser/*.cc \
+//      /tmp/jsoncpp_counted.cc ../../../Lib/TinyXml/tinyxml2.cc -lpthread
+//    ./OneM2M_jsonCopyBench json_corpus/nested/*.json
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "OneM2M_DualFaceMapping.hh"
+
+namespace Json {
+	extern unsigned long g_value_copies;
+	extern unsigned long g_non_null_copies;
+}
+
+using namespace OneM2M__DualFaceMapping;
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static const int ROUNDS = 200;
+
+// runs one direction ROUNDS times and prints the copies per message
+static void measure(const char* direction, const char* file, const CHARSTRING& source) {
+	OneM2M__Types::AttributeAux__list forced_fields;
+	CHARSTRING result;
+	unsigned long copies = Json::g_value_copies;
+	unsigned long non_null = Json::g_non_null_copies;
+	double start = now();
+
+	for(int round = 0; round < ROUNDS; round++) {
+		if(strcmp(direction, "dec") == 0) {
+			result = f__primitiveContent__Dec(source, "json", "");
+		} else {
+			result = f__serialization__Enc(source, "json", forced_fields);
+		}
+	}
+
+	printf("%-40s %s  copies %7lu  non-null %7lu  %8.1f us/msg\n", file, direction,
+		(Json::g_value_copies - copies) / ROUNDS, (Json::g_non_null_copies - non_null) / ROUNDS,
+		(now() - start) / ROUNDS * 1e6);
+}
+
+int main(int argc, char** argv) {
+	if(argc < 2) {
+		fprintf(stderr, "usage: %s document.json...\n", argv[0]);
+		return 1;
+	}
+
+	OneM2M__Constants::tsp__jsonStreaming = false;
+
+	for(int i = 1; i < argc; i++) {
+		std::ifstream file(argv[i]);
+
+		if(!file.is_open()) {
+			fprintf(stderr, "cannot open %s\n", argv[i]);
+			return 1;
+		}
+
+		std::stringstream content;
+		content << file.rdbuf();
+
+		CHARSTRING source(content.str().c_str());
+		measure("dec", argv[i], source);
+		measure("enc", argv[i], source);
+	}
+	return 0;
+}
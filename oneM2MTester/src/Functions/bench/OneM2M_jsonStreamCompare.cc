@@ -0,0 +1,87 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_jsonStreamCompare.cc
+//  Description:        Compares the single pass JSON decoder with the JsonCPP based one
+//  Rev:                R2I
+//
+//  Stand-alone program, not part of the test suite build (oneM2MTester.tpd).
+//  Every document given on the command line is decoded by JSONStreamDecoder and, with
+//  tsp_jsonStreaming off, by f_primitiveContent_Dec with JSONDeepParserDec. For the documents
+//  the streamer accepts both results must be byte-identical; the others are only counted.
+//  The TITAN runtime is replaced by the stand-ins in titan_stub.
+//
+//  Corpus: json_corpus/recorded holds oneM2M resources as sent by a CSE, the random documents
+//  are generated with json_corpus/gen_json_corpus.py (1500 documents by default).
+//
+//  Build and run (Linux), from this directory:
+//    g++ -O2 -Ititan_stub -I.. -I../../Parser -I../../../Lib/HashTable -I../../../Lib/JSONCPP/json \
+//      -I../../../Lib/JSONCPP -I../../../Lib/TinyXml -o OneM2M_jsonStreamCompare OneM2M_jsonStreamCompare.cc \
+//      titan_stub/TTCN3_stub.cc ../OneM2M_long2short_Enc.cc ../OneM2M_JsonStream.cc ../OneM2M_NameMapping.cc \
+//      ../OneM2M_MappingArena.cc ../OneM2M_PayloadLog.cc ../OneM2M_XmlStream.cc ../../Parser/*.cc \
+//      ../../../Lib/JSONCPP/jsoncpp.cc ../../../Lib/TinyXml/tinyxml2.cc -lpthread
+//    python3 json_corpus/gen_json_corpus.py /tmp/json_corpus
+//    ./OneM2M_jsonStreamCompare json_corpus/recorded/*.json /tmp/json_corpus/*.json
+
+#include <stdio.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "OneM2M_JsonStream.hh"
+#include "OneM2M_DualFaceMapping.hh"
+
+using namespace OneM2M__DualFaceMapping;
+
+int main(int argc, char** argv) {
+	if(argc < 2) {
+		fprintf(stderr, "usage: %s document.json...\n", argv[0]);
+		return 1;
+	}
+
+	int streamed = 0;
+	int different = 0;
+
+	for(int i = 1; i < argc; i++) {
+		std::ifstream file(argv[i]);
+
+		if(!file.is_open()) {
+			fprintf(stderr, "cannot open %s\n", argv[i]);
+			return 1;
+		}
+
+		std::stringstream content;
+		content << file.rdbuf();
+
+		std::string source = content.str();
+		std::string stream_output;
+		JSONStreamDecoder stream_decoder(source.c_str(), stream_output);
+
+		if(!stream_decoder.decode()) {
+			continue;
+		}
+		streamed++;
+
+		OneM2M__Constants::tsp__jsonStreaming = false;
+		CHARSTRING dom_output = f__primitiveContent__Dec(CHARSTRING(source.c_str()), "json", "");
+		OneM2M__Constants::tsp__jsonStreaming = true;
+
+		if(stream_output != (const char*)dom_output) {
+			printf("DIFFERENT %s\n  stream: %s\n  DOM:    %s\n", argv[i], stream_output.c_str(), (const char*)dom_output);
+			different++;
+		}
+	}
+
+	printf("documents: %d, streamed: %d, JsonCPP only: %d, different: %d\n", argc - 1, streamed, argc - 1 - streamed, different);
+	return different == 0 ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_nameLookupBench.cc
+//  Description:        Benchmark of the oneM2M long/short name lookups
+//  Rev:                R2I
+//
+//  Stand-alone program, not part of the test suite build (oneM2MTester.tpd).
+//  It reads long_to_short_mapping.txt and short_to_long_mapping.txt and looks up
+//  every key of both files plus the same number of unknown keys in
+//   - the former table: HashMap<std::string, std::string, 50, ...> hashing the key length,
+//     called with a std::string as the former getShortName/getLongName were,
+//   - the compiled-in dictionaries of OneM2M_NameDictionary.hh,
+//   - the FlatHashMap<std::string, const char*> used when the tables are read from files.
+//  All three must return the same names; a mismatch is reported and the program fails.
+//
+//  Build and run (Linux), from this directory:
+//    g++ -O2 -I.. -I../../../Lib/HashTable -o OneM2M_nameLookupBench OneM2M_nameLookupBench.cc
+//    ./OneM2M_nameLookupBench [mapping table dir (../../../Lib/ResourceMappingTable)] [rounds (2000)]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "OneM2M_NameDictionary.hh"
+
+namespace OneM2M__DualFaceMapping {
+
+	// copied from OneM2M_NameMapping.cc, which cannot be built without TITAN;
+	// the result comparison in main() fails if the two ever diverge
+	uint32_t NameDictionary::hash(const char* key, size_t length, uint32_t seed) {
+		uint32_t h = 2166136261u ^ seed;
+
+		for(size_t i = 0; i < length; i++) {
+			h ^= (unsigned char)key[i];
+			h *= 16777619u;
+		}
+		h ^= h >> 16;
+		h *= 0x85ebca6bu;
+		h ^= h >> 13;
+		h *= 0xc2b2ae35u;
+		h ^= h >> 16;
+		return h;
+	}
+
+	const char* NameDictionary::find(const char* key, size_t length) const {
+		unsigned int seed = seeds[hash(key, length, 0) % bucket_count];
+
+		if(seed == 0) {
+			return NULL;
+		}
+
+		const NameDictionaryEntry& entry = entries[hash(key, length, seed) % size];
+
+		if(entry.key_length != length || memcmp(strings + entry.key_offset, key, length) != 0) {
+			return NULL;
+		}
+		return strings + entry.value_offset;
+	}
+}
+
+using namespace OneM2M__DualFaceMapping;
+
+// the former NameMappingKeyHash
+struct LengthKeyHash {
+	unsigned long operator()(const std::string& k) const {
+		return k.length() % 10;
+	}
+};
+
+typedef HashMap<std::string, std::string, 50, LengthKeyHash> OldTable;
+
+struct Key {
+	std::string name;
+	bool long_to_short;
+};
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// reads "name=mapped" lines like NameMappingRegistry::readTableFile
+static bool readTable(const std::string& path, bool long_to_short, OldTable& old_table,
+		FlatHashMap<std::string, const char*>& flat_table, std::vector<std::string*>& names, std::vector<Key>& keys) {
+	std::ifstream fin(path.c_str());
+
+	if(!fin.is_open()) {
+		fprintf(stderr, "cannot open %s\n", path.c_str());
+		return false;
+	}
+
+	std::string line;
+
+	while(std::getline(fin, line)) {
+		if(!line.empty() && line[line.length() - 1] == '\r') {
+			line.erase(line.length() - 1);
+		}
+
+		size_t eq = line.find('=');
+
+		if(eq == std::string::npos || eq == 0 || eq + 1 == line.length()) {
+			continue;
+		}
+
+		std::string name = line.substr(0, eq);
+		std::string* mapped = new std::string(line.substr(eq + 1));
+
+		names.push_back(mapped);
+		old_table.put(name, *mapped);
+		flat_table.put(name, mapped->c_str());
+
+		Key key = { name, long_to_short };
+		keys.push_back(key);
+	}
+	return true;
+}
+
+static bool sameName(const char* a, const char* b) {
+	return a == NULL ? b == NULL : b != NULL && strcmp(a, b) == 0;
+}
+
+int main(int argc, char** argv) {
+	std::string dir = argc > 1 ? argv[1] : "../../../Lib/ResourceMappingTable";
+	int rounds = argc > 2 ? atoi(argv[2]) : 2000;
+
+	if(rounds <= 0) {
+		fprintf(stderr, "usage: %s [mapping table dir] [rounds]\n", argv[0]);
+		return 1;
+	}
+
+	OldTable old_l2s, old_s2l;
+	FlatHashMap<std::string, const char*> flat_l2s(1024), flat_s2l(1024);
+	std::vector<std::string*> names;
+	std::vector<Key> keys;
+
+	if(!readTable(dir + "/long_to_short_mapping.txt", true, old_l2s, flat_l2s, names, keys) ||
+	   !readTable(dir + "/short_to_long_mapping.txt", false, old_s2l, flat_s2l, names, keys)) {
+		return 1;
+	}
+
+	// unknown keys: every key with one character changed
+	size_t hits = keys.size();
+	for(size_t i = 0; i < hits; i++) {
+		Key miss = keys[i];
+		miss.name[miss.name.length() / 2] ^= 0x20;
+		keys.push_back(miss);
+	}
+
+	// all three must agree before anything is measured
+	size_t found = 0;
+	for(size_t i = 0; i < keys.size(); i++) {
+		const Key& k = keys[i];
+		std::string old_value;
+		bool old_found = (k.long_to_short ? old_l2s : old_s2l).get(k.name, old_value);
+		const char* dict_value = (k.long_to_short ? NAME_DICTIONARY_L2S : NAME_DICTIONARY_S2L).find(k.name.data(), k.name.length());
+		const char* const* flat_value = (k.long_to_short ? flat_l2s : flat_s2l).find(StringRef(k.name.data(), k.name.length()));
+
+		if(!sameName(old_found ? old_value.c_str() : NULL, dict_value) ||
+		   !sameName(dict_value, flat_value != NULL ? *flat_value : NULL)) {
+			fprintf(stderr, "results differ for %s key <%s>\n", k.long_to_short ? "long" : "short", k.name.c_str());
+			return 1;
+		}
+		found += dict_value != NULL;
+	}
+	printf("keys: %lu (%lu found), rounds: %d, results identical\n", (unsigned long)keys.size(), (unsigned long)found, rounds);
+
+	for(int pass = 0; pass < 2; pass++) {
+		size_t check = 0;
+		double t = now();
+		for(int r = 0; r < rounds; r++) {
+			for(size_t i = 0; i < keys.size(); i++) {
+				std::string value;
+				// the former getShortName(std::string) built the key string from the caller's buffer
+				std::string key(keys[i].name.data(), keys[i].name.length());
+				if((keys[i].long_to_short ? old_l2s : old_s2l).get(key, value)) {
+					check += value.length();
+				}
+			}
+		}
+		double t_old = now() - t;
+
+		t = now();
+		for(int r = 0; r < rounds; r++) {
+			for(size_t i = 0; i < keys.size(); i++) {
+				const char* value = (keys[i].long_to_short ? NAME_DICTIONARY_L2S : NAME_DICTIONARY_S2L).find(keys[i].name.data(), keys[i].name.length());
+				if(value != NULL) {
+					check += strlen(value);
+				}
+			}
+		}
+		double t_dict = now() - t;
+
+		t = now();
+		for(int r = 0; r < rounds; r++) {
+			for(size_t i = 0; i < keys.size(); i++) {
+				const char* const* value = (keys[i].long_to_short ? flat_l2s : flat_s2l).find(StringRef(keys[i].name.data(), keys[i].name.length()));
+				if(value != NULL) {
+					check += strlen(*value);
+				}
+			}
+		}
+		double t_flat = now() - t;
+
+		double lookups = (double)keys.size() * rounds;
+		printf("HashMap (key length hash) %6.1f ns  dictionary %6.1f ns  FlatHashMap %6.1f ns  per lookup  (check %lu)\n",
+				t_old / lookups * 1e9, t_dict / lookups * 1e9, t_flat / lookups * 1e9, (unsigned long)check);
+	}
+
+	for(size_t i = 0; i < names.size(); i++) {
+		delete names[i];
+	}
+	return 0;
+}
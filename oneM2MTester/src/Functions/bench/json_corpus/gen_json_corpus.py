@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2017  Korea Electronics Technology Institute.
+# All rights reserved. This program and the accompanying materials
+# are made available under the terms of
+# - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),
+# - BSD-3 Clause Licence(http://www.iotocean.org/license/).
+#
+#  File:               gen_json_corpus.py
+#  Description:        Generates the random short name JSON documents used to compare the single pass
+#                      JSON decoder with the JsonCPP based one (OneM2M_jsonStreamCompare.cc)
+#  Rev:                R2I
+#
+#  Usage: gen_json_corpus.py output_dir [count (1500)]
+#  Document i (1.json .. count.json) only depends on i, so the corpus is the same on every run.
+#  The documents mix the short names of the mapping table with unknown names, nested objects and
+#  arrays, the names the DOM decoder treats specially (acr, acco, rqi, subscription, group_ ...),
+#  escapes, non-ASCII text, large numbers and aggregated responses (m2m:agr).
+
+import json
+import os
+import random
+import sys
+
+TABLE_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                          '..', '..', '..', '..', 'Lib', 'ResourceMappingTable', 'short_to_long_mapping.txt')
+
+FIXED_KEYS = ['op', 'ty', 'acop', 'rcn', 'csy', 'mt', 'nct', 'cst', 'rsc', 'acco', 'rqi', 'lbl', 'rn', 'et', 'nu',
+              'pv', 'acr', 'acor', 'csz', 'zz', 'aa', 'x/y', 'subscription', 'group_']
+ROOTS = ['m2m:ae', 'm2m:cnt', 'm2m:cin', 'm2m:acp', 'm2m:sub', 'm2m:grp', 'foo', 'm2m:uril', 'm2m:agr', 'pc']
+STRINGS = ['1', '2', '2001', '4004', 'x', 'hello world', 'a"b', 't\\ab', 'é中', '']
+NUMBERS = [0, 1, 2, 3, -1, 4, 5, 42, 2001, 3.5, -0.0, 3.0, 1e20, 12345678901234567890, -9223372036854775808,
+           9223372036854775808, 1.5e-7, 100, 2147483648, -2147483649]
+
+
+def short_names():
+    with open(TABLE_FILE) as table:
+        lines = table.read().split('\n')
+    return [line.split('=')[0] for line in lines if '=' in line and not line[0].isdigit()]
+
+
+class Generator:
+    def __init__(self, names):
+        self.keys = FIXED_KEYS + random.sample(names, 16)
+
+    def scalar(self):
+        r = random.random()
+        if r < 0.4:
+            return random.choice(STRINGS)
+        if r < 0.65:
+            return random.choice(NUMBERS)
+        if r < 0.8:
+            return random.choice([True, False])
+        return None
+
+    def object(self, depth):
+        return {random.choice(self.keys): self.value(depth + 1) for _ in range(random.randint(0, 4))}
+
+    def value(self, depth):
+        r = random.random()
+        if depth > 4 or r < 0.4:
+            return self.scalar()
+        if r < 0.7:
+            return self.object(depth)
+        n = random.randint(0, 4)
+        k = random.random()
+        if k < 0.4:
+            return [self.scalar() for _ in range(n)]
+        if k < 0.8:
+            return [self.value(depth + 1) if random.random() < 0.3 else self.object(depth + 1) for _ in range(n)]
+        return [random.choice([1, 2, 'abc', {'rn': 'x', 'ty': 2}]) for _ in range(n)]
+
+    def document(self):
+        root = random.choice(ROOTS)
+        if root == 'm2m:uril':
+            content = [random.choice(['/a/b', 'x', 1, None]) for _ in range(random.randint(0, 4))]
+        elif root == 'm2m:agr':
+            content = {'m2m:rsp': [dict(self.object(1), rsc=random.choice(['2001', '2000', 'x']), rqi='r')
+                                   for _ in range(random.randint(0, 3))]}
+        elif random.random() < 0.1:
+            content = self.scalar()
+        else:
+            content = {random.choice(self.keys): self.value(1) for _ in range(random.randint(0, 8))}
+        return json.dumps({root: content}, ensure_ascii=random.random() < 0.5)
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit('usage: gen_json_corpus.py output_dir [count]')
+    output_dir = sys.argv[1]
+    count = int(sys.argv[2]) if len(sys.argv) > 2 else 1500
+    names = short_names()
+
+    if not os.path.isdir(output_dir):
+        os.makedirs(output_dir)
+    for i in range(1, count + 1):
+        random.seed(i)
+        with open(os.path.join(output_dir, '%d.json' % i), 'w', encoding='utf-8') as out:
+            out.write(Generator(names).document() + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,76 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               OneM2M_DualFaceMapping.hh
+//  Description:        Minimal stand-in for the header TITAN generates from OneM2M_DualFaceMapping.ttcn,
+//                      for the benchmarks in src/Functions/bench
+//  Rev:                R2I
+
+#ifndef ONEM2M_DUALFACEMAPPING_STUB_HH
+#define ONEM2M_DUALFACEMAPPING_STUB_HH
+
+#include <TTCN3.hh>
+#include <vector>
+
+// module parameters, set from the environment in TTCN3_stub.cc
+namespace OneM2M__Constants {
+	extern CHARSTRING tsp__nameMappingTableDir;
+	extern BOOLEAN tsp__compactJsonSerialization;
+	extern BOOLEAN tsp__jsonStreaming;
+	extern INTEGER tsp__maxLoggedPayloadLength;
+	extern INTEGER tsp__mappingArenaHighWater;
+}
+
+namespace OneM2M__Types {
+	struct CHARSTRING_OPTIONAL {
+		bool present;
+		CHARSTRING value;
+		bool operator==(omit_type) const { return !present; }
+	};
+
+	struct AttributeAux {
+		CHARSTRING name_;
+		CHARSTRING_OPTIONAL value_;
+		const CHARSTRING& name() const { return name_; }
+		const CHARSTRING_OPTIONAL& value__() const { return value_; }
+	};
+
+	struct AttributeAux__list {
+		std::vector<AttributeAux> elements;
+		bool operator!=(null_type) const { return !elements.empty(); }
+		int lengthof() const { return (int)elements.size(); }
+		const AttributeAux& operator[](int i) const { return elements[i]; }
+	};
+}
+
+namespace CoAP__Types {
+	struct Charstring__List {
+		std::vector<CHARSTRING> elements;
+		CHARSTRING& operator[](int i) {
+			if((int)elements.size() <= i) {
+				elements.resize(i + 1);
+			}
+			return elements[i];
+		}
+	};
+}
+
+namespace OneM2M__DualFaceMapping {
+	CHARSTRING f__serialization__Enc(const CHARSTRING& p__source, const CHARSTRING& p__serialization__type, const OneM2M__Types::AttributeAux__list& p__forcedFields);
+	CHARSTRING f__primitiveContent__Dec(const CHARSTRING& source_str, const CHARSTRING& serial_type, const CHARSTRING& noti_message);
+	CHARSTRING f__serialization__Enc__for__trigger__msg(const CHARSTRING& p__source);
+	BOOLEAN f__reloadNameMapping(const CHARSTRING& p__table__dir);
+}
+
+#endif
@@ -0,0 +1,87 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               TTCN3.hh
+//  Description:        Minimal stand-in for the TITAN runtime header, for the benchmarks in src/Functions/bench
+//  Rev:                R2I
+//
+//  Only what the dual face mapping sources use is provided, so that they can be built and
+//  compared without a TITAN installation. Log messages go to stderr if STUBLOG is set.
+
+#ifndef TTCN3_STUB_HH
+#define TTCN3_STUB_HH
+
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+enum { TTCN_DEBUG, TTCN_WARNING, TTCN_ERROR };
+
+struct TTCN_Logger {
+	static void log(int, const char* fmt, ...) {
+		va_list args;
+		va_start(args, fmt);
+		if(getenv("STUBLOG") != NULL) {
+			vfprintf(stderr, fmt, args);
+			fputc('\n', stderr);
+		}
+		va_end(args);
+	}
+	static bool log_this_event(int) { return getenv("STUBLOG") != NULL; }
+	static void begin_event(int) {}
+	static void end_event() {}
+	static void log_event(const char*, ...) {}
+	static void log_event_str(const char*) {}
+	static void log_event_va_list(const char*, va_list) {}
+};
+
+struct BOOLEAN {
+	bool value;
+	BOOLEAN(bool v = false) : value(v) {}
+	operator bool() const { return value; }
+};
+
+struct INTEGER {
+	long long value;
+	INTEGER(long long v = 0) : value(v) {}
+	operator long long() const { return value; }
+};
+
+struct CHARSTRING {
+	std::string value;
+	CHARSTRING() {}
+	CHARSTRING(const char* v) : value(v) {}
+	CHARSTRING(int length, const char* v) : value(v, length) {}
+	operator const char*() const { return value.c_str(); }
+	int lengthof() const { return (int)value.size(); }
+	bool operator==(const char* other) const { return value == other; }
+	bool operator==(const CHARSTRING& other) const { return value == other.value; }
+};
+
+inline bool operator==(const char* a, const CHARSTRING& b) { return b == a; }
+
+inline CHARSTRING int2str(long long i) {
+	char buffer[32];
+	sprintf(buffer, "%lld", i);
+	return CHARSTRING(buffer);
+}
+
+inline long long float2int(double d) { return (long long)d; }
+
+enum null_type { NULL_VALUE };
+enum omit_type { OMIT_VALUE };
+
+#endif
@@ -0,0 +1,31 @@
+/****************************************************************************************
+* Copyright (c) 2017  Korea Electronics Technology Institute.				            *
+* All rights reserved. This program and the accompanying materials			            *
+* are made available under the terms of                                         	    *
+* - Eclipse Public License v1.0(http://www.eclipse.org/legal/epl-v10.html),     	    *
+* - BSD-3 Clause Licence(http://www.iotocean.org/license/),                    		    *
+* - MIT License   (https://github.com/open-source-parsers/jsoncpp/blob/master/LICENSE), *
+* - zlib License  (https://github.com/leethomason/tinyxml2#license).                    *
+*											                                            *
+* Contributors:										                                    *
+*   JaeYoung Hwang   - forest62590@gmail.com                                   	        *
+*   Nak-Myoung Sung                                                            	        *
+*   Ting Martin MIAO - initial implementation                                           *
+*****************************************************************************************/
+//  File:               TTCN3_stub.cc
+//  Description:        Module parameters of the TITAN stand-ins, for the benchmarks in src/Functions/bench
+//  Rev:                R2I
+//
+//  The defaults are those of OneM2M_Constants.ttcn. TABLEDIR, STYLED, NOSTREAM, LOGMAX and
+//  HIGHWATER in the environment override them.
+
+#include <stdlib.h>
+#include "OneM2M_DualFaceMapping.hh"
+
+namespace OneM2M__Constants {
+	CHARSTRING tsp__nameMappingTableDir(getenv("TABLEDIR") != NULL ? getenv("TABLEDIR") : "");
+	BOOLEAN tsp__compactJsonSerialization(getenv("STYLED") == NULL);
+	BOOLEAN tsp__jsonStreaming(getenv("NOSTREAM") == NULL);
+	INTEGER tsp__maxLoggedPayloadLength(getenv("LOGMAX") != NULL ? atoi(getenv("LOGMAX")) : 65536);
+	INTEGER tsp__mappingArenaHighWater(getenv("HIGHWATER") != NULL ? atoi(getenv("HIGHWATER")) : 1048576);
+}
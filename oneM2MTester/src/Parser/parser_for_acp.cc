@@ -14,9 +14,13 @@
 ****************************************************************************************/
 
 #include <string>
+#include <string.h>
 #include "json.h"
 #include "json-forwards.h"
 #include "External_function.hh"
+#include "OneM2M_PayloadLog.hh"
+#include "OneM2M_JsonStream.hh"
+#include "OneM2M_MappingArena.hh"
 #include "OneM2M_DualFaceMapping.hh"
 
 using namespace tinyxml2;
@@ -32,14 +36,13 @@ namespace OneM2M__DualFaceMapping {
 		Value resourceRoot(objectValue);
 		Value jsonRoot(objectValue);
 
-		Reader jsonReader;
+		Reader& jsonReader = MappingArena::instance().jsonReader();
 		std::string name_short;
 
 		const char* p_body			= (const char*)p__source;
-		CHARSTRING encoded_message	= "";
 
 		// 1. Make the JSOn object from the string data
-		bool parsingSuccessful = jsonReader.parse(p_body, jsonRoot, false);
+		bool parsingSuccessful = jsonReader.parse(p_body, p_body + strlen(p_body), jsonRoot, false);
 		if ( !parsingSuccessful ) {
 			TTCN_Logger::log(TTCN_DEBUG, "JsonCPP API parsing error!");
 			return "JsonCPP API parsing error!";
@@ -61,7 +64,7 @@ namespace OneM2M__DualFaceMapping {
 			}
 
 			if(elemObj.isObject()) { // object
-				subElemObj = acp_JSON_Enc_Parser_Deep(elemObj, subElemObj, elemName);
+				acp_JSON_Enc_Parser_Deep(elemObj, subElemObj, elemName);
 			} else if (elemObj.isArray()) { // array
 				Value elemArrayObj(arrayValue);
 
@@ -87,18 +90,12 @@ namespace OneM2M__DualFaceMapping {
 		}
 
 		resourceRoot[rootName] = subElemObj;
-		TTCN_Logger::log(TTCN_DEBUG, "Pretty print of DECODED JSON message:\n%s", resourceRoot.toStyledString().c_str());
+		log_payload("Pretty print of DECODED JSON message", resourceRoot);
 
-		StyledWriter writer;
-		std::string json_str = writer.write(resourceRoot);
-
-		CHARSTRING temp_cs(json_str.c_str());
-		encoded_message	= temp_cs;
-
-		return encoded_message;
+		return JSON_wire_string(resourceRoot);
 	}
 
-	Json::Value acp_JSON_Enc_Parser_Deep (Json::Value objectSource, Json::Value objectRoot, Json::Value elemName) {
+	void acp_JSON_Enc_Parser_Deep (const Json::Value& objectSource, Json::Value& objectRoot, const Json::Value& elemName) {
 
 		// Constant variables for the resource and attributes name
 		static const std::string ACCESS_CONTROL_OPERATION("acop"), ACCESS_CONTROL_RULE("acr");
@@ -109,14 +106,13 @@ namespace OneM2M__DualFaceMapping {
 		Value subElemObj(objectValue);
 		Value containerForSubElem(objectValue);
 
-		for (Value::iterator iter = objectSource.begin(); iter != objectSource.end(); ++iter) {
+		for (Value::const_iterator iter = objectSource.begin(); iter != objectSource.end(); ++iter) {
 
 			Value elemName;
-			Value elemObj(objectValue);
 
 			// 1. Select the attribute with KEY
 			elemName = iter.key();
-			elemObj = objectSource.get(elemName.asString(), "");
+			const Value& elemObj = *iter;
 
 			// 2. Change the oneM2M long name to short name for SUT
 			name_short = getShortName(elemName.asString());
@@ -135,12 +131,11 @@ namespace OneM2M__DualFaceMapping {
 				if(elemObj.size() != 0) {
 					for(unsigned int index = 0; index < elemObj.size(); index++){
 
-						Value tempObj = elemObj[index];
+						const Value& tempObj = elemObj[index];
 
 						if (tempObj.isObject()) {
-							Value subElemObj(objectValue);
-							subElemObj = acp_JSON_Enc_Parser_Deep(tempObj, subElemObj, elemName);
-							elemArrayObj.append(subElemObj);
+							Value& subElemObj = elemArrayObj.append(Value(objectValue));
+							acp_JSON_Enc_Parser_Deep(tempObj, subElemObj, elemName);
 						} else if(tempObj.isString()){
 							elemArrayObj.append(tempObj);
 						} else if (tempObj.isBool()){
@@ -158,7 +153,7 @@ namespace OneM2M__DualFaceMapping {
 							TTCN_Logger::log(TTCN_DEBUG, "Unexpected flow");
 						}
 					}
-					containerForSubElem[name_short.c_str()] = elemArrayObj;
+					containerForSubElem[name_short.c_str()].swap(elemArrayObj);
 				}
 			} else if(elemObj.isString()) { // string
 				if(ACCESS_CONTROL_OPERATION == name_short){ // add all enumerated type here
@@ -178,10 +173,9 @@ namespace OneM2M__DualFaceMapping {
 		}
 
 		if(rootName != ACCESS_CONTROL_RULE) {
-			objectRoot[rootName.c_str()] = containerForSubElem;
-			return objectRoot;
+			objectRoot[rootName.c_str()].swap(containerForSubElem);
 		} else {
-			return containerForSubElem;
+			objectRoot.swap(containerForSubElem);
 		}
 	}
 }
@@ -14,9 +14,12 @@
 ****************************************************************************************/
 
 #include <string>
+#include <string.h>
 #include "json.h"
 #include "json-forwards.h"
 #include "External_function.hh"
+#include "OneM2M_PayloadLog.hh"
+#include "OneM2M_MappingArena.hh"
 #include "OneM2M_DualFaceMapping.hh"
 
 using namespace tinyxml2;
@@ -28,7 +31,7 @@ namespace OneM2M__DualFaceMapping {
 
 		CHARSTRING SERIALIZATION_JSON = "json";
 		CHARSTRING encoded_message;
-		Reader jsonReader;
+		Reader& jsonReader = MappingArena::instance().jsonReader();
 
 		Value jsonRoot(objectValue);
 		Value resourceRoot(objectValue);
@@ -51,14 +54,14 @@ namespace OneM2M__DualFaceMapping {
 
 			std::string name_long;
 
-			bool parsingSuccessful = jsonReader.parse(p_body, jsonRoot, false);
+			bool parsingSuccessful = jsonReader.parse(p_body, p_body + strlen(p_body), jsonRoot, false);
 
 			if ( !parsingSuccessful ) {
 				TTCN_Logger::log(TTCN_DEBUG, "JsonCPP API parsing error!");
 				return "JsonCPP API parsing error!";
 			}
 
-			TTCN_Logger::log(TTCN_DEBUG, "[Decoding] Read JSON document for decoding:\n%s", jsonRoot.toStyledString().c_str());
+			log_payload("[Decoding] Read JSON document for decoding", jsonRoot);
 
 
 			// 2. extract the sub element
@@ -81,7 +84,7 @@ namespace OneM2M__DualFaceMapping {
 				}
 
 				if(elemObj.isObject()) { // object
-					subElemObj = noti_JSON_Dec_Parser_Deep(elemObj, subElemObj, elemName);
+					noti_JSON_Dec_Parser_Deep(elemObj, subElemObj, elemName);
 				} else if (elemObj.isString()) { // string
 					subElemObj[name_long.c_str()] = elemObj;
 				} else if (elemObj.isInt()) { // integer
@@ -96,18 +99,18 @@ namespace OneM2M__DualFaceMapping {
 
 		resourceRoot[rootName] = subElemObj;
 
-		TTCN_Logger::log(TTCN_DEBUG, "Pretty print of DECODED JSON message:\n%s", resourceRoot.toStyledString().c_str());
-
 		StyledWriter writer;
 		std::string json_str = writer.write(resourceRoot);
 
+		log_payload("Pretty print of DECODED JSON message", json_str);
+
 		CHARSTRING temp_cs(json_str.c_str());
 		encoded_message	= temp_cs;
 
 		return encoded_message;
 	}
 
-	Json::Value noti_JSON_Dec_Parser_Deep (Json::Value objectSource, Json::Value objectRoot, Json::Value elemName) {
+	void noti_JSON_Dec_Parser_Deep (const Json::Value& objectSource, Json::Value& objectRoot, const Json::Value& elemName) {
 
 		// Constant variables for the resource and attributes name
 		static const std::string SUBSCRIPTION("subscription"), RESOURCE("resource"), EVENT_NOTIFICATION_CRITERIA("eventNotificationCriteria"),
@@ -121,14 +124,13 @@ namespace OneM2M__DualFaceMapping {
 		Value subElemObj(objectValue);
 		Value containerForSubElem(objectValue);
 
-		for (Value::iterator iter = objectSource.begin(); iter != objectSource.end(); ++iter) {
+		for (Value::const_iterator iter = objectSource.begin(); iter != objectSource.end(); ++iter) {
 
 			Value elemName;
-			Value elemObj(objectValue);
 
 			// 1. Select the attribute with KEY
 			elemName = iter.key();
-			elemObj = objectSource.get(elemName.asString(), "");
+			const Value& elemObj = *iter;
 
 			// 2. Change the oneM2M short name to long name for the TTCN-3
 			name_long = getLongName(elemName.asString());
@@ -137,14 +139,14 @@ namespace OneM2M__DualFaceMapping {
 			}
 
 			if(elemObj.isObject()) { // object
-				containerForSubElem = noti_JSON_Dec_Parser_Deep(elemObj, containerForSubElem, elemName);
+				noti_JSON_Dec_Parser_Deep(elemObj, containerForSubElem, elemName);
 			} else if (elemObj.isArray()) { // array
 
 				Value elemArrayObj(arrayValue);
 
 				for(unsigned int index = 0; index < elemObj.size(); index++){
 
-					Value tempObj = elemObj[index];
+					const Value& tempObj = elemObj[index];
 
 					if(tempObj.isString()){
 						elemArrayObj.append(tempObj.asString());
@@ -162,10 +164,9 @@ namespace OneM2M__DualFaceMapping {
 					} else {
 						TTCN_Logger::log(TTCN_DEBUG, "Unexpected flow");
 					}
-					containerForSubElem[name_long.c_str()] = elemArrayObj;
 				}
 
-				containerForSubElem[name_long.c_str()] = elemArrayObj;
+				containerForSubElem[name_long.c_str()].swap(elemArrayObj);
 			} else if (elemObj.isString()) { // string
 				containerForSubElem[name_long.c_str()] = elemObj;
 			} else if (elemObj.isInt()) { // integer
@@ -200,12 +201,11 @@ namespace OneM2M__DualFaceMapping {
 		if(rootName == SUBSCRIPTION || rootName == AE || rootName == CONTAINER || rootName == CSEBASE) {
 
 			Value elemForSub(objectValue);
-			elemForSub[rootName] = containerForSubElem;
+			elemForSub[rootName].swap(containerForSubElem);
 
-			objectRoot[RESOURCE] = elemForSub;
+			objectRoot[RESOURCE].swap(elemForSub);
 		} else { // if attribute is not rootTag
-			objectRoot[rootName.c_str()] = containerForSubElem;
+			objectRoot[rootName.c_str()].swap(containerForSubElem);
 		}
-		return objectRoot;
 	}
 }
@@ -14,9 +14,13 @@
 ****************************************************************************************/
 
 #include <string>
+#include <string.h>
 #include "json.h"
 #include "json-forwards.h"
 #include "External_function.hh"
+#include "OneM2M_PayloadLog.hh"
+#include "OneM2M_JsonStream.hh"
+#include "OneM2M_MappingArena.hh"
 #include "OneM2M_DualFaceMapping.hh"
 
 using namespace tinyxml2;
@@ -32,14 +36,13 @@ namespace OneM2M__DualFaceMapping {
 		Value resourceRoot(objectValue);
 		Value jsonRoot(objectValue);
 
-		Reader jsonReader;
+		Reader& jsonReader = MappingArena::instance().jsonReader();
 		std::string name_short;
 
 		const char* p_body			= (const char*)p__source;
-		CHARSTRING encoded_message	= "";
 
 		// 1. Make the JSOn object from the string data
-		bool parsingSuccessful = jsonReader.parse(p_body, jsonRoot, false);
+		bool parsingSuccessful = jsonReader.parse(p_body, p_body + strlen(p_body), jsonRoot, false);
 		if ( !parsingSuccessful ) {
 			TTCN_Logger::log(TTCN_DEBUG, "JsonCPP API parsing error!");
 			return "JsonCPP API parsing error!";
@@ -61,7 +64,7 @@ namespace OneM2M__DualFaceMapping {
 			}
 
 			if(elemObj.isObject()) { // object
-				subElemObj = sub_JSON_Enc_Parser_Deep(elemObj, subElemObj, elemName);
+				sub_JSON_Enc_Parser_Deep(elemObj, subElemObj, elemName);
 			} else if (elemObj.isArray()) { // array
 				Value elemArrayObj(arrayValue);
 
@@ -93,18 +96,12 @@ namespace OneM2M__DualFaceMapping {
 		}
 
 		resourceRoot[rootName] = subElemObj;
-		TTCN_Logger::log(TTCN_DEBUG, "Pretty print of DECODED JSON message:\n%s", resourceRoot.toStyledString().c_str());
+		log_payload("Pretty print of DECODED JSON message", resourceRoot);
 
-		StyledWriter writer;
-		std::string json_str = writer.write(resourceRoot);
-
-		CHARSTRING temp_cs(json_str.c_str());
-		encoded_message	= temp_cs;
-
-		return encoded_message;
+		return JSON_wire_string(resourceRoot);
 	}
 
-	Json::Value sub_JSON_Enc_Parser_Deep (Json::Value objectSource, Json::Value objectRoot, Json::Value elemName) {
+	void sub_JSON_Enc_Parser_Deep (const Json::Value& objectSource, Json::Value& objectRoot, const Json::Value& elemName) {
 
 		std::string name_short;
 		std::string rootName;
@@ -112,14 +109,13 @@ namespace OneM2M__DualFaceMapping {
 		Value subElemObj(objectValue);
 		Value containerForSubElem(objectValue);
 
-		for (Value::iterator iter = objectSource.begin(); iter != objectSource.end(); ++iter) {
+		for (Value::const_iterator iter = objectSource.begin(); iter != objectSource.end(); ++iter) {
 
 			Value elemName;
-			Value elemObj(objectValue);
 
 			// 1. Select the attribute with KEY
 			elemName = iter.key();
-			elemObj = objectSource.get(elemName.asString(), "");
+			const Value& elemObj = *iter;
 
 			// 2. Change the oneM2M long name to short name for SUT
 			name_short = getShortName(elemName.asString());
@@ -132,7 +128,7 @@ namespace OneM2M__DualFaceMapping {
 
 				for(unsigned int index = 0; index < elemObj.size(); index++){
 
-					Value tempObj = elemObj[index];
+					const Value& tempObj = elemObj[index];
 
 					if(tempObj.isString()){
 						std::string attr_val = getShortName(tempObj.asString());
@@ -152,9 +148,8 @@ namespace OneM2M__DualFaceMapping {
 					} else {
 						TTCN_Logger::log(TTCN_DEBUG, "Unexpected flow");
 					}
-					containerForSubElem[name_short.c_str()] = elemArrayObj;
 				}
-				containerForSubElem[name_short.c_str()] = elemArrayObj;
+				containerForSubElem[name_short.c_str()].swap(elemArrayObj);
 			}
 		}
 
@@ -164,8 +159,6 @@ namespace OneM2M__DualFaceMapping {
 			rootName = elemName.asString();
 		}
 
-		objectRoot[rootName.c_str()] = containerForSubElem;
-
-		return objectRoot;
+		objectRoot[rootName.c_str()].swap(containerForSubElem);
 	}
 }